@@ -0,0 +1,209 @@
+/**
+ * ----------------------------------------------------------------------------
+ * Handling images on the Gamebuino META
+ * © 2021 Stéphane Calderoni
+ * ----------------------------------------------------------------------------
+ * Frames of the RGB565 assets packed into a single atlas
+ * ----------------------------------------------------------------------------
+ * Generated by tools/asset-compiler from artwork/assets.cfg
+ * ----------------------------------------------------------------------------
+ */
+
+#pragma once
+
+#include "../gfx/atlas.h"
+#include "../gfx/validate.h"
+
+// arrays of this header, ASSET(NAME) each
+#define ATLAS_ASSETS(ASSET) \
+    ASSET(ATLAS_DATA) \
+    ASSET(ATLAS_FRAMES) \
+    ASSET(ATLAS_REGIONS)
+
+// source: spritesheet-2x2.png tileset-2x2.png torch-5x2.png (fnv1a 0xc8a2d66b)
+constexpr uint16_t ATLAS_DATA[] = {
+
+    // metadata
+
+    16,     // frame width
+    128,    // frame height
+    1,      // frames
+    0,      // frame loop
+    0xf81f, // transparent color
+    0,      // 16-bits color mode
+
+    // colormap
+
+    // frame 1/1
+    0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xfb20, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xfb20, 0xf81f, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xfb20, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xfb20, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xfb20, 0xf81f, 0xf81f, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xfb20, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xfb20, 0xfb20, 0xf81f, 0xf81f, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0xf81f, 0xfb20, 0xfb20, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xfb20, 0xfd40, 0xfd40, 0xfb20, 0xf81f, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0xfb20, 0xfd40, 0xfd40, 0xfb20, 0xf81f, 0xf81f, 0xf81f, 0xfb20, 0xfd40, 0xfd40, 0xfb20, 0xf81f, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0xfb20, 0xfd40, 0xfd40, 0xfb20, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xfb20, 0xfee4, 0xfd40, 0xfb20, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0xfb20, 0xfee4, 0xfee4, 0xfb20, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xfb20, 0xfee4, 0xfee4, 0xfb20, 0xf81f, 0xf81f,
+    0xf81f, 0x6a86, 0x8b27, 0x8b27, 0x8b27, 0x8b27, 0x6a86, 0xf81f, 0xf81f, 0x6a86, 0x8b27, 0x8b27, 0x8b27, 0x8b27, 0x6a86, 0xf81f,
+    0xf81f, 0xf81f, 0x49c4, 0x6a86, 0x6a86, 0x49c4, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0x49c4, 0x6a86, 0x6a86, 0x49c4, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0x6a86, 0x8b27, 0x8b27, 0x6a86, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0x6a86, 0x8b27, 0x8b27, 0x6a86, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0x49c4, 0x8b27, 0x8b27, 0x49c4, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0x49c4, 0x8b27, 0x8b27, 0x49c4, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0xf81f, 0x49c4, 0x49c4, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0x49c4, 0x49c4, 0xf81f, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xfb20, 0xf81f, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xfb20, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0xfb20, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xfb20, 0xf81f, 0xfb20, 0xf81f, 0xf81f, 0xf81f, 0xf81f,
+    0xf81f, 0xfb20, 0xfb20, 0xfb20, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xfb20, 0xf81f, 0xf81f, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0xfb20, 0xfd40, 0xfb20, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xfb20, 0xfb20, 0xf81f, 0xf81f, 0xf81f, 0xf81f,
+    0xf81f, 0xfb20, 0xfd40, 0xfd40, 0xfb20, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xfb20, 0xfd40, 0xfb20, 0xf81f, 0xf81f, 0xf81f,
+    0xf81f, 0xfb20, 0xfd40, 0xfee4, 0xfd40, 0xfb20, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xfb20, 0xfd40, 0xfd40, 0xfb20, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0xfb20, 0xfee4, 0xfee4, 0xfb20, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xfb20, 0xfee4, 0xfee4, 0xfb20, 0xf81f, 0xf81f,
+    0xf81f, 0x6a86, 0x8b27, 0x8b27, 0x8b27, 0x8b27, 0x6a86, 0xf81f, 0xf81f, 0x6a86, 0x8b27, 0x8b27, 0x8b27, 0x8b27, 0x6a86, 0xf81f,
+    0xf81f, 0xf81f, 0x49c4, 0x6a86, 0x6a86, 0x49c4, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0x49c4, 0x6a86, 0x6a86, 0x49c4, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0x6a86, 0x8b27, 0x8b27, 0x6a86, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0x6a86, 0x8b27, 0x8b27, 0x6a86, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0x49c4, 0x8b27, 0x8b27, 0x49c4, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0x49c4, 0x8b27, 0x8b27, 0x49c4, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0xf81f, 0x49c4, 0x49c4, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0x49c4, 0x49c4, 0xf81f, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xfb20, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f,
+    0xf81f, 0xfb20, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xfb20, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xfb20, 0xf81f, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xfb20, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xfb20, 0xfb20, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0xf81f, 0xfb20, 0xfd40, 0xfb20, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xfb20, 0xfd40, 0xfb20, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0xf81f, 0xfb20, 0xfd40, 0xfb20, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xfb20, 0xfd40, 0xfd40, 0xfb20, 0xf81f,
+    0xf81f, 0xf81f, 0xfb20, 0xfd40, 0xfd40, 0xfb20, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xfb20, 0xfd40, 0xfee4, 0xfb20, 0xfb20, 0xf81f,
+    0xf81f, 0xf81f, 0xfb20, 0xfee4, 0xfee4, 0xfb20, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xfb20, 0xfee4, 0xfee4, 0xfb20, 0xf81f, 0xf81f,
+    0xf81f, 0x6a86, 0x8b27, 0x8b27, 0x8b27, 0x8b27, 0x6a86, 0xf81f, 0xf81f, 0x6a86, 0x8b27, 0x8b27, 0x8b27, 0x8b27, 0x6a86, 0xf81f,
+    0xf81f, 0xf81f, 0x49c4, 0x6a86, 0x6a86, 0x49c4, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0x49c4, 0x6a86, 0x6a86, 0x49c4, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0x6a86, 0x8b27, 0x8b27, 0x6a86, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0x6a86, 0x8b27, 0x8b27, 0x6a86, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0x49c4, 0x8b27, 0x8b27, 0x49c4, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0x49c4, 0x8b27, 0x8b27, 0x49c4, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0xf81f, 0x49c4, 0x49c4, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0x49c4, 0x49c4, 0xf81f, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xfb20, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f,
+    0xf81f, 0xfb20, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xfb20, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xfb20, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xfb20, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xfb20, 0xf81f, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xfb20, 0xfb20, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xfb20, 0xfd40, 0xfb20, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xfb20, 0xfd40, 0xfb20, 0xf81f, 0xf81f, 0xf81f, 0xfb20, 0xfd40, 0xfd40, 0xfb20, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0xf81f, 0xfb20, 0xfd40, 0xfb20, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xfb20, 0xfee4, 0xfb20, 0xf81f, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0xfb20, 0xfee4, 0xfee4, 0xfb20, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xfb20, 0xfee4, 0xfee4, 0xfb20, 0xf81f, 0xf81f,
+    0xf81f, 0x6a86, 0x8b27, 0x8b27, 0x8b27, 0x8b27, 0x6a86, 0xf81f, 0xf81f, 0x6a86, 0x8b27, 0x8b27, 0x8b27, 0x8b27, 0x6a86, 0xf81f,
+    0xf81f, 0xf81f, 0x49c4, 0x6a86, 0x6a86, 0x49c4, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0x49c4, 0x6a86, 0x6a86, 0x49c4, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0x6a86, 0x8b27, 0x8b27, 0x6a86, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0x6a86, 0x8b27, 0x8b27, 0x6a86, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0x49c4, 0x8b27, 0x8b27, 0x49c4, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0x49c4, 0x8b27, 0x8b27, 0x49c4, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0xf81f, 0x49c4, 0x49c4, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0x49c4, 0x49c4, 0xf81f, 0xf81f, 0xf81f,
+    0xf81f, 0xfb20, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xfb20, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xfb20, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0xf81f, 0xfb20, 0xfb20, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xfb20, 0xf81f, 0xf81f, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0xfb20, 0xfd40, 0xfd40, 0xfb20, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xfb20, 0xfd40, 0xfb20, 0xf81f, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0xf81f, 0xfb20, 0xfd40, 0xfb20, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xfb20, 0xfd40, 0xfb20, 0xf81f, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0xf81f, 0xfb20, 0xfee4, 0xfb20, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xfb20, 0xfee4, 0xfd40, 0xfb20, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0xfb20, 0xfb20, 0xfee4, 0xfb20, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xfb20, 0xfee4, 0xfee4, 0xfb20, 0xf81f, 0xf81f,
+    0xf81f, 0x6a86, 0x8b27, 0x8b27, 0x8b27, 0x8b27, 0x6a86, 0xf81f, 0xf81f, 0x6a86, 0x8b27, 0x8b27, 0x8b27, 0x8b27, 0x6a86, 0xf81f,
+    0xf81f, 0xf81f, 0x49c4, 0x6a86, 0x6a86, 0x49c4, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0x49c4, 0x6a86, 0x6a86, 0x49c4, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0x6a86, 0x8b27, 0x8b27, 0x6a86, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0x6a86, 0x8b27, 0x8b27, 0x6a86, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0x49c4, 0x8b27, 0x8b27, 0x49c4, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0x49c4, 0x8b27, 0x8b27, 0x49c4, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0xf81f, 0x49c4, 0x49c4, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0x49c4, 0x49c4, 0xf81f, 0xf81f, 0xf81f,
+    0x1926, 0x1926, 0x1926, 0x1926, 0x1926, 0x1926, 0x1926, 0x1926, 0x1926, 0x1926, 0x1926, 0x1926, 0x1926, 0x1926, 0x1926, 0x0000,
+    0x1926, 0x1926, 0x10e4, 0x1926, 0x10e4, 0x1926, 0x10e4, 0x1926, 0x10e4, 0x1926, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x0862,
+    0x1926, 0x10e4, 0x1926, 0x10e4, 0x1926, 0x10e4, 0x1926, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x0862,
+    0x1926, 0x1926, 0x10e4, 0x1926, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x0862,
+    0x1926, 0x10e4, 0x1926, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x0862,
+    0x1926, 0x1926, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x0862,
+    0x1926, 0x10e4, 0x1926, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x0862, 0x0862,
+    0x1926, 0x1926, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x0862,
+    0x4228, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c,
+    0xad55, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
+    0x632c, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
+    0x0000, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186,
+    0x18c3, 0x0000, 0x18c3, 0x0000, 0x18c3, 0x0000, 0x18c3, 0x0000, 0x18c3, 0x0000, 0x18c3, 0x0000, 0x18c3, 0x0000, 0x18c3, 0x0000,
+    0x0000, 0x18c3, 0x0000, 0x3186, 0x0000, 0x18c3, 0x0000, 0x3186, 0x0000, 0x18c3, 0x0000, 0x3186, 0x0000, 0x18c3, 0x0000, 0x3186,
+    0x3186, 0x0000, 0x3186, 0x0000, 0x3186, 0x0000, 0x3186, 0x0000, 0x3186, 0x0000, 0x3186, 0x0000, 0x3186, 0x0000, 0x3186, 0x0000,
+    0x0000, 0x18c3, 0x0000, 0x18c3, 0x0000, 0x18c3, 0x0000, 0x18c3, 0x0000, 0x18c3, 0x0000, 0x18c3, 0x0000, 0x18c3, 0x0000, 0x18c3,
+    0x1926, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x0862, 0x0862,
+    0x1926, 0x1926, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x0862, 0x10e4, 0x0862,
+    0x1926, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x0862, 0x0862,
+    0x1926, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x0862, 0x10e4, 0x0862,
+    0x1926, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x0862, 0x10e4, 0x0862, 0x0862,
+    0x1926, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x0862, 0x10e4, 0x0862, 0x10e4, 0x0862, 0x10e4, 0x0862,
+    0x1926, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x10e4, 0x0862, 0x10e4, 0x0862, 0x10e4, 0x0862, 0x10e4, 0x0862, 0x10e4, 0x0862, 0x0862,
+    0x0000, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0000,
+    0x0000, 0x632c, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x18c3,
+    0x632c, 0x3186, 0x18c3, 0x3186, 0x18c3, 0x3186, 0x18c3, 0x3186, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x0000,
+    0x3186, 0x18c3, 0x3186, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x0000,
+    0x3186, 0x3186, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x0000,
+    0x3186, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x0000, 0x0000,
+    0x3186, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x0000, 0x18c3, 0x0000, 0x18c3, 0x0000,
+    0x3186, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x0000, 0x18c3, 0x0000, 0x18c3, 0x0000, 0x18c3, 0x0000, 0x18c3, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18c3,
+    0xf81f, 0xf81f, 0x632c, 0xad55, 0xad55, 0xad55, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0x632c, 0xad55, 0xad55, 0xad55, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0xee2f, 0xff36, 0xff36, 0xff36, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xee2f, 0xff36, 0xff36, 0xff36, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0xee2f, 0x0000, 0xff36, 0x0000, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xee2f, 0x0000, 0xff36, 0x0000, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0xee2f, 0xff36, 0xff36, 0xff36, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xee2f, 0xff36, 0xff36, 0xff36, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0x7afa, 0xb4df, 0xb4df, 0xb4df, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0x7afa, 0xb4df, 0xb4df, 0xb4df, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0xff36, 0xb4df, 0xb4df, 0xb4df, 0xff36, 0xf81f, 0xf81f, 0xff36, 0x7afa, 0xb4df, 0xb4df, 0xb4df, 0x7afa, 0xff36,
+    0xf81f, 0xf81f, 0x7afa, 0xb4df, 0xb4df, 0xb4df, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0x7afa, 0xb4df, 0xb4df, 0xb4df, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0x6217, 0xf81f, 0xf81f, 0x6217, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0x7afa, 0x6217, 0xf81f, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0x632c, 0xad55, 0xad55, 0xad55, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0xee2f, 0xff36, 0xff36, 0xff36, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0xee2f, 0x0000, 0xff36, 0x0000, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0xee2f, 0xff36, 0xff36, 0xff36, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0x7afa, 0xb4df, 0xb4df, 0xb4df, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0x7afa, 0x7afa, 0xff36, 0xb4df, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0x7afa, 0xb4df, 0xb4df, 0xb4df, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f,
+    0xf81f, 0x6217, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0x7afa, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f
+
+};
+
+static_assert(gfx::validRgb565(ATLAS_DATA), "ATLAS_DATA is not a valid RGB565 image");
+
+// source: spritesheet-2x2.png tileset-2x2.png torch-5x2.png (fnv1a 0xd529c081)
+constexpr gfx::AtlasFrame ATLAS_FRAMES[] = {
+
+    // SPRITE_DATA
+
+    { 0, 112 }, { 8, 112 }, { 0, 112 }, { 0, 120 },
+
+    // TILESET_DATA
+
+    { 0, 80 }, { 0, 88 }, { 0, 96 }, { 0, 104 },
+
+    // TORCH_DATA
+
+    { 0, 0 }, { 8, 0 }, { 0, 16 }, { 8, 16 }, { 0, 32 }, { 8, 32 }, { 0, 48 }, { 8, 48 }, { 0, 64 }, { 8, 64 }
+
+};
+
+// source: spritesheet-2x2.png tileset-2x2.png torch-5x2.png (fnv1a 0x8ff5e148)
+constexpr gfx::AtlasRegion ATLAS_REGIONS[] = {
+
+    // width, height, frames, frame loop, first entry in ATLAS_FRAMES
+
+    { 8, 8, 4, 0, 0 },     // ATLAS_SPRITE
+    { 16, 8, 4, 0, 4 },    // ATLAS_TILESET
+    { 8, 16, 10, 2, 8 }    // ATLAS_TORCH
+
+};
+
+static_assert(gfx::validAtlas(ATLAS_REGIONS, ATLAS_FRAMES, ATLAS_DATA), "ATLAS_REGIONS refers to frames missing from ATLAS_FRAMES or lying outside ATLAS_DATA");
+
+// source: spritesheet-2x2.png tileset-2x2.png torch-5x2.png (fnv1a 0x6e156257)
+enum AtlasRegionId : uint8_t {
+    ATLAS_SPRITE,
+    ATLAS_TILESET,
+    ATLAS_TORCH
+};
+
+// source: spritesheet-2x2.png tileset-2x2.png torch-5x2.png (fnv1a 0xbceeb4ce)
+constexpr gfx::Atlas ATLAS(ATLAS_DATA, ATLAS_REGIONS, ATLAS_FRAMES);
\ No newline at end of file
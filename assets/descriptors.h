@@ -0,0 +1,51 @@
+/**
+ * ----------------------------------------------------------------------------
+ * Handling images on the Gamebuino META
+ * © 2021 Stéphane Calderoni
+ * ----------------------------------------------------------------------------
+ * Compile-time descriptors of the RGB565 assets
+ * ----------------------------------------------------------------------------
+ * Generated by tools/asset-compiler from artwork/assets.cfg
+ * ----------------------------------------------------------------------------
+ */
+
+#pragma once
+
+#include "rgb565.h"
+#include "../gfx/asset.h"
+
+// source: spritesheet-2x2.png (fnv1a 0x03675615)
+typedef gfx::Asset<
+    SPRITE_DATA,
+    8,      // frame width
+    8,      // frame height
+    3,      // frames
+    0xf81f, // transparent color
+    0       // 16-bits color mode
+> SPRITE_ASSET;
+
+static_assert(gfx::validAsset<SPRITE_ASSET>(), "SPRITE_ASSET does not match the header of SPRITE_DATA");
+
+// source: tileset-2x2.png (fnv1a 0x9ccb1b31)
+typedef gfx::Asset<
+    TILESET_DATA,
+    16,     // frame width
+    8,      // frame height
+    4,      // frames
+    0xf81f, // transparent color
+    0       // 16-bits color mode
+> TILESET_ASSET;
+
+static_assert(gfx::validAsset<TILESET_ASSET>(), "TILESET_ASSET does not match the header of TILESET_DATA");
+
+// source: torch-5x2.png (fnv1a 0x628f9a93)
+typedef gfx::Asset<
+    TORCH_DATA,
+    8,      // frame width
+    16,     // frame height
+    10,     // frames
+    0xf81f, // transparent color
+    0       // 16-bits color mode
+> TORCH_ASSET;
+
+static_assert(gfx::validAsset<TORCH_ASSET>(), "TORCH_ASSET does not match the header of TORCH_DATA");
\ No newline at end of file
@@ -0,0 +1,26 @@
+/**
+ * ----------------------------------------------------------------------------
+ * Handling images on the Gamebuino META
+ * © 2021 Stéphane Calderoni
+ * ----------------------------------------------------------------------------
+ * Assets of the display mode set by DISPLAY_MODE in config-gamebuino.h
+ * ----------------------------------------------------------------------------
+ * Generated by tools/asset-compiler from artwork/assets.cfg
+ * ----------------------------------------------------------------------------
+ */
+
+#pragma once
+
+#include <Gamebuino-Meta.h>
+
+// only the arrays of the selected variant end up in flash
+#if DISPLAY_MODE == DISPLAY_MODE_INDEX
+#include "fullres.h"
+#define DISPLAY_ASSETS FULLRES_ASSETS
+#elif DISPLAY_MODE == DISPLAY_MODE_INDEX_HALFRES
+#include "indexed.h"
+#define DISPLAY_ASSETS INDEXED_ASSETS
+#else
+#include "rgb565.h"
+#define DISPLAY_ASSETS RGB565_ASSETS
+#endif
\ No newline at end of file
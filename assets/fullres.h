@@ -0,0 +1,1090 @@
+/**
+ * ----------------------------------------------------------------------------
+ * Handling images on the Gamebuino META
+ * © 2021 Stéphane Calderoni
+ * ----------------------------------------------------------------------------
+ * Assets encoded for 16-indexed colors display mode at full resolution (160x128)
+ * ----------------------------------------------------------------------------
+ * Generated by tools/asset-compiler from artwork/assets.cfg
+ * ----------------------------------------------------------------------------
+ */
+
+#pragma once
+
+#include <Gamebuino-Meta.h>
+#include "../gfx/validate.h"
+
+// arrays of this header, ASSET(NAME) each
+#define FULLRES_ASSETS(ASSET) \
+    ASSET(PALETTE) \
+    ASSET(SPRITE_DATA) \
+    ASSET(SPRITE_FRAMES) \
+    ASSET(SPRITE_SPANS) \
+    ASSET(SPRITE_MIRROR) \
+    ASSET(TILESET_DATA) \
+    ASSET(TORCH_DATA) \
+    ASSET(TORCH_SPANS)
+
+// source: palette-1x16.png (fnv1a 0x7d29c374)
+const Color PALETTE[] = {
+
+    (Color) 0x0000, // 0x0
+    (Color) 0x18c3, // 0x1
+    (Color) 0x3186, // 0x2
+    (Color) 0x4228, // 0x3
+    (Color) 0x632c, // 0x4
+    (Color) 0xad55, // 0x5
+    (Color) 0xee2f, // 0x6
+    (Color) 0xff36, // 0x7
+    (Color) 0x0862, // 0x8
+    (Color) 0x10e4, // 0x9
+    (Color) 0x1926, // 0xa
+    (Color) 0x6217, // 0xb
+    (Color) 0x7afa, // 0xc
+    (Color) 0xb4df, // 0xd
+    (Color) 0xf81f, // 0xe
+    (Color) 0x0000  // 0xf
+
+};
+
+static_assert(sizeof(PALETTE) / sizeof(*PALETTE) == 16, "PALETTE must give a color to every index");
+
+// source: spritesheet-2x2.png (fnv1a 0x47ee304e)
+constexpr uint8_t SPRITE_DATA[] = {
+
+    // metadata
+
+    16,   // frame width
+    16,   // frame height
+    0x03, // frames (lower byte)
+    0x00, // frames (upper byte)
+    0,    // frame loop
+    0xe,  // transparent color
+    1,    // indexed color mode
+
+    // colormap
+
+    // frame 1/3
+    0xee, 0xee, 0x44, 0x55, 0x55, 0x55, 0xee, 0xee,
+    0xee, 0xee, 0x44, 0x55, 0x55, 0x55, 0xee, 0xee,
+    0xee, 0xee, 0x66, 0x77, 0x77, 0x77, 0xee, 0xee,
+    0xee, 0xee, 0x66, 0x77, 0x77, 0x77, 0xee, 0xee,
+    0xee, 0xee, 0x66, 0x00, 0x77, 0x00, 0xee, 0xee,
+    0xee, 0xee, 0x66, 0x00, 0x77, 0x00, 0xee, 0xee,
+    0xee, 0xee, 0x66, 0x77, 0x77, 0x77, 0xee, 0xee,
+    0xee, 0xee, 0x66, 0x77, 0x77, 0x77, 0xee, 0xee,
+    0xee, 0xee, 0xcc, 0xdd, 0xdd, 0xdd, 0xee, 0xee,
+    0xee, 0xee, 0xcc, 0xdd, 0xdd, 0xdd, 0xee, 0xee,
+    0xee, 0xee, 0x77, 0xdd, 0xdd, 0xdd, 0x77, 0xee,
+    0xee, 0xee, 0x77, 0xdd, 0xdd, 0xdd, 0x77, 0xee,
+    0xee, 0xee, 0xcc, 0xdd, 0xdd, 0xdd, 0xee, 0xee,
+    0xee, 0xee, 0xcc, 0xdd, 0xdd, 0xdd, 0xee, 0xee,
+    0xee, 0xee, 0xbb, 0xee, 0xee, 0xbb, 0xee, 0xee,
+    0xee, 0xee, 0xbb, 0xee, 0xee, 0xbb, 0xee, 0xee,
+
+    // frame 2/3
+    0xee, 0xee, 0x44, 0x55, 0x55, 0x55, 0xee, 0xee,
+    0xee, 0xee, 0x44, 0x55, 0x55, 0x55, 0xee, 0xee,
+    0xee, 0xee, 0x66, 0x77, 0x77, 0x77, 0xee, 0xee,
+    0xee, 0xee, 0x66, 0x77, 0x77, 0x77, 0xee, 0xee,
+    0xee, 0xee, 0x66, 0x00, 0x77, 0x00, 0xee, 0xee,
+    0xee, 0xee, 0x66, 0x00, 0x77, 0x00, 0xee, 0xee,
+    0xee, 0xee, 0x66, 0x77, 0x77, 0x77, 0xee, 0xee,
+    0xee, 0xee, 0x66, 0x77, 0x77, 0x77, 0xee, 0xee,
+    0xee, 0xee, 0xcc, 0xdd, 0xdd, 0xdd, 0xee, 0xee,
+    0xee, 0xee, 0xcc, 0xdd, 0xdd, 0xdd, 0xee, 0xee,
+    0xee, 0x77, 0xcc, 0xdd, 0xdd, 0xdd, 0xcc, 0x77,
+    0xee, 0x77, 0xcc, 0xdd, 0xdd, 0xdd, 0xcc, 0x77,
+    0xee, 0xee, 0xcc, 0xdd, 0xdd, 0xdd, 0xee, 0xee,
+    0xee, 0xee, 0xcc, 0xdd, 0xdd, 0xdd, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xcc, 0xbb, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xcc, 0xbb, 0xee, 0xee, 0xee,
+
+    // frame 3/3
+    0xee, 0xee, 0x44, 0x55, 0x55, 0x55, 0xee, 0xee,
+    0xee, 0xee, 0x44, 0x55, 0x55, 0x55, 0xee, 0xee,
+    0xee, 0xee, 0x66, 0x77, 0x77, 0x77, 0xee, 0xee,
+    0xee, 0xee, 0x66, 0x77, 0x77, 0x77, 0xee, 0xee,
+    0xee, 0xee, 0x66, 0x00, 0x77, 0x00, 0xee, 0xee,
+    0xee, 0xee, 0x66, 0x00, 0x77, 0x00, 0xee, 0xee,
+    0xee, 0xee, 0x66, 0x77, 0x77, 0x77, 0xee, 0xee,
+    0xee, 0xee, 0x66, 0x77, 0x77, 0x77, 0xee, 0xee,
+    0xee, 0xee, 0xcc, 0xdd, 0xdd, 0xdd, 0xee, 0xee,
+    0xee, 0xee, 0xcc, 0xdd, 0xdd, 0xdd, 0xee, 0xee,
+    0xee, 0xee, 0xcc, 0xcc, 0x77, 0xdd, 0xee, 0xee,
+    0xee, 0xee, 0xcc, 0xcc, 0x77, 0xdd, 0xee, 0xee,
+    0xee, 0xee, 0xcc, 0xdd, 0xdd, 0xdd, 0xee, 0xee,
+    0xee, 0xee, 0xcc, 0xdd, 0xdd, 0xdd, 0xee, 0xee,
+    0xee, 0xbb, 0xee, 0xee, 0xee, 0xee, 0xcc, 0xee,
+    0xee, 0xbb, 0xee, 0xee, 0xee, 0xee, 0xcc, 0xee
+
+};
+
+static_assert(gfx::validIndexed(SPRITE_DATA), "SPRITE_DATA is not a valid indexed image");
+
+// source: spritesheet-2x2.png (fnv1a 0x69a695aa)
+constexpr uint8_t SPRITE_FRAMES[] = {
+
+    // 4 frames stored as 3, 128 bytes saved
+
+    0, 1, 0, 2
+
+};
+
+static_assert(gfx::validFrames(SPRITE_FRAMES, SPRITE_DATA), "SPRITE_FRAMES refers to frames missing from SPRITE_DATA");
+
+// source: spritesheet-2x2.png (fnv1a 0x338fcd99)
+constexpr uint8_t SPRITE_SPANS[] = {
+
+    // 52 spans, 376 of 768 pixels opaque
+
+    // frame offsets (lower byte, upper byte)
+
+    0x06, 0x00, 0x3a, 0x00, 0x6a, 0x00,
+
+    // frame 1/3: span count, then (start, length) of each span
+
+    1, 4, 8,
+    1, 4, 8,
+    1, 4, 8,
+    1, 4, 8,
+    1, 4, 8,
+    1, 4, 8,
+    1, 4, 8,
+    1, 4, 8,
+    1, 4, 8,
+    1, 4, 8,
+    1, 4, 10,
+    1, 4, 10,
+    1, 4, 8,
+    1, 4, 8,
+    2, 4, 2, 10, 2,
+    2, 4, 2, 10, 2,
+
+    // frame 2/3: span count, then (start, length) of each span
+
+    1, 4, 8,
+    1, 4, 8,
+    1, 4, 8,
+    1, 4, 8,
+    1, 4, 8,
+    1, 4, 8,
+    1, 4, 8,
+    1, 4, 8,
+    1, 4, 8,
+    1, 4, 8,
+    1, 2, 14,
+    1, 2, 14,
+    1, 4, 8,
+    1, 4, 8,
+    1, 6, 4,
+    1, 6, 4,
+
+    // frame 3/3: span count, then (start, length) of each span
+
+    1, 4, 8,
+    1, 4, 8,
+    1, 4, 8,
+    1, 4, 8,
+    1, 4, 8,
+    1, 4, 8,
+    1, 4, 8,
+    1, 4, 8,
+    1, 4, 8,
+    1, 4, 8,
+    1, 4, 8,
+    1, 4, 8,
+    1, 4, 8,
+    1, 4, 8,
+    2, 2, 2, 12, 2,
+    2, 2, 2, 12, 2
+
+};
+
+static_assert(gfx::validSpans(SPRITE_SPANS, SPRITE_DATA), "SPRITE_SPANS does not match the frames of SPRITE_DATA");
+
+// source: spritesheet-2x2.png (fnv1a 0x88373e73)
+constexpr uint8_t SPRITE_MIRROR[] = {
+
+    // metadata
+
+    16,   // frame width
+    16,   // frame height
+    0x03, // frames (lower byte)
+    0x00, // frames (upper byte)
+    0,    // frame loop
+    0xe,  // transparent color
+    1,    // indexed color mode
+
+    // colormap
+
+    // frame 1/3
+    0xee, 0xee, 0x55, 0x55, 0x55, 0x44, 0xee, 0xee,
+    0xee, 0xee, 0x55, 0x55, 0x55, 0x44, 0xee, 0xee,
+    0xee, 0xee, 0x77, 0x77, 0x77, 0x66, 0xee, 0xee,
+    0xee, 0xee, 0x77, 0x77, 0x77, 0x66, 0xee, 0xee,
+    0xee, 0xee, 0x00, 0x77, 0x00, 0x66, 0xee, 0xee,
+    0xee, 0xee, 0x00, 0x77, 0x00, 0x66, 0xee, 0xee,
+    0xee, 0xee, 0x77, 0x77, 0x77, 0x66, 0xee, 0xee,
+    0xee, 0xee, 0x77, 0x77, 0x77, 0x66, 0xee, 0xee,
+    0xee, 0xee, 0xdd, 0xdd, 0xdd, 0xcc, 0xee, 0xee,
+    0xee, 0xee, 0xdd, 0xdd, 0xdd, 0xcc, 0xee, 0xee,
+    0xee, 0x77, 0xdd, 0xdd, 0xdd, 0x77, 0xee, 0xee,
+    0xee, 0x77, 0xdd, 0xdd, 0xdd, 0x77, 0xee, 0xee,
+    0xee, 0xee, 0xdd, 0xdd, 0xdd, 0xcc, 0xee, 0xee,
+    0xee, 0xee, 0xdd, 0xdd, 0xdd, 0xcc, 0xee, 0xee,
+    0xee, 0xee, 0xbb, 0xee, 0xee, 0xbb, 0xee, 0xee,
+    0xee, 0xee, 0xbb, 0xee, 0xee, 0xbb, 0xee, 0xee,
+
+    // frame 2/3
+    0xee, 0xee, 0x55, 0x55, 0x55, 0x44, 0xee, 0xee,
+    0xee, 0xee, 0x55, 0x55, 0x55, 0x44, 0xee, 0xee,
+    0xee, 0xee, 0x77, 0x77, 0x77, 0x66, 0xee, 0xee,
+    0xee, 0xee, 0x77, 0x77, 0x77, 0x66, 0xee, 0xee,
+    0xee, 0xee, 0x00, 0x77, 0x00, 0x66, 0xee, 0xee,
+    0xee, 0xee, 0x00, 0x77, 0x00, 0x66, 0xee, 0xee,
+    0xee, 0xee, 0x77, 0x77, 0x77, 0x66, 0xee, 0xee,
+    0xee, 0xee, 0x77, 0x77, 0x77, 0x66, 0xee, 0xee,
+    0xee, 0xee, 0xdd, 0xdd, 0xdd, 0xcc, 0xee, 0xee,
+    0xee, 0xee, 0xdd, 0xdd, 0xdd, 0xcc, 0xee, 0xee,
+    0x77, 0xcc, 0xdd, 0xdd, 0xdd, 0xcc, 0x77, 0xee,
+    0x77, 0xcc, 0xdd, 0xdd, 0xdd, 0xcc, 0x77, 0xee,
+    0xee, 0xee, 0xdd, 0xdd, 0xdd, 0xcc, 0xee, 0xee,
+    0xee, 0xee, 0xdd, 0xdd, 0xdd, 0xcc, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xbb, 0xcc, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xbb, 0xcc, 0xee, 0xee, 0xee,
+
+    // frame 3/3
+    0xee, 0xee, 0x55, 0x55, 0x55, 0x44, 0xee, 0xee,
+    0xee, 0xee, 0x55, 0x55, 0x55, 0x44, 0xee, 0xee,
+    0xee, 0xee, 0x77, 0x77, 0x77, 0x66, 0xee, 0xee,
+    0xee, 0xee, 0x77, 0x77, 0x77, 0x66, 0xee, 0xee,
+    0xee, 0xee, 0x00, 0x77, 0x00, 0x66, 0xee, 0xee,
+    0xee, 0xee, 0x00, 0x77, 0x00, 0x66, 0xee, 0xee,
+    0xee, 0xee, 0x77, 0x77, 0x77, 0x66, 0xee, 0xee,
+    0xee, 0xee, 0x77, 0x77, 0x77, 0x66, 0xee, 0xee,
+    0xee, 0xee, 0xdd, 0xdd, 0xdd, 0xcc, 0xee, 0xee,
+    0xee, 0xee, 0xdd, 0xdd, 0xdd, 0xcc, 0xee, 0xee,
+    0xee, 0xee, 0xdd, 0x77, 0xcc, 0xcc, 0xee, 0xee,
+    0xee, 0xee, 0xdd, 0x77, 0xcc, 0xcc, 0xee, 0xee,
+    0xee, 0xee, 0xdd, 0xdd, 0xdd, 0xcc, 0xee, 0xee,
+    0xee, 0xee, 0xdd, 0xdd, 0xdd, 0xcc, 0xee, 0xee,
+    0xee, 0xcc, 0xee, 0xee, 0xee, 0xee, 0xbb, 0xee,
+    0xee, 0xcc, 0xee, 0xee, 0xee, 0xee, 0xbb, 0xee
+
+};
+
+static_assert(gfx::validIndexed(SPRITE_MIRROR), "SPRITE_MIRROR is not a valid indexed image");
+
+// source: tileset-2x2.png (fnv1a 0x8baf13a1)
+constexpr uint8_t TILESET_DATA[] = {
+
+    // metadata
+
+    32,   // frame width
+    16,   // frame height
+    0x04, // frames (lower byte)
+    0x00, // frames (upper byte)
+    0,    // frame loop
+    0xe,  // transparent color
+    1,    // indexed color mode
+
+    // colormap
+
+    // frame 1/4
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x00,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x00,
+    0xaa, 0xaa, 0x99, 0xaa, 0x99, 0xaa, 0x99, 0xaa, 0x99, 0xaa, 0x99, 0x99, 0x99, 0x99, 0x99, 0x88,
+    0xaa, 0xaa, 0x99, 0xaa, 0x99, 0xaa, 0x99, 0xaa, 0x99, 0xaa, 0x99, 0x99, 0x99, 0x99, 0x99, 0x88,
+    0xaa, 0x99, 0xaa, 0x99, 0xaa, 0x99, 0xaa, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x88,
+    0xaa, 0x99, 0xaa, 0x99, 0xaa, 0x99, 0xaa, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x88,
+    0xaa, 0xaa, 0x99, 0xaa, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x88,
+    0xaa, 0xaa, 0x99, 0xaa, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x88,
+    0xaa, 0x99, 0xaa, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x88,
+    0xaa, 0x99, 0xaa, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x88,
+    0xaa, 0xaa, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x88,
+    0xaa, 0xaa, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x88,
+    0xaa, 0x99, 0xaa, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x88, 0x88,
+    0xaa, 0x99, 0xaa, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x88, 0x88,
+    0xaa, 0xaa, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x88,
+    0xaa, 0xaa, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x88,
+
+    // frame 2/4
+    0x33, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x33, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x44, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x44, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x00, 0x11, 0x00, 0x22, 0x00, 0x11, 0x00, 0x22, 0x00, 0x11, 0x00, 0x22, 0x00, 0x11, 0x00, 0x22,
+    0x00, 0x11, 0x00, 0x22, 0x00, 0x11, 0x00, 0x22, 0x00, 0x11, 0x00, 0x22, 0x00, 0x11, 0x00, 0x22,
+    0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00,
+    0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00,
+    0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11,
+    0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11,
+
+    // frame 3/4
+    0xaa, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x88, 0x88,
+    0xaa, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x88, 0x88,
+    0xaa, 0xaa, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x88, 0x99, 0x88,
+    0xaa, 0xaa, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x88, 0x99, 0x88,
+    0xaa, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x88, 0x88,
+    0xaa, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x88, 0x88,
+    0xaa, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x88, 0x99, 0x88,
+    0xaa, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x88, 0x99, 0x88,
+    0xaa, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x88, 0x99, 0x88, 0x88,
+    0xaa, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x88, 0x99, 0x88, 0x88,
+    0xaa, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x88, 0x99, 0x88, 0x99, 0x88, 0x99, 0x88,
+    0xaa, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x88, 0x99, 0x88, 0x99, 0x88, 0x99, 0x88,
+    0xaa, 0x99, 0x99, 0x99, 0x99, 0x99, 0x88, 0x99, 0x88, 0x99, 0x88, 0x99, 0x88, 0x99, 0x88, 0x88,
+    0xaa, 0x99, 0x99, 0x99, 0x99, 0x99, 0x88, 0x99, 0x88, 0x99, 0x88, 0x99, 0x88, 0x99, 0x88, 0x88,
+    0x00, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x00,
+    0x00, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x00,
+
+    // frame 4/4
+    0x00, 0x44, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x11,
+    0x00, 0x44, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x11,
+    0x44, 0x22, 0x11, 0x22, 0x11, 0x22, 0x11, 0x22, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00,
+    0x44, 0x22, 0x11, 0x22, 0x11, 0x22, 0x11, 0x22, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00,
+    0x22, 0x11, 0x22, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00,
+    0x22, 0x11, 0x22, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00,
+    0x22, 0x22, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00,
+    0x22, 0x22, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00,
+    0x22, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00,
+    0x22, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00,
+    0x22, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x22, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x22, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x00,
+    0x22, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11
+
+};
+
+static_assert(gfx::validIndexed(TILESET_DATA), "TILESET_DATA is not a valid indexed image");
+
+// source: torch-5x2.png (fnv1a 0x5709970d)
+constexpr uint8_t TORCH_DATA[] = {
+
+    // metadata
+
+    16,   // frame width
+    32,   // frame height
+    0x0a, // frames (lower byte)
+    0x00, // frames (upper byte)
+    2,    // frame loop
+    0xe,  // transparent color
+    1,    // indexed color mode
+
+    // colormap
+
+    // frame 1/10
+    0xee, 0xee, 0xee, 0xee, 0xee, 0x66, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0x66, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0x66, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0x66, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0x66, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0x66, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0x66, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0x66, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0x66, 0x66, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0x66, 0x66, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0x66, 0x66, 0x66, 0x66, 0xee, 0xee,
+    0xee, 0xee, 0x66, 0x66, 0x66, 0x66, 0xee, 0xee,
+    0xee, 0xee, 0x66, 0x66, 0x66, 0x66, 0xee, 0xee,
+    0xee, 0xee, 0x66, 0x66, 0x66, 0x66, 0xee, 0xee,
+    0xee, 0xee, 0x66, 0x66, 0x66, 0x66, 0xee, 0xee,
+    0xee, 0xee, 0x66, 0x66, 0x66, 0x66, 0xee, 0xee,
+    0xee, 0x33, 0x44, 0x44, 0x44, 0x44, 0x33, 0xee,
+    0xee, 0x33, 0x44, 0x44, 0x44, 0x44, 0x33, 0xee,
+    0xee, 0xee, 0x22, 0x33, 0x33, 0x22, 0xee, 0xee,
+    0xee, 0xee, 0x22, 0x33, 0x33, 0x22, 0xee, 0xee,
+    0xee, 0xee, 0x33, 0x44, 0x44, 0x33, 0xee, 0xee,
+    0xee, 0xee, 0x33, 0x44, 0x44, 0x33, 0xee, 0xee,
+    0xee, 0xee, 0x22, 0x44, 0x44, 0x22, 0xee, 0xee,
+    0xee, 0xee, 0x22, 0x44, 0x44, 0x22, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0x22, 0x22, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0x22, 0x22, 0xee, 0xee, 0xee,
+
+    // frame 2/10
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0x66, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0x66, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0x66, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0x66, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0x66, 0x66, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0x66, 0x66, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0x66, 0x66, 0x66, 0x66, 0xee, 0xee, 0xee,
+    0xee, 0x66, 0x66, 0x66, 0x66, 0xee, 0xee, 0xee,
+    0xee, 0x66, 0x66, 0x66, 0x66, 0xee, 0xee, 0xee,
+    0xee, 0x66, 0x66, 0x66, 0x66, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0x66, 0x66, 0x66, 0x66, 0xee, 0xee,
+    0xee, 0xee, 0x66, 0x66, 0x66, 0x66, 0xee, 0xee,
+    0xee, 0xee, 0x66, 0x66, 0x66, 0x66, 0xee, 0xee,
+    0xee, 0xee, 0x66, 0x66, 0x66, 0x66, 0xee, 0xee,
+    0xee, 0x33, 0x44, 0x44, 0x44, 0x44, 0x33, 0xee,
+    0xee, 0x33, 0x44, 0x44, 0x44, 0x44, 0x33, 0xee,
+    0xee, 0xee, 0x22, 0x33, 0x33, 0x22, 0xee, 0xee,
+    0xee, 0xee, 0x22, 0x33, 0x33, 0x22, 0xee, 0xee,
+    0xee, 0xee, 0x33, 0x44, 0x44, 0x33, 0xee, 0xee,
+    0xee, 0xee, 0x33, 0x44, 0x44, 0x33, 0xee, 0xee,
+    0xee, 0xee, 0x22, 0x44, 0x44, 0x22, 0xee, 0xee,
+    0xee, 0xee, 0x22, 0x44, 0x44, 0x22, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0x22, 0x22, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0x22, 0x22, 0xee, 0xee, 0xee,
+
+    // frame 3/10
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0x66, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0x66, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0x66, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0x66, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0x66, 0x66, 0x66, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0x66, 0x66, 0x66, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0x66, 0x66, 0x66, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0x66, 0x66, 0x66, 0xee, 0xee, 0xee,
+    0xee, 0x66, 0x66, 0x66, 0x66, 0xee, 0xee, 0xee,
+    0xee, 0x66, 0x66, 0x66, 0x66, 0xee, 0xee, 0xee,
+    0xee, 0x66, 0x66, 0x66, 0x66, 0x66, 0xee, 0xee,
+    0xee, 0x66, 0x66, 0x66, 0x66, 0x66, 0xee, 0xee,
+    0xee, 0xee, 0x66, 0x66, 0x66, 0x66, 0xee, 0xee,
+    0xee, 0xee, 0x66, 0x66, 0x66, 0x66, 0xee, 0xee,
+    0xee, 0x33, 0x44, 0x44, 0x44, 0x44, 0x33, 0xee,
+    0xee, 0x33, 0x44, 0x44, 0x44, 0x44, 0x33, 0xee,
+    0xee, 0xee, 0x22, 0x33, 0x33, 0x22, 0xee, 0xee,
+    0xee, 0xee, 0x22, 0x33, 0x33, 0x22, 0xee, 0xee,
+    0xee, 0xee, 0x33, 0x44, 0x44, 0x33, 0xee, 0xee,
+    0xee, 0xee, 0x33, 0x44, 0x44, 0x33, 0xee, 0xee,
+    0xee, 0xee, 0x22, 0x44, 0x44, 0x22, 0xee, 0xee,
+    0xee, 0xee, 0x22, 0x44, 0x44, 0x22, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0x22, 0x22, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0x22, 0x22, 0xee, 0xee, 0xee,
+
+    // frame 4/10
+    0xee, 0xee, 0xee, 0xee, 0x66, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0x66, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0x66, 0xee, 0x66, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0x66, 0xee, 0x66, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0x66, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0x66, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0x66, 0x66, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0x66, 0x66, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0x66, 0x66, 0x66, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0x66, 0x66, 0x66, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0x66, 0x66, 0x66, 0x66, 0xee, 0xee,
+    0xee, 0xee, 0x66, 0x66, 0x66, 0x66, 0xee, 0xee,
+    0xee, 0xee, 0x66, 0x66, 0x66, 0x66, 0xee, 0xee,
+    0xee, 0xee, 0x66, 0x66, 0x66, 0x66, 0xee, 0xee,
+    0xee, 0x33, 0x44, 0x44, 0x44, 0x44, 0x33, 0xee,
+    0xee, 0x33, 0x44, 0x44, 0x44, 0x44, 0x33, 0xee,
+    0xee, 0xee, 0x22, 0x33, 0x33, 0x22, 0xee, 0xee,
+    0xee, 0xee, 0x22, 0x33, 0x33, 0x22, 0xee, 0xee,
+    0xee, 0xee, 0x33, 0x44, 0x44, 0x33, 0xee, 0xee,
+    0xee, 0xee, 0x33, 0x44, 0x44, 0x33, 0xee, 0xee,
+    0xee, 0xee, 0x22, 0x44, 0x44, 0x22, 0xee, 0xee,
+    0xee, 0xee, 0x22, 0x44, 0x44, 0x22, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0x22, 0x22, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0x22, 0x22, 0xee, 0xee, 0xee,
+
+    // frame 5/10
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0x66, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0x66, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0x66, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0x66, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0x66, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0x66, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0x66, 0x66, 0x66, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0x66, 0x66, 0x66, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0x66, 0x66, 0x66, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0x66, 0x66, 0x66, 0xee, 0xee,
+    0xee, 0xee, 0x66, 0x66, 0x66, 0x66, 0xee, 0xee,
+    0xee, 0xee, 0x66, 0x66, 0x66, 0x66, 0xee, 0xee,
+    0xee, 0xee, 0x66, 0x66, 0x66, 0x66, 0xee, 0xee,
+    0xee, 0xee, 0x66, 0x66, 0x66, 0x66, 0xee, 0xee,
+    0xee, 0x33, 0x44, 0x44, 0x44, 0x44, 0x33, 0xee,
+    0xee, 0x33, 0x44, 0x44, 0x44, 0x44, 0x33, 0xee,
+    0xee, 0xee, 0x22, 0x33, 0x33, 0x22, 0xee, 0xee,
+    0xee, 0xee, 0x22, 0x33, 0x33, 0x22, 0xee, 0xee,
+    0xee, 0xee, 0x33, 0x44, 0x44, 0x33, 0xee, 0xee,
+    0xee, 0xee, 0x33, 0x44, 0x44, 0x33, 0xee, 0xee,
+    0xee, 0xee, 0x22, 0x44, 0x44, 0x22, 0xee, 0xee,
+    0xee, 0xee, 0x22, 0x44, 0x44, 0x22, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0x22, 0x22, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0x22, 0x22, 0xee, 0xee, 0xee,
+
+    // frame 6/10
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0x66, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0x66, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0x66, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0x66, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0x66, 0x66, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0x66, 0x66, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0x66, 0x66, 0x66, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0x66, 0x66, 0x66, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0x66, 0x66, 0x66, 0x66, 0xee,
+    0xee, 0xee, 0xee, 0x66, 0x66, 0x66, 0x66, 0xee,
+    0xee, 0xee, 0x66, 0x66, 0x66, 0x66, 0x66, 0xee,
+    0xee, 0xee, 0x66, 0x66, 0x66, 0x66, 0x66, 0xee,
+    0xee, 0xee, 0x66, 0x66, 0x66, 0x66, 0xee, 0xee,
+    0xee, 0xee, 0x66, 0x66, 0x66, 0x66, 0xee, 0xee,
+    0xee, 0x33, 0x44, 0x44, 0x44, 0x44, 0x33, 0xee,
+    0xee, 0x33, 0x44, 0x44, 0x44, 0x44, 0x33, 0xee,
+    0xee, 0xee, 0x22, 0x33, 0x33, 0x22, 0xee, 0xee,
+    0xee, 0xee, 0x22, 0x33, 0x33, 0x22, 0xee, 0xee,
+    0xee, 0xee, 0x33, 0x44, 0x44, 0x33, 0xee, 0xee,
+    0xee, 0xee, 0x33, 0x44, 0x44, 0x33, 0xee, 0xee,
+    0xee, 0xee, 0x22, 0x44, 0x44, 0x22, 0xee, 0xee,
+    0xee, 0xee, 0x22, 0x44, 0x44, 0x22, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0x22, 0x22, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0x22, 0x22, 0xee, 0xee, 0xee,
+
+    // frame 7/10
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0x66, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0x66, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0x66, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0x66, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0x66, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0x66, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0x66, 0x66, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0x66, 0x66, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0x66, 0x66, 0x66, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0x66, 0x66, 0x66, 0xee,
+    0xee, 0xee, 0xee, 0x66, 0x66, 0x66, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0x66, 0x66, 0x66, 0xee, 0xee,
+    0xee, 0xee, 0x66, 0x66, 0x66, 0x66, 0xee, 0xee,
+    0xee, 0xee, 0x66, 0x66, 0x66, 0x66, 0xee, 0xee,
+    0xee, 0x33, 0x44, 0x44, 0x44, 0x44, 0x33, 0xee,
+    0xee, 0x33, 0x44, 0x44, 0x44, 0x44, 0x33, 0xee,
+    0xee, 0xee, 0x22, 0x33, 0x33, 0x22, 0xee, 0xee,
+    0xee, 0xee, 0x22, 0x33, 0x33, 0x22, 0xee, 0xee,
+    0xee, 0xee, 0x33, 0x44, 0x44, 0x33, 0xee, 0xee,
+    0xee, 0xee, 0x33, 0x44, 0x44, 0x33, 0xee, 0xee,
+    0xee, 0xee, 0x22, 0x44, 0x44, 0x22, 0xee, 0xee,
+    0xee, 0xee, 0x22, 0x44, 0x44, 0x22, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0x22, 0x22, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0x22, 0x22, 0xee, 0xee, 0xee,
+
+    // frame 8/10
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0x66, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0x66, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0x66, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0x66, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0x66, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0x66, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0x66, 0x66, 0x66, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0x66, 0x66, 0x66, 0xee, 0xee,
+    0xee, 0xee, 0x66, 0x66, 0x66, 0x66, 0xee, 0xee,
+    0xee, 0xee, 0x66, 0x66, 0x66, 0x66, 0xee, 0xee,
+    0xee, 0xee, 0x66, 0x66, 0x66, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0x66, 0x66, 0x66, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0x66, 0x66, 0x66, 0x66, 0xee, 0xee,
+    0xee, 0xee, 0x66, 0x66, 0x66, 0x66, 0xee, 0xee,
+    0xee, 0x33, 0x44, 0x44, 0x44, 0x44, 0x33, 0xee,
+    0xee, 0x33, 0x44, 0x44, 0x44, 0x44, 0x33, 0xee,
+    0xee, 0xee, 0x22, 0x33, 0x33, 0x22, 0xee, 0xee,
+    0xee, 0xee, 0x22, 0x33, 0x33, 0x22, 0xee, 0xee,
+    0xee, 0xee, 0x33, 0x44, 0x44, 0x33, 0xee, 0xee,
+    0xee, 0xee, 0x33, 0x44, 0x44, 0x33, 0xee, 0xee,
+    0xee, 0xee, 0x22, 0x44, 0x44, 0x22, 0xee, 0xee,
+    0xee, 0xee, 0x22, 0x44, 0x44, 0x22, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0x22, 0x22, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0x22, 0x22, 0xee, 0xee, 0xee,
+
+    // frame 9/10
+    0xee, 0x66, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0x66, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0x66, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0x66, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0x66, 0x66, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0x66, 0x66, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0x66, 0x66, 0x66, 0x66, 0xee, 0xee,
+    0xee, 0xee, 0x66, 0x66, 0x66, 0x66, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0x66, 0x66, 0x66, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0x66, 0x66, 0x66, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0x66, 0x66, 0x66, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0x66, 0x66, 0x66, 0xee, 0xee,
+    0xee, 0xee, 0x66, 0x66, 0x66, 0x66, 0xee, 0xee,
+    0xee, 0xee, 0x66, 0x66, 0x66, 0x66, 0xee, 0xee,
+    0xee, 0x33, 0x44, 0x44, 0x44, 0x44, 0x33, 0xee,
+    0xee, 0x33, 0x44, 0x44, 0x44, 0x44, 0x33, 0xee,
+    0xee, 0xee, 0x22, 0x33, 0x33, 0x22, 0xee, 0xee,
+    0xee, 0xee, 0x22, 0x33, 0x33, 0x22, 0xee, 0xee,
+    0xee, 0xee, 0x33, 0x44, 0x44, 0x33, 0xee, 0xee,
+    0xee, 0xee, 0x33, 0x44, 0x44, 0x33, 0xee, 0xee,
+    0xee, 0xee, 0x22, 0x44, 0x44, 0x22, 0xee, 0xee,
+    0xee, 0xee, 0x22, 0x44, 0x44, 0x22, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0x22, 0x22, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0x22, 0x22, 0xee, 0xee, 0xee,
+
+    // frame 10/10
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0x66, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0x66, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0x66, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0x66, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0x66, 0x66, 0x66, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0x66, 0x66, 0x66, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0x66, 0x66, 0x66, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0x66, 0x66, 0x66, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0x66, 0x66, 0x66, 0x66, 0xee, 0xee,
+    0xee, 0xee, 0x66, 0x66, 0x66, 0x66, 0xee, 0xee,
+    0xee, 0xee, 0x66, 0x66, 0x66, 0x66, 0xee, 0xee,
+    0xee, 0xee, 0x66, 0x66, 0x66, 0x66, 0xee, 0xee,
+    0xee, 0x33, 0x44, 0x44, 0x44, 0x44, 0x33, 0xee,
+    0xee, 0x33, 0x44, 0x44, 0x44, 0x44, 0x33, 0xee,
+    0xee, 0xee, 0x22, 0x33, 0x33, 0x22, 0xee, 0xee,
+    0xee, 0xee, 0x22, 0x33, 0x33, 0x22, 0xee, 0xee,
+    0xee, 0xee, 0x33, 0x44, 0x44, 0x33, 0xee, 0xee,
+    0xee, 0xee, 0x33, 0x44, 0x44, 0x33, 0xee, 0xee,
+    0xee, 0xee, 0x22, 0x44, 0x44, 0x22, 0xee, 0xee,
+    0xee, 0xee, 0x22, 0x44, 0x44, 0x22, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0x22, 0x22, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0x22, 0x22, 0xee, 0xee, 0xee
+
+};
+
+static_assert(gfx::validIndexed(TORCH_DATA), "TORCH_DATA is not a valid indexed image");
+
+// source: torch-5x2.png (fnv1a 0x4a975f13)
+constexpr uint8_t TORCH_SPANS[] = {
+
+    // 242 spans, 1516 of 5120 pixels opaque
+
+    // frame offsets (lower byte, upper byte)
+
+    0x14, 0x00, 0x68, 0x00, 0xb8, 0x00, 0x08, 0x01, 0x5c, 0x01, 0xac, 0x01, 0xfc, 0x01, 0x4c, 0x02, 0x9c, 0x02, 0xec, 0x02,
+
+    // frame 1/10: span count, then (start, length) of each span
+
+    1, 10, 2,
+    1, 10, 2,
+    0,
+    0,
+    0,
+    0,
+    1, 8, 2,
+    1, 8, 2,
+    0,
+    0,
+    1, 8, 2,
+    1, 8, 2,
+    1, 8, 2,
+    1, 8, 2,
+    1, 6, 4,
+    1, 6, 4,
+    1, 4, 8,
+    1, 4, 8,
+    1, 4, 8,
+    1, 4, 8,
+    1, 4, 8,
+    1, 4, 8,
+    1, 2, 12,
+    1, 2, 12,
+    1, 4, 8,
+    1, 4, 8,
+    1, 4, 8,
+    1, 4, 8,
+    1, 4, 8,
+    1, 4, 8,
+    1, 6, 4,
+    1, 6, 4,
+
+    // frame 2/10: span count, then (start, length) of each span
+
+    0,
+    0,
+    0,
+    0,
+    1, 8, 2,
+    1, 8, 2,
+    0,
+    0,
+    0,
+    0,
+    1, 6, 2,
+    1, 6, 2,
+    1, 4, 4,
+    1, 4, 4,
+    1, 2, 8,
+    1, 2, 8,
+    1, 2, 8,
+    1, 2, 8,
+    1, 4, 8,
+    1, 4, 8,
+    1, 4, 8,
+    1, 4, 8,
+    1, 2, 12,
+    1, 2, 12,
+    1, 4, 8,
+    1, 4, 8,
+    1, 4, 8,
+    1, 4, 8,
+    1, 4, 8,
+    1, 4, 8,
+    1, 6, 4,
+    1, 6, 4,
+
+    // frame 3/10: span count, then (start, length) of each span
+
+    0,
+    0,
+    1, 8, 2,
+    1, 8, 2,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1, 4, 2,
+    1, 4, 2,
+    1, 2, 6,
+    1, 2, 6,
+    1, 4, 6,
+    1, 4, 6,
+    1, 2, 8,
+    1, 2, 8,
+    1, 2, 10,
+    1, 2, 10,
+    1, 4, 8,
+    1, 4, 8,
+    1, 2, 12,
+    1, 2, 12,
+    1, 4, 8,
+    1, 4, 8,
+    1, 4, 8,
+    1, 4, 8,
+    1, 4, 8,
+    1, 4, 8,
+    1, 6, 4,
+    1, 6, 4,
+
+    // frame 4/10: span count, then (start, length) of each span
+
+    1, 8, 2,
+    1, 8, 2,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    2, 2, 2, 6, 2,
+    2, 2, 2, 6, 2,
+    1, 6, 2,
+    1, 6, 2,
+    1, 4, 4,
+    1, 4, 4,
+    1, 4, 6,
+    1, 4, 6,
+    1, 4, 8,
+    1, 4, 8,
+    1, 4, 8,
+    1, 4, 8,
+    1, 2, 12,
+    1, 2, 12,
+    1, 4, 8,
+    1, 4, 8,
+    1, 4, 8,
+    1, 4, 8,
+    1, 4, 8,
+    1, 4, 8,
+    1, 6, 4,
+    1, 6, 4,
+
+    // frame 5/10: span count, then (start, length) of each span
+
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1, 2, 2,
+    1, 2, 2,
+    1, 8, 2,
+    1, 8, 2,
+    1, 8, 2,
+    1, 8, 2,
+    1, 6, 6,
+    1, 6, 6,
+    1, 6, 6,
+    1, 6, 6,
+    1, 4, 8,
+    1, 4, 8,
+    1, 4, 8,
+    1, 4, 8,
+    1, 2, 12,
+    1, 2, 12,
+    1, 4, 8,
+    1, 4, 8,
+    1, 4, 8,
+    1, 4, 8,
+    1, 4, 8,
+    1, 4, 8,
+    1, 6, 4,
+    1, 6, 4,
+
+    // frame 6/10: span count, then (start, length) of each span
+
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1, 2, 2,
+    1, 2, 2,
+    0,
+    0,
+    1, 8, 2,
+    1, 8, 2,
+    1, 8, 4,
+    1, 8, 4,
+    1, 6, 6,
+    1, 6, 6,
+    1, 6, 8,
+    1, 6, 8,
+    1, 4, 10,
+    1, 4, 10,
+    1, 4, 8,
+    1, 4, 8,
+    1, 2, 12,
+    1, 2, 12,
+    1, 4, 8,
+    1, 4, 8,
+    1, 4, 8,
+    1, 4, 8,
+    1, 4, 8,
+    1, 4, 8,
+    1, 6, 4,
+    1, 6, 4,
+
+    // frame 7/10: span count, then (start, length) of each span
+
+    0,
+    0,
+    0,
+    0,
+    1, 2, 2,
+    1, 2, 2,
+    0,
+    0,
+    1, 10, 2,
+    1, 10, 2,
+    0,
+    0,
+    1, 10, 2,
+    1, 10, 2,
+    1, 10, 4,
+    1, 10, 4,
+    1, 8, 6,
+    1, 8, 6,
+    1, 6, 6,
+    1, 6, 6,
+    1, 4, 8,
+    1, 4, 8,
+    1, 2, 12,
+    1, 2, 12,
+    1, 4, 8,
+    1, 4, 8,
+    1, 4, 8,
+    1, 4, 8,
+    1, 4, 8,
+    1, 4, 8,
+    1, 6, 4,
+    1, 6, 4,
+
+    // frame 8/10: span count, then (start, length) of each span
+
+    0,
+    0,
+    1, 2, 2,
+    1, 2, 2,
+    0,
+    0,
+    1, 10, 2,
+    1, 10, 2,
+    0,
+    0,
+    0,
+    0,
+    1, 8, 2,
+    1, 8, 2,
+    1, 6, 6,
+    1, 6, 6,
+    1, 4, 8,
+    1, 4, 8,
+    1, 4, 6,
+    1, 4, 6,
+    1, 4, 8,
+    1, 4, 8,
+    1, 2, 12,
+    1, 2, 12,
+    1, 4, 8,
+    1, 4, 8,
+    1, 4, 8,
+    1, 4, 8,
+    1, 4, 8,
+    1, 4, 8,
+    1, 6, 4,
+    1, 6, 4,
+
+    // frame 9/10: span count, then (start, length) of each span
+
+    1, 2, 2,
+    1, 2, 2,
+    0,
+    0,
+    1, 10, 2,
+    1, 10, 2,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1, 6, 4,
+    1, 6, 4,
+    1, 4, 8,
+    1, 4, 8,
+    1, 6, 6,
+    1, 6, 6,
+    1, 6, 6,
+    1, 6, 6,
+    1, 4, 8,
+    1, 4, 8,
+    1, 2, 12,
+    1, 2, 12,
+    1, 4, 8,
+    1, 4, 8,
+    1, 4, 8,
+    1, 4, 8,
+    1, 4, 8,
+    1, 4, 8,
+    1, 6, 4,
+    1, 6, 4,
+
+    // frame 10/10: span count, then (start, length) of each span
+
+    0,
+    0,
+    1, 10, 2,
+    1, 10, 2,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1, 6, 2,
+    1, 6, 2,
+    1, 4, 6,
+    1, 4, 6,
+    1, 4, 6,
+    1, 4, 6,
+    1, 4, 8,
+    1, 4, 8,
+    1, 4, 8,
+    1, 4, 8,
+    1, 2, 12,
+    1, 2, 12,
+    1, 4, 8,
+    1, 4, 8,
+    1, 4, 8,
+    1, 4, 8,
+    1, 4, 8,
+    1, 4, 8,
+    1, 6, 4,
+    1, 6, 4
+
+};
+
+static_assert(gfx::validSpans(TORCH_SPANS, TORCH_DATA), "TORCH_SPANS does not match the frames of TORCH_DATA");
\ No newline at end of file
@@ -5,12 +5,27 @@
  * ----------------------------------------------------------------------------
  * Assets encoded for 16-indexed colors display mode
  * ----------------------------------------------------------------------------
+ * Generated by tools/asset-compiler from artwork/assets.cfg
+ * ----------------------------------------------------------------------------
  */
 
 #pragma once
 
 #include <Gamebuino-Meta.h>
+#include "../gfx/validate.h"
+
+// arrays of this header, ASSET(NAME) each
+#define INDEXED_ASSETS(ASSET) \
+    ASSET(PALETTE) \
+    ASSET(SPRITE_DATA) \
+    ASSET(SPRITE_FRAMES) \
+    ASSET(SPRITE_SPANS) \
+    ASSET(SPRITE_MIRROR) \
+    ASSET(TILESET_DATA) \
+    ASSET(TORCH_DATA) \
+    ASSET(TORCH_SPANS)
 
+// source: palette-1x16.png (fnv1a 0x7d29c374)
 const Color PALETTE[] = {
 
     (Color) 0x0000, // 0x0
@@ -32,13 +47,16 @@ const Color PALETTE[] = {
 
 };
 
-const uint8_t SPRITE_DATA[] = {
+static_assert(sizeof(PALETTE) / sizeof(*PALETTE) == 16, "PALETTE must give a color to every index");
+
+// source: spritesheet-2x2.png (fnv1a 0x3514b1a0)
+constexpr uint8_t SPRITE_DATA[] = {
 
     // metadata
 
     8,    // frame width
     8,    // frame height
-    0x04, // frames (lower byte)
+    0x03, // frames (lower byte)
     0x00, // frames (upper byte)
     0,    // frame loop
     0xe,  // transparent color
@@ -46,7 +64,7 @@ const uint8_t SPRITE_DATA[] = {
 
     // colormap
 
-    // frame 1/4
+    // frame 1/3
     0xee, 0x45, 0x55, 0xee,
     0xee, 0x67, 0x77, 0xee,
     0xee, 0x60, 0x70, 0xee,
@@ -56,7 +74,7 @@ const uint8_t SPRITE_DATA[] = {
     0xee, 0xcd, 0xdd, 0xee,
     0xee, 0xbe, 0xeb, 0xee,
 
-    // frame 2/4
+    // frame 2/3
     0xee, 0x45, 0x55, 0xee,
     0xee, 0x67, 0x77, 0xee,
     0xee, 0x60, 0x70, 0xee,
@@ -66,17 +84,7 @@ const uint8_t SPRITE_DATA[] = {
     0xee, 0xcd, 0xdd, 0xee,
     0xee, 0xec, 0xbe, 0xee,
 
-    // frame 3/4
-    0xee, 0x45, 0x55, 0xee,
-    0xee, 0x67, 0x77, 0xee,
-    0xee, 0x60, 0x70, 0xee,
-    0xee, 0x67, 0x77, 0xee,
-    0xee, 0xcd, 0xdd, 0xee,
-    0xee, 0x7d, 0xdd, 0x7e,
-    0xee, 0xcd, 0xdd, 0xee,
-    0xee, 0xbe, 0xeb, 0xee,
-
-    // frame 4/4
+    // frame 3/3
     0xee, 0x45, 0x55, 0xee,
     0xee, 0x67, 0x77, 0xee,
     0xee, 0x60, 0x70, 0xee,
@@ -88,7 +96,116 @@ const uint8_t SPRITE_DATA[] = {
 
 };
 
-const uint8_t TILESET_DATA[] = {
+static_assert(gfx::validIndexed(SPRITE_DATA), "SPRITE_DATA is not a valid indexed image");
+
+// source: spritesheet-2x2.png (fnv1a 0xf4edac00)
+constexpr uint8_t SPRITE_FRAMES[] = {
+
+    // 4 frames stored as 3, 32 bytes saved
+
+    0, 1, 0, 2
+
+};
+
+static_assert(gfx::validFrames(SPRITE_FRAMES, SPRITE_DATA), "SPRITE_FRAMES refers to frames missing from SPRITE_DATA");
+
+// source: spritesheet-2x2.png (fnv1a 0x6538ef83)
+constexpr uint8_t SPRITE_SPANS[] = {
+
+    // 26 spans, 94 of 192 pixels opaque
+
+    // frame offsets (lower byte, upper byte)
+
+    0x06, 0x00, 0x20, 0x00, 0x38, 0x00,
+
+    // frame 1/3: span count, then (start, length) of each span
+
+    1, 2, 4,
+    1, 2, 4,
+    1, 2, 4,
+    1, 2, 4,
+    1, 2, 4,
+    1, 2, 5,
+    1, 2, 4,
+    2, 2, 1, 5, 1,
+
+    // frame 2/3: span count, then (start, length) of each span
+
+    1, 2, 4,
+    1, 2, 4,
+    1, 2, 4,
+    1, 2, 4,
+    1, 2, 4,
+    1, 1, 7,
+    1, 2, 4,
+    1, 3, 2,
+
+    // frame 3/3: span count, then (start, length) of each span
+
+    1, 2, 4,
+    1, 2, 4,
+    1, 2, 4,
+    1, 2, 4,
+    1, 2, 4,
+    1, 2, 4,
+    1, 2, 4,
+    2, 1, 1, 6, 1
+
+};
+
+static_assert(gfx::validSpans(SPRITE_SPANS, SPRITE_DATA), "SPRITE_SPANS does not match the frames of SPRITE_DATA");
+
+// source: spritesheet-2x2.png (fnv1a 0x26830615)
+constexpr uint8_t SPRITE_MIRROR[] = {
+
+    // metadata
+
+    8,    // frame width
+    8,    // frame height
+    0x03, // frames (lower byte)
+    0x00, // frames (upper byte)
+    0,    // frame loop
+    0xe,  // transparent color
+    1,    // indexed color mode
+
+    // colormap
+
+    // frame 1/3
+    0xee, 0x55, 0x54, 0xee,
+    0xee, 0x77, 0x76, 0xee,
+    0xee, 0x07, 0x06, 0xee,
+    0xee, 0x77, 0x76, 0xee,
+    0xee, 0xdd, 0xdc, 0xee,
+    0xe7, 0xdd, 0xd7, 0xee,
+    0xee, 0xdd, 0xdc, 0xee,
+    0xee, 0xbe, 0xeb, 0xee,
+
+    // frame 2/3
+    0xee, 0x55, 0x54, 0xee,
+    0xee, 0x77, 0x76, 0xee,
+    0xee, 0x07, 0x06, 0xee,
+    0xee, 0x77, 0x76, 0xee,
+    0xee, 0xdd, 0xdc, 0xee,
+    0x7c, 0xdd, 0xdc, 0x7e,
+    0xee, 0xdd, 0xdc, 0xee,
+    0xee, 0xeb, 0xce, 0xee,
+
+    // frame 3/3
+    0xee, 0x55, 0x54, 0xee,
+    0xee, 0x77, 0x76, 0xee,
+    0xee, 0x07, 0x06, 0xee,
+    0xee, 0x77, 0x76, 0xee,
+    0xee, 0xdd, 0xdc, 0xee,
+    0xee, 0xd7, 0xcc, 0xee,
+    0xee, 0xdd, 0xdc, 0xee,
+    0xec, 0xee, 0xee, 0xbe
+
+};
+
+static_assert(gfx::validIndexed(SPRITE_MIRROR), "SPRITE_MIRROR is not a valid indexed image");
+
+// source: tileset-2x2.png (fnv1a 0x614d124b)
+constexpr uint8_t TILESET_DATA[] = {
 
     // metadata
 
@@ -142,4 +259,408 @@ const uint8_t TILESET_DATA[] = {
     0x21, 0x11, 0x11, 0x01, 0x01, 0x01, 0x01, 0x00,
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01
 
-};
\ No newline at end of file
+};
+
+static_assert(gfx::validIndexed(TILESET_DATA), "TILESET_DATA is not a valid indexed image");
+
+// source: torch-5x2.png (fnv1a 0x603afb07)
+constexpr uint8_t TORCH_DATA[] = {
+
+    // metadata
+
+    8,    // frame width
+    16,   // frame height
+    0x0a, // frames (lower byte)
+    0x00, // frames (upper byte)
+    2,    // frame loop
+    0xe,  // transparent color
+    1,    // indexed color mode
+
+    // colormap
+
+    // frame 1/10
+    0xee, 0xee, 0xe6, 0xee,
+    0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0x6e, 0xee,
+    0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0x6e, 0xee,
+    0xee, 0xee, 0x6e, 0xee,
+    0xee, 0xe6, 0x6e, 0xee,
+    0xee, 0x66, 0x66, 0xee,
+    0xee, 0x66, 0x66, 0xee,
+    0xee, 0x66, 0x66, 0xee,
+    0xe3, 0x44, 0x44, 0x3e,
+    0xee, 0x23, 0x32, 0xee,
+    0xee, 0x34, 0x43, 0xee,
+    0xee, 0x24, 0x42, 0xee,
+    0xee, 0xe2, 0x2e, 0xee,
+
+    // frame 2/10
+    0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0x6e, 0xee,
+    0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee,
+    0xee, 0xe6, 0xee, 0xee,
+    0xee, 0x66, 0xee, 0xee,
+    0xe6, 0x66, 0x6e, 0xee,
+    0xe6, 0x66, 0x6e, 0xee,
+    0xee, 0x66, 0x66, 0xee,
+    0xee, 0x66, 0x66, 0xee,
+    0xe3, 0x44, 0x44, 0x3e,
+    0xee, 0x23, 0x32, 0xee,
+    0xee, 0x34, 0x43, 0xee,
+    0xee, 0x24, 0x42, 0xee,
+    0xee, 0xe2, 0x2e, 0xee,
+
+    // frame 3/10
+    0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0x6e, 0xee,
+    0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee,
+    0xee, 0x6e, 0xee, 0xee,
+    0xe6, 0x66, 0xee, 0xee,
+    0xee, 0x66, 0x6e, 0xee,
+    0xe6, 0x66, 0x6e, 0xee,
+    0xe6, 0x66, 0x66, 0xee,
+    0xee, 0x66, 0x66, 0xee,
+    0xe3, 0x44, 0x44, 0x3e,
+    0xee, 0x23, 0x32, 0xee,
+    0xee, 0x34, 0x43, 0xee,
+    0xee, 0x24, 0x42, 0xee,
+    0xee, 0xe2, 0x2e, 0xee,
+
+    // frame 4/10
+    0xee, 0xee, 0x6e, 0xee,
+    0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee,
+    0xe6, 0xe6, 0xee, 0xee,
+    0xee, 0xe6, 0xee, 0xee,
+    0xee, 0x66, 0xee, 0xee,
+    0xee, 0x66, 0x6e, 0xee,
+    0xee, 0x66, 0x66, 0xee,
+    0xee, 0x66, 0x66, 0xee,
+    0xe3, 0x44, 0x44, 0x3e,
+    0xee, 0x23, 0x32, 0xee,
+    0xee, 0x34, 0x43, 0xee,
+    0xee, 0x24, 0x42, 0xee,
+    0xee, 0xe2, 0x2e, 0xee,
+
+    // frame 5/10
+    0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee,
+    0xe6, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0x6e, 0xee,
+    0xee, 0xee, 0x6e, 0xee,
+    0xee, 0xe6, 0x66, 0xee,
+    0xee, 0xe6, 0x66, 0xee,
+    0xee, 0x66, 0x66, 0xee,
+    0xee, 0x66, 0x66, 0xee,
+    0xe3, 0x44, 0x44, 0x3e,
+    0xee, 0x23, 0x32, 0xee,
+    0xee, 0x34, 0x43, 0xee,
+    0xee, 0x24, 0x42, 0xee,
+    0xee, 0xe2, 0x2e, 0xee,
+
+    // frame 6/10
+    0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee,
+    0xe6, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0x6e, 0xee,
+    0xee, 0xee, 0x66, 0xee,
+    0xee, 0xe6, 0x66, 0xee,
+    0xee, 0xe6, 0x66, 0x6e,
+    0xee, 0x66, 0x66, 0x6e,
+    0xee, 0x66, 0x66, 0xee,
+    0xe3, 0x44, 0x44, 0x3e,
+    0xee, 0x23, 0x32, 0xee,
+    0xee, 0x34, 0x43, 0xee,
+    0xee, 0x24, 0x42, 0xee,
+    0xee, 0xe2, 0x2e, 0xee,
+
+    // frame 7/10
+    0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee,
+    0xe6, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xe6, 0xee,
+    0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xe6, 0xee,
+    0xee, 0xee, 0xe6, 0x6e,
+    0xee, 0xee, 0x66, 0x6e,
+    0xee, 0xe6, 0x66, 0xee,
+    0xee, 0x66, 0x66, 0xee,
+    0xe3, 0x44, 0x44, 0x3e,
+    0xee, 0x23, 0x32, 0xee,
+    0xee, 0x34, 0x43, 0xee,
+    0xee, 0x24, 0x42, 0xee,
+    0xee, 0xe2, 0x2e, 0xee,
+
+    // frame 8/10
+    0xee, 0xee, 0xee, 0xee,
+    0xe6, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xe6, 0xee,
+    0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0x6e, 0xee,
+    0xee, 0xe6, 0x66, 0xee,
+    0xee, 0x66, 0x66, 0xee,
+    0xee, 0x66, 0x6e, 0xee,
+    0xee, 0x66, 0x66, 0xee,
+    0xe3, 0x44, 0x44, 0x3e,
+    0xee, 0x23, 0x32, 0xee,
+    0xee, 0x34, 0x43, 0xee,
+    0xee, 0x24, 0x42, 0xee,
+    0xee, 0xe2, 0x2e, 0xee,
+
+    // frame 9/10
+    0xe6, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xe6, 0xee,
+    0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee,
+    0xee, 0xe6, 0x6e, 0xee,
+    0xee, 0x66, 0x66, 0xee,
+    0xee, 0xe6, 0x66, 0xee,
+    0xee, 0xe6, 0x66, 0xee,
+    0xee, 0x66, 0x66, 0xee,
+    0xe3, 0x44, 0x44, 0x3e,
+    0xee, 0x23, 0x32, 0xee,
+    0xee, 0x34, 0x43, 0xee,
+    0xee, 0x24, 0x42, 0xee,
+    0xee, 0xe2, 0x2e, 0xee,
+
+    // frame 10/10
+    0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xe6, 0xee,
+    0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee,
+    0xee, 0xe6, 0xee, 0xee,
+    0xee, 0x66, 0x6e, 0xee,
+    0xee, 0x66, 0x6e, 0xee,
+    0xee, 0x66, 0x66, 0xee,
+    0xee, 0x66, 0x66, 0xee,
+    0xe3, 0x44, 0x44, 0x3e,
+    0xee, 0x23, 0x32, 0xee,
+    0xee, 0x34, 0x43, 0xee,
+    0xee, 0x24, 0x42, 0xee,
+    0xee, 0xe2, 0x2e, 0xee
+
+};
+
+static_assert(gfx::validIndexed(TORCH_DATA), "TORCH_DATA is not a valid indexed image");
+
+// source: torch-5x2.png (fnv1a 0xaafd15ed)
+constexpr uint8_t TORCH_SPANS[] = {
+
+    // 121 spans, 379 of 1280 pixels opaque
+
+    // frame offsets (lower byte, upper byte)
+
+    0x14, 0x00, 0x3e, 0x00, 0x66, 0x00, 0x8e, 0x00, 0xb8, 0x00, 0xe0, 0x00, 0x08, 0x01, 0x30, 0x01, 0x58, 0x01, 0x80, 0x01,
+
+    // frame 1/10: span count, then (start, length) of each span
+
+    1, 5, 1,
+    0,
+    0,
+    1, 4, 1,
+    0,
+    1, 4, 1,
+    1, 4, 1,
+    1, 3, 2,
+    1, 2, 4,
+    1, 2, 4,
+    1, 2, 4,
+    1, 1, 6,
+    1, 2, 4,
+    1, 2, 4,
+    1, 2, 4,
+    1, 3, 2,
+
+    // frame 2/10: span count, then (start, length) of each span
+
+    0,
+    0,
+    1, 4, 1,
+    0,
+    0,
+    1, 3, 1,
+    1, 2, 2,
+    1, 1, 4,
+    1, 1, 4,
+    1, 2, 4,
+    1, 2, 4,
+    1, 1, 6,
+    1, 2, 4,
+    1, 2, 4,
+    1, 2, 4,
+    1, 3, 2,
+
+    // frame 3/10: span count, then (start, length) of each span
+
+    0,
+    1, 4, 1,
+    0,
+    0,
+    0,
+    1, 2, 1,
+    1, 1, 3,
+    1, 2, 3,
+    1, 1, 4,
+    1, 1, 5,
+    1, 2, 4,
+    1, 1, 6,
+    1, 2, 4,
+    1, 2, 4,
+    1, 2, 4,
+    1, 3, 2,
+
+    // frame 4/10: span count, then (start, length) of each span
+
+    1, 4, 1,
+    0,
+    0,
+    0,
+    0,
+    2, 1, 1, 3, 1,
+    1, 3, 1,
+    1, 2, 2,
+    1, 2, 3,
+    1, 2, 4,
+    1, 2, 4,
+    1, 1, 6,
+    1, 2, 4,
+    1, 2, 4,
+    1, 2, 4,
+    1, 3, 2,
+
+    // frame 5/10: span count, then (start, length) of each span
+
+    0,
+    0,
+    0,
+    0,
+    1, 1, 1,
+    1, 4, 1,
+    1, 4, 1,
+    1, 3, 3,
+    1, 3, 3,
+    1, 2, 4,
+    1, 2, 4,
+    1, 1, 6,
+    1, 2, 4,
+    1, 2, 4,
+    1, 2, 4,
+    1, 3, 2,
+
+    // frame 6/10: span count, then (start, length) of each span
+
+    0,
+    0,
+    0,
+    1, 1, 1,
+    0,
+    1, 4, 1,
+    1, 4, 2,
+    1, 3, 3,
+    1, 3, 4,
+    1, 2, 5,
+    1, 2, 4,
+    1, 1, 6,
+    1, 2, 4,
+    1, 2, 4,
+    1, 2, 4,
+    1, 3, 2,
+
+    // frame 7/10: span count, then (start, length) of each span
+
+    0,
+    0,
+    1, 1, 1,
+    0,
+    1, 5, 1,
+    0,
+    1, 5, 1,
+    1, 5, 2,
+    1, 4, 3,
+    1, 3, 3,
+    1, 2, 4,
+    1, 1, 6,
+    1, 2, 4,
+    1, 2, 4,
+    1, 2, 4,
+    1, 3, 2,
+
+    // frame 8/10: span count, then (start, length) of each span
+
+    0,
+    1, 1, 1,
+    0,
+    1, 5, 1,
+    0,
+    0,
+    1, 4, 1,
+    1, 3, 3,
+    1, 2, 4,
+    1, 2, 3,
+    1, 2, 4,
+    1, 1, 6,
+    1, 2, 4,
+    1, 2, 4,
+    1, 2, 4,
+    1, 3, 2,
+
+    // frame 9/10: span count, then (start, length) of each span
+
+    1, 1, 1,
+    0,
+    1, 5, 1,
+    0,
+    0,
+    0,
+    1, 3, 2,
+    1, 2, 4,
+    1, 3, 3,
+    1, 3, 3,
+    1, 2, 4,
+    1, 1, 6,
+    1, 2, 4,
+    1, 2, 4,
+    1, 2, 4,
+    1, 3, 2,
+
+    // frame 10/10: span count, then (start, length) of each span
+
+    0,
+    1, 5, 1,
+    0,
+    0,
+    0,
+    0,
+    1, 3, 1,
+    1, 2, 3,
+    1, 2, 3,
+    1, 2, 4,
+    1, 2, 4,
+    1, 1, 6,
+    1, 2, 4,
+    1, 2, 4,
+    1, 2, 4,
+    1, 3, 2
+
+};
+
+static_assert(gfx::validSpans(TORCH_SPANS, TORCH_DATA), "TORCH_SPANS does not match the frames of TORCH_DATA");
\ No newline at end of file
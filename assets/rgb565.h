@@ -5,24 +5,39 @@
  * ----------------------------------------------------------------------------
  * Assets encoded for full 16-bits RGB565 display mode
  * ----------------------------------------------------------------------------
+ * Generated by tools/asset-compiler from artwork/assets.cfg
+ * ----------------------------------------------------------------------------
  */
 
 #pragma once
 
-const uint16_t SPRITE_DATA[] = {
+#include "../gfx/validate.h"
+
+// arrays of this header, ASSET(NAME) each
+#define RGB565_ASSETS(ASSET) \
+    ASSET(SPRITE_DATA) \
+    ASSET(SPRITE_FRAMES) \
+    ASSET(SPRITE_SPANS) \
+    ASSET(SPRITE_MIRROR) \
+    ASSET(TILESET_DATA) \
+    ASSET(TORCH_DATA) \
+    ASSET(TORCH_SPANS)
+
+// source: spritesheet-2x2.png (fnv1a 0xd58f0c87)
+constexpr uint16_t SPRITE_DATA[] = {
 
     // metadata
 
     8,      // frame width
     8,      // frame height
-    4,      // frames
+    3,      // frames
     0,      // frame loop
     0xf81f, // transparent color
     0,      // 16-bits color mode
 
     // colormap
 
-    // frame 1/4
+    // frame 1/3
     0xf81f, 0xf81f, 0x632c, 0xad55, 0xad55, 0xad55, 0xf81f, 0xf81f,
     0xf81f, 0xf81f, 0xee2f, 0xff36, 0xff36, 0xff36, 0xf81f, 0xf81f,
     0xf81f, 0xf81f, 0xee2f, 0x0000, 0xff36, 0x0000, 0xf81f, 0xf81f,
@@ -32,7 +47,7 @@ const uint16_t SPRITE_DATA[] = {
     0xf81f, 0xf81f, 0x7afa, 0xb4df, 0xb4df, 0xb4df, 0xf81f, 0xf81f,
     0xf81f, 0xf81f, 0x6217, 0xf81f, 0xf81f, 0x6217, 0xf81f, 0xf81f,
 
-    // frame 2/4
+    // frame 2/3
     0xf81f, 0xf81f, 0x632c, 0xad55, 0xad55, 0xad55, 0xf81f, 0xf81f,
     0xf81f, 0xf81f, 0xee2f, 0xff36, 0xff36, 0xff36, 0xf81f, 0xf81f,
     0xf81f, 0xf81f, 0xee2f, 0x0000, 0xff36, 0x0000, 0xf81f, 0xf81f,
@@ -42,17 +57,7 @@ const uint16_t SPRITE_DATA[] = {
     0xf81f, 0xf81f, 0x7afa, 0xb4df, 0xb4df, 0xb4df, 0xf81f, 0xf81f,
     0xf81f, 0xf81f, 0xf81f, 0x7afa, 0x6217, 0xf81f, 0xf81f, 0xf81f,
 
-    // frame 3/4
-    0xf81f, 0xf81f, 0x632c, 0xad55, 0xad55, 0xad55, 0xf81f, 0xf81f,
-    0xf81f, 0xf81f, 0xee2f, 0xff36, 0xff36, 0xff36, 0xf81f, 0xf81f,
-    0xf81f, 0xf81f, 0xee2f, 0x0000, 0xff36, 0x0000, 0xf81f, 0xf81f,
-    0xf81f, 0xf81f, 0xee2f, 0xff36, 0xff36, 0xff36, 0xf81f, 0xf81f,
-    0xf81f, 0xf81f, 0x7afa, 0xb4df, 0xb4df, 0xb4df, 0xf81f, 0xf81f,
-    0xf81f, 0xf81f, 0xff36, 0xb4df, 0xb4df, 0xb4df, 0xff36, 0xf81f,
-    0xf81f, 0xf81f, 0x7afa, 0xb4df, 0xb4df, 0xb4df, 0xf81f, 0xf81f,
-    0xf81f, 0xf81f, 0x6217, 0xf81f, 0xf81f, 0x6217, 0xf81f, 0xf81f,
-
-    // frame 4/4
+    // frame 3/3
     0xf81f, 0xf81f, 0x632c, 0xad55, 0xad55, 0xad55, 0xf81f, 0xf81f,
     0xf81f, 0xf81f, 0xee2f, 0xff36, 0xff36, 0xff36, 0xf81f, 0xf81f,
     0xf81f, 0xf81f, 0xee2f, 0x0000, 0xff36, 0x0000, 0xf81f, 0xf81f,
@@ -64,7 +69,115 @@ const uint16_t SPRITE_DATA[] = {
 
 };
 
-const uint16_t TILESET_DATA[] = {
+static_assert(gfx::validRgb565(SPRITE_DATA), "SPRITE_DATA is not a valid RGB565 image");
+
+// source: spritesheet-2x2.png (fnv1a 0x891c4781)
+constexpr uint8_t SPRITE_FRAMES[] = {
+
+    // 4 frames stored as 3, 128 bytes saved
+
+    0, 1, 0, 2
+
+};
+
+static_assert(gfx::validFrames(SPRITE_FRAMES, SPRITE_DATA), "SPRITE_FRAMES refers to frames missing from SPRITE_DATA");
+
+// source: spritesheet-2x2.png (fnv1a 0x1f81647c)
+constexpr uint8_t SPRITE_SPANS[] = {
+
+    // 26 spans, 94 of 192 pixels opaque
+
+    // frame offsets (lower byte, upper byte)
+
+    0x06, 0x00, 0x20, 0x00, 0x38, 0x00,
+
+    // frame 1/3: span count, then (start, length) of each span
+
+    1, 2, 4,
+    1, 2, 4,
+    1, 2, 4,
+    1, 2, 4,
+    1, 2, 4,
+    1, 2, 5,
+    1, 2, 4,
+    2, 2, 1, 5, 1,
+
+    // frame 2/3: span count, then (start, length) of each span
+
+    1, 2, 4,
+    1, 2, 4,
+    1, 2, 4,
+    1, 2, 4,
+    1, 2, 4,
+    1, 1, 7,
+    1, 2, 4,
+    1, 3, 2,
+
+    // frame 3/3: span count, then (start, length) of each span
+
+    1, 2, 4,
+    1, 2, 4,
+    1, 2, 4,
+    1, 2, 4,
+    1, 2, 4,
+    1, 2, 4,
+    1, 2, 4,
+    2, 1, 1, 6, 1
+
+};
+
+static_assert(gfx::validSpans(SPRITE_SPANS, SPRITE_DATA), "SPRITE_SPANS does not match the frames of SPRITE_DATA");
+
+// source: spritesheet-2x2.png (fnv1a 0xd7678fd0)
+constexpr uint16_t SPRITE_MIRROR[] = {
+
+    // metadata
+
+    8,      // frame width
+    8,      // frame height
+    3,      // frames
+    0,      // frame loop
+    0xf81f, // transparent color
+    0,      // 16-bits color mode
+
+    // colormap
+
+    // frame 1/3
+    0xf81f, 0xf81f, 0xad55, 0xad55, 0xad55, 0x632c, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0xff36, 0xff36, 0xff36, 0xee2f, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0x0000, 0xff36, 0x0000, 0xee2f, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0xff36, 0xff36, 0xff36, 0xee2f, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0xb4df, 0xb4df, 0xb4df, 0x7afa, 0xf81f, 0xf81f,
+    0xf81f, 0xff36, 0xb4df, 0xb4df, 0xb4df, 0xff36, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0xb4df, 0xb4df, 0xb4df, 0x7afa, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0x6217, 0xf81f, 0xf81f, 0x6217, 0xf81f, 0xf81f,
+
+    // frame 2/3
+    0xf81f, 0xf81f, 0xad55, 0xad55, 0xad55, 0x632c, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0xff36, 0xff36, 0xff36, 0xee2f, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0x0000, 0xff36, 0x0000, 0xee2f, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0xff36, 0xff36, 0xff36, 0xee2f, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0xb4df, 0xb4df, 0xb4df, 0x7afa, 0xf81f, 0xf81f,
+    0xff36, 0x7afa, 0xb4df, 0xb4df, 0xb4df, 0x7afa, 0xff36, 0xf81f,
+    0xf81f, 0xf81f, 0xb4df, 0xb4df, 0xb4df, 0x7afa, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0xf81f, 0x6217, 0x7afa, 0xf81f, 0xf81f, 0xf81f,
+
+    // frame 3/3
+    0xf81f, 0xf81f, 0xad55, 0xad55, 0xad55, 0x632c, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0xff36, 0xff36, 0xff36, 0xee2f, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0x0000, 0xff36, 0x0000, 0xee2f, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0xff36, 0xff36, 0xff36, 0xee2f, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0xb4df, 0xb4df, 0xb4df, 0x7afa, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0xb4df, 0xff36, 0x7afa, 0x7afa, 0xf81f, 0xf81f,
+    0xf81f, 0xf81f, 0xb4df, 0xb4df, 0xb4df, 0x7afa, 0xf81f, 0xf81f,
+    0xf81f, 0x7afa, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0x6217, 0xf81f
+
+};
+
+static_assert(gfx::validRgb565(SPRITE_MIRROR), "SPRITE_MIRROR is not a valid RGB565 image");
+
+// source: tileset-2x2.png (fnv1a 0x16ffc776)
+constexpr uint16_t TILESET_DATA[] = {
 
     // metadata
 
@@ -119,7 +232,10 @@ const uint16_t TILESET_DATA[] = {
 
 };
 
-const uint16_t TORCH_DATA[] = {
+static_assert(gfx::validRgb565(TILESET_DATA), "TILESET_DATA is not a valid RGB565 image");
+
+// source: torch-5x2.png (fnv1a 0x2b65a496)
+constexpr uint16_t TORCH_DATA[] = {
 
     // metadata
 
@@ -312,4 +428,209 @@ const uint16_t TORCH_DATA[] = {
     0xf81f, 0xf81f, 0x49c4, 0x8b27, 0x8b27, 0x49c4, 0xf81f, 0xf81f,
     0xf81f, 0xf81f, 0xf81f, 0x49c4, 0x49c4, 0xf81f, 0xf81f, 0xf81f
 
-};
\ No newline at end of file
+};
+
+static_assert(gfx::validRgb565(TORCH_DATA), "TORCH_DATA is not a valid RGB565 image");
+
+// source: torch-5x2.png (fnv1a 0x3f158f5e)
+constexpr uint8_t TORCH_SPANS[] = {
+
+    // 121 spans, 379 of 1280 pixels opaque
+
+    // frame offsets (lower byte, upper byte)
+
+    0x14, 0x00, 0x3e, 0x00, 0x66, 0x00, 0x8e, 0x00, 0xb8, 0x00, 0xe0, 0x00, 0x08, 0x01, 0x30, 0x01, 0x58, 0x01, 0x80, 0x01,
+
+    // frame 1/10: span count, then (start, length) of each span
+
+    1, 5, 1,
+    0,
+    0,
+    1, 4, 1,
+    0,
+    1, 4, 1,
+    1, 4, 1,
+    1, 3, 2,
+    1, 2, 4,
+    1, 2, 4,
+    1, 2, 4,
+    1, 1, 6,
+    1, 2, 4,
+    1, 2, 4,
+    1, 2, 4,
+    1, 3, 2,
+
+    // frame 2/10: span count, then (start, length) of each span
+
+    0,
+    0,
+    1, 4, 1,
+    0,
+    0,
+    1, 3, 1,
+    1, 2, 2,
+    1, 1, 4,
+    1, 1, 4,
+    1, 2, 4,
+    1, 2, 4,
+    1, 1, 6,
+    1, 2, 4,
+    1, 2, 4,
+    1, 2, 4,
+    1, 3, 2,
+
+    // frame 3/10: span count, then (start, length) of each span
+
+    0,
+    1, 4, 1,
+    0,
+    0,
+    0,
+    1, 2, 1,
+    1, 1, 3,
+    1, 2, 3,
+    1, 1, 4,
+    1, 1, 5,
+    1, 2, 4,
+    1, 1, 6,
+    1, 2, 4,
+    1, 2, 4,
+    1, 2, 4,
+    1, 3, 2,
+
+    // frame 4/10: span count, then (start, length) of each span
+
+    1, 4, 1,
+    0,
+    0,
+    0,
+    0,
+    2, 1, 1, 3, 1,
+    1, 3, 1,
+    1, 2, 2,
+    1, 2, 3,
+    1, 2, 4,
+    1, 2, 4,
+    1, 1, 6,
+    1, 2, 4,
+    1, 2, 4,
+    1, 2, 4,
+    1, 3, 2,
+
+    // frame 5/10: span count, then (start, length) of each span
+
+    0,
+    0,
+    0,
+    0,
+    1, 1, 1,
+    1, 4, 1,
+    1, 4, 1,
+    1, 3, 3,
+    1, 3, 3,
+    1, 2, 4,
+    1, 2, 4,
+    1, 1, 6,
+    1, 2, 4,
+    1, 2, 4,
+    1, 2, 4,
+    1, 3, 2,
+
+    // frame 6/10: span count, then (start, length) of each span
+
+    0,
+    0,
+    0,
+    1, 1, 1,
+    0,
+    1, 4, 1,
+    1, 4, 2,
+    1, 3, 3,
+    1, 3, 4,
+    1, 2, 5,
+    1, 2, 4,
+    1, 1, 6,
+    1, 2, 4,
+    1, 2, 4,
+    1, 2, 4,
+    1, 3, 2,
+
+    // frame 7/10: span count, then (start, length) of each span
+
+    0,
+    0,
+    1, 1, 1,
+    0,
+    1, 5, 1,
+    0,
+    1, 5, 1,
+    1, 5, 2,
+    1, 4, 3,
+    1, 3, 3,
+    1, 2, 4,
+    1, 1, 6,
+    1, 2, 4,
+    1, 2, 4,
+    1, 2, 4,
+    1, 3, 2,
+
+    // frame 8/10: span count, then (start, length) of each span
+
+    0,
+    1, 1, 1,
+    0,
+    1, 5, 1,
+    0,
+    0,
+    1, 4, 1,
+    1, 3, 3,
+    1, 2, 4,
+    1, 2, 3,
+    1, 2, 4,
+    1, 1, 6,
+    1, 2, 4,
+    1, 2, 4,
+    1, 2, 4,
+    1, 3, 2,
+
+    // frame 9/10: span count, then (start, length) of each span
+
+    1, 1, 1,
+    0,
+    1, 5, 1,
+    0,
+    0,
+    0,
+    1, 3, 2,
+    1, 2, 4,
+    1, 3, 3,
+    1, 3, 3,
+    1, 2, 4,
+    1, 1, 6,
+    1, 2, 4,
+    1, 2, 4,
+    1, 2, 4,
+    1, 3, 2,
+
+    // frame 10/10: span count, then (start, length) of each span
+
+    0,
+    1, 5, 1,
+    0,
+    0,
+    0,
+    0,
+    1, 3, 1,
+    1, 2, 3,
+    1, 2, 3,
+    1, 2, 4,
+    1, 2, 4,
+    1, 1, 6,
+    1, 2, 4,
+    1, 2, 4,
+    1, 2, 4,
+    1, 3, 2
+
+};
+
+static_assert(gfx::validSpans(TORCH_SPANS, TORCH_DATA), "TORCH_SPANS does not match the frames of TORCH_DATA");
\ No newline at end of file
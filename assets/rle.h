@@ -0,0 +1,330 @@
+/**
+ * ----------------------------------------------------------------------------
+ * Handling images on the Gamebuino META
+ * © 2021 Stéphane Calderoni
+ * ----------------------------------------------------------------------------
+ * Assets run-length encoded for full 16-bits RGB565 display mode
+ * ----------------------------------------------------------------------------
+ * Generated by tools/asset-compiler from artwork/assets.cfg
+ * ----------------------------------------------------------------------------
+ */
+
+#pragma once
+
+#include "../gfx/validate.h"
+
+// arrays of this header, ASSET(NAME) each
+#define RLE_ASSETS(ASSET) \
+    ASSET(SPRITE_RLE) \
+    ASSET(TILESET_RLE) \
+    ASSET(TORCH_RLE)
+
+// source: spritesheet-2x2.png (fnv1a 0xd58f0c87)
+constexpr uint16_t SPRITE_RLE[] = {
+
+    // metadata
+
+    8,      // frame width
+    8,      // frame height
+    4,      // frames
+    0,      // frame loop
+    0xf81f, // transparent color
+    2,      // run-length encoded 16-bits color mode
+
+    // frame offsets
+
+    10, 62, 10, 113,
+
+    // frame 1/4
+    0x0002, 0x8001, 0x632c, 0x4003, 0xad55, 0x0002,
+    0x0002, 0x8001, 0xee2f, 0x4003, 0xff36, 0x0002,
+    0x0002, 0x8004, 0xee2f, 0x0000, 0xff36, 0x0000, 0x0002,
+    0x0002, 0x8001, 0xee2f, 0x4003, 0xff36, 0x0002,
+    0x0002, 0x8001, 0x7afa, 0x4003, 0xb4df, 0x0002,
+    0x0002, 0x8001, 0xff36, 0x4003, 0xb4df, 0x8001, 0xff36, 0x0001,
+    0x0002, 0x8001, 0x7afa, 0x4003, 0xb4df, 0x0002,
+    0x0002, 0x8001, 0x6217, 0x0002, 0x8001, 0x6217, 0x0002,
+
+    // frame 2/4
+    0x0002, 0x8001, 0x632c, 0x4003, 0xad55, 0x0002,
+    0x0002, 0x8001, 0xee2f, 0x4003, 0xff36, 0x0002,
+    0x0002, 0x8004, 0xee2f, 0x0000, 0xff36, 0x0000, 0x0002,
+    0x0002, 0x8001, 0xee2f, 0x4003, 0xff36, 0x0002,
+    0x0002, 0x8001, 0x7afa, 0x4003, 0xb4df, 0x0002,
+    0x0001, 0x8002, 0xff36, 0x7afa, 0x4003, 0xb4df, 0x8002, 0x7afa, 0xff36,
+    0x0002, 0x8001, 0x7afa, 0x4003, 0xb4df, 0x0002,
+    0x0003, 0x8002, 0x7afa, 0x6217, 0x0003,
+
+    // frame 4/4
+    0x0002, 0x8001, 0x632c, 0x4003, 0xad55, 0x0002,
+    0x0002, 0x8001, 0xee2f, 0x4003, 0xff36, 0x0002,
+    0x0002, 0x8004, 0xee2f, 0x0000, 0xff36, 0x0000, 0x0002,
+    0x0002, 0x8001, 0xee2f, 0x4003, 0xff36, 0x0002,
+    0x0002, 0x8001, 0x7afa, 0x4003, 0xb4df, 0x0002,
+    0x0002, 0x8004, 0x7afa, 0x7afa, 0xff36, 0xb4df, 0x0002,
+    0x0002, 0x8001, 0x7afa, 0x4003, 0xb4df, 0x0002,
+    0x0001, 0x8001, 0x6217, 0x0004, 0x8001, 0x7afa, 0x0001
+
+};
+
+static_assert(gfx::validRle(SPRITE_RLE), "SPRITE_RLE is not a valid run-length encoded image");
+
+// source: tileset-2x2.png (fnv1a 0x16ffc776)
+constexpr uint16_t TILESET_RLE[] = {
+
+    // metadata
+
+    16,     // frame width
+    8,      // frame height
+    4,      // frames
+    0,      // frame loop
+    0xf81f, // transparent color
+    2,      // run-length encoded 16-bits color mode
+
+    // frame offsets
+
+    10, 81, 165, 238,
+
+    // frame 1/4
+    0x400f, 0x1926, 0x8001, 0x0000,
+    0x800a, 0x1926, 0x1926, 0x10e4, 0x1926, 0x10e4, 0x1926, 0x10e4, 0x1926, 0x10e4, 0x1926, 0x4005, 0x10e4, 0x8001, 0x0862,
+    0x8007, 0x1926, 0x10e4, 0x1926, 0x10e4, 0x1926, 0x10e4, 0x1926, 0x4008, 0x10e4, 0x8001, 0x0862,
+    0x8004, 0x1926, 0x1926, 0x10e4, 0x1926, 0x400b, 0x10e4, 0x8001, 0x0862,
+    0x8003, 0x1926, 0x10e4, 0x1926, 0x400c, 0x10e4, 0x8001, 0x0862,
+    0x8002, 0x1926, 0x1926, 0x400d, 0x10e4, 0x8001, 0x0862,
+    0x8003, 0x1926, 0x10e4, 0x1926, 0x400b, 0x10e4, 0x8002, 0x0862, 0x0862,
+    0x8002, 0x1926, 0x1926, 0x400d, 0x10e4, 0x8001, 0x0862,
+
+    // frame 2/4
+    0x8001, 0x4228, 0x400f, 0x632c,
+    0x8001, 0xad55, 0x400f, 0x4228,
+    0x8001, 0x632c, 0x400f, 0x4228,
+    0x8001, 0x0000, 0x400f, 0x3186,
+    0x8010, 0x18c3, 0x0000, 0x18c3, 0x0000, 0x18c3, 0x0000, 0x18c3, 0x0000, 0x18c3, 0x0000, 0x18c3, 0x0000, 0x18c3, 0x0000, 0x18c3, 0x0000,
+    0x8010, 0x0000, 0x18c3, 0x0000, 0x3186, 0x0000, 0x18c3, 0x0000, 0x3186, 0x0000, 0x18c3, 0x0000, 0x3186, 0x0000, 0x18c3, 0x0000, 0x3186,
+    0x8010, 0x3186, 0x0000, 0x3186, 0x0000, 0x3186, 0x0000, 0x3186, 0x0000, 0x3186, 0x0000, 0x3186, 0x0000, 0x3186, 0x0000, 0x3186, 0x0000,
+    0x8010, 0x0000, 0x18c3, 0x0000, 0x18c3, 0x0000, 0x18c3, 0x0000, 0x18c3, 0x0000, 0x18c3, 0x0000, 0x18c3, 0x0000, 0x18c3, 0x0000, 0x18c3,
+
+    // frame 3/4
+    0x8001, 0x1926, 0x400d, 0x10e4, 0x8002, 0x0862, 0x0862,
+    0x8002, 0x1926, 0x1926, 0x400b, 0x10e4, 0x8003, 0x0862, 0x10e4, 0x0862,
+    0x8001, 0x1926, 0x400d, 0x10e4, 0x8002, 0x0862, 0x0862,
+    0x8001, 0x1926, 0x400c, 0x10e4, 0x8003, 0x0862, 0x10e4, 0x0862,
+    0x8001, 0x1926, 0x400b, 0x10e4, 0x8004, 0x0862, 0x10e4, 0x0862, 0x0862,
+    0x8001, 0x1926, 0x4008, 0x10e4, 0x8007, 0x0862, 0x10e4, 0x0862, 0x10e4, 0x0862, 0x10e4, 0x0862,
+    0x8001, 0x1926, 0x4005, 0x10e4, 0x800a, 0x0862, 0x10e4, 0x0862, 0x10e4, 0x0862, 0x10e4, 0x0862, 0x10e4, 0x0862, 0x0862,
+    0x8001, 0x0000, 0x400e, 0x0862, 0x8001, 0x0000,
+
+    // frame 4/4
+    0x8002, 0x0000, 0x632c, 0x400d, 0x3186, 0x8001, 0x18c3,
+    0x8008, 0x632c, 0x3186, 0x18c3, 0x3186, 0x18c3, 0x3186, 0x18c3, 0x3186, 0x4007, 0x18c3, 0x8001, 0x0000,
+    0x8003, 0x3186, 0x18c3, 0x3186, 0x400c, 0x18c3, 0x8001, 0x0000,
+    0x8002, 0x3186, 0x3186, 0x400d, 0x18c3, 0x8001, 0x0000,
+    0x8001, 0x3186, 0x400d, 0x18c3, 0x8002, 0x0000, 0x0000,
+    0x8001, 0x3186, 0x400a, 0x18c3, 0x8005, 0x0000, 0x18c3, 0x0000, 0x18c3, 0x0000,
+    0x8001, 0x3186, 0x4005, 0x18c3, 0x800a, 0x0000, 0x18c3, 0x0000, 0x18c3, 0x0000, 0x18c3, 0x0000, 0x18c3, 0x0000, 0x0000,
+    0x400f, 0x0000, 0x8001, 0x18c3
+
+};
+
+static_assert(gfx::validRle(TILESET_RLE), "TILESET_RLE is not a valid run-length encoded image");
+
+// source: torch-5x2.png (fnv1a 0x2b65a496)
+constexpr uint16_t TORCH_RLE[] = {
+
+    // metadata
+
+    8,      // frame width
+    16,     // frame height
+    10,     // frames
+    2,      // frame loop
+    0xf81f, // transparent color
+    2,      // run-length encoded 16-bits color mode
+
+    // frame offsets
+
+    16, 95, 174, 252, 330, 406, 485, 559, 635, 712,
+
+    // frame 1/10
+    0x0005, 0x8001, 0xfb20, 0x0002,
+    0x0008,
+    0x0008,
+    0x0004, 0x8001, 0xfb20, 0x0003,
+    0x0008,
+    0x0004, 0x8001, 0xfb20, 0x0003,
+    0x0004, 0x8001, 0xfb20, 0x0003,
+    0x0003, 0x8002, 0xfb20, 0xfb20, 0x0003,
+    0x0002, 0x8004, 0xfb20, 0xfd40, 0xfd40, 0xfb20, 0x0002,
+    0x0002, 0x8004, 0xfb20, 0xfd40, 0xfd40, 0xfb20, 0x0002,
+    0x0002, 0x8004, 0xfb20, 0xfee4, 0xfee4, 0xfb20, 0x0002,
+    0x0001, 0x8001, 0x6a86, 0x4004, 0x8b27, 0x8001, 0x6a86, 0x0001,
+    0x0002, 0x8004, 0x49c4, 0x6a86, 0x6a86, 0x49c4, 0x0002,
+    0x0002, 0x8004, 0x6a86, 0x8b27, 0x8b27, 0x6a86, 0x0002,
+    0x0002, 0x8004, 0x49c4, 0x8b27, 0x8b27, 0x49c4, 0x0002,
+    0x0003, 0x8002, 0x49c4, 0x49c4, 0x0003,
+
+    // frame 2/10
+    0x0008,
+    0x0008,
+    0x0004, 0x8001, 0xfb20, 0x0003,
+    0x0008,
+    0x0008,
+    0x0003, 0x8001, 0xfb20, 0x0004,
+    0x0002, 0x8002, 0xfb20, 0xfb20, 0x0004,
+    0x0001, 0x8004, 0xfb20, 0xfd40, 0xfd40, 0xfb20, 0x0003,
+    0x0001, 0x8004, 0xfb20, 0xfd40, 0xfd40, 0xfb20, 0x0003,
+    0x0002, 0x8004, 0xfb20, 0xfee4, 0xfd40, 0xfb20, 0x0002,
+    0x0002, 0x8004, 0xfb20, 0xfee4, 0xfee4, 0xfb20, 0x0002,
+    0x0001, 0x8001, 0x6a86, 0x4004, 0x8b27, 0x8001, 0x6a86, 0x0001,
+    0x0002, 0x8004, 0x49c4, 0x6a86, 0x6a86, 0x49c4, 0x0002,
+    0x0002, 0x8004, 0x6a86, 0x8b27, 0x8b27, 0x6a86, 0x0002,
+    0x0002, 0x8004, 0x49c4, 0x8b27, 0x8b27, 0x49c4, 0x0002,
+    0x0003, 0x8002, 0x49c4, 0x49c4, 0x0003,
+
+    // frame 3/10
+    0x0008,
+    0x0004, 0x8001, 0xfb20, 0x0003,
+    0x0008,
+    0x0008,
+    0x0008,
+    0x0002, 0x8001, 0xfb20, 0x0005,
+    0x0001, 0x4003, 0xfb20, 0x0004,
+    0x0002, 0x8003, 0xfb20, 0xfd40, 0xfb20, 0x0003,
+    0x0001, 0x8004, 0xfb20, 0xfd40, 0xfd40, 0xfb20, 0x0003,
+    0x0001, 0x8005, 0xfb20, 0xfd40, 0xfee4, 0xfd40, 0xfb20, 0x0002,
+    0x0002, 0x8004, 0xfb20, 0xfee4, 0xfee4, 0xfb20, 0x0002,
+    0x0001, 0x8001, 0x6a86, 0x4004, 0x8b27, 0x8001, 0x6a86, 0x0001,
+    0x0002, 0x8004, 0x49c4, 0x6a86, 0x6a86, 0x49c4, 0x0002,
+    0x0002, 0x8004, 0x6a86, 0x8b27, 0x8b27, 0x6a86, 0x0002,
+    0x0002, 0x8004, 0x49c4, 0x8b27, 0x8b27, 0x49c4, 0x0002,
+    0x0003, 0x8002, 0x49c4, 0x49c4, 0x0003,
+
+    // frame 4/10
+    0x0004, 0x8001, 0xfb20, 0x0003,
+    0x0008,
+    0x0008,
+    0x0008,
+    0x0008,
+    0x0001, 0x8001, 0xfb20, 0x0001, 0x8001, 0xfb20, 0x0004,
+    0x0003, 0x8001, 0xfb20, 0x0004,
+    0x0002, 0x8002, 0xfb20, 0xfb20, 0x0004,
+    0x0002, 0x8003, 0xfb20, 0xfd40, 0xfb20, 0x0003,
+    0x0002, 0x8004, 0xfb20, 0xfd40, 0xfd40, 0xfb20, 0x0002,
+    0x0002, 0x8004, 0xfb20, 0xfee4, 0xfee4, 0xfb20, 0x0002,
+    0x0001, 0x8001, 0x6a86, 0x4004, 0x8b27, 0x8001, 0x6a86, 0x0001,
+    0x0002, 0x8004, 0x49c4, 0x6a86, 0x6a86, 0x49c4, 0x0002,
+    0x0002, 0x8004, 0x6a86, 0x8b27, 0x8b27, 0x6a86, 0x0002,
+    0x0002, 0x8004, 0x49c4, 0x8b27, 0x8b27, 0x49c4, 0x0002,
+    0x0003, 0x8002, 0x49c4, 0x49c4, 0x0003,
+
+    // frame 5/10
+    0x0008,
+    0x0008,
+    0x0008,
+    0x0008,
+    0x0001, 0x8001, 0xfb20, 0x0006,
+    0x0004, 0x8001, 0xfb20, 0x0003,
+    0x0004, 0x8001, 0xfb20, 0x0003,
+    0x0003, 0x8003, 0xfb20, 0xfd40, 0xfb20, 0x0002,
+    0x0003, 0x8003, 0xfb20, 0xfd40, 0xfb20, 0x0002,
+    0x0002, 0x8004, 0xfb20, 0xfd40, 0xfd40, 0xfb20, 0x0002,
+    0x0002, 0x8004, 0xfb20, 0xfee4, 0xfee4, 0xfb20, 0x0002,
+    0x0001, 0x8001, 0x6a86, 0x4004, 0x8b27, 0x8001, 0x6a86, 0x0001,
+    0x0002, 0x8004, 0x49c4, 0x6a86, 0x6a86, 0x49c4, 0x0002,
+    0x0002, 0x8004, 0x6a86, 0x8b27, 0x8b27, 0x6a86, 0x0002,
+    0x0002, 0x8004, 0x49c4, 0x8b27, 0x8b27, 0x49c4, 0x0002,
+    0x0003, 0x8002, 0x49c4, 0x49c4, 0x0003,
+
+    // frame 6/10
+    0x0008,
+    0x0008,
+    0x0008,
+    0x0001, 0x8001, 0xfb20, 0x0006,
+    0x0008,
+    0x0004, 0x8001, 0xfb20, 0x0003,
+    0x0004, 0x8002, 0xfb20, 0xfb20, 0x0002,
+    0x0003, 0x8003, 0xfb20, 0xfd40, 0xfb20, 0x0002,
+    0x0003, 0x8004, 0xfb20, 0xfd40, 0xfd40, 0xfb20, 0x0001,
+    0x0002, 0x8005, 0xfb20, 0xfd40, 0xfee4, 0xfb20, 0xfb20, 0x0001,
+    0x0002, 0x8004, 0xfb20, 0xfee4, 0xfee4, 0xfb20, 0x0002,
+    0x0001, 0x8001, 0x6a86, 0x4004, 0x8b27, 0x8001, 0x6a86, 0x0001,
+    0x0002, 0x8004, 0x49c4, 0x6a86, 0x6a86, 0x49c4, 0x0002,
+    0x0002, 0x8004, 0x6a86, 0x8b27, 0x8b27, 0x6a86, 0x0002,
+    0x0002, 0x8004, 0x49c4, 0x8b27, 0x8b27, 0x49c4, 0x0002,
+    0x0003, 0x8002, 0x49c4, 0x49c4, 0x0003,
+
+    // frame 7/10
+    0x0008,
+    0x0008,
+    0x0001, 0x8001, 0xfb20, 0x0006,
+    0x0008,
+    0x0005, 0x8001, 0xfb20, 0x0002,
+    0x0008,
+    0x0005, 0x8001, 0xfb20, 0x0002,
+    0x0005, 0x8002, 0xfb20, 0xfb20, 0x0001,
+    0x0004, 0x8003, 0xfb20, 0xfd40, 0xfb20, 0x0001,
+    0x0003, 0x8003, 0xfb20, 0xfd40, 0xfb20, 0x0002,
+    0x0002, 0x8004, 0xfb20, 0xfee4, 0xfee4, 0xfb20, 0x0002,
+    0x0001, 0x8001, 0x6a86, 0x4004, 0x8b27, 0x8001, 0x6a86, 0x0001,
+    0x0002, 0x8004, 0x49c4, 0x6a86, 0x6a86, 0x49c4, 0x0002,
+    0x0002, 0x8004, 0x6a86, 0x8b27, 0x8b27, 0x6a86, 0x0002,
+    0x0002, 0x8004, 0x49c4, 0x8b27, 0x8b27, 0x49c4, 0x0002,
+    0x0003, 0x8002, 0x49c4, 0x49c4, 0x0003,
+
+    // frame 8/10
+    0x0008,
+    0x0001, 0x8001, 0xfb20, 0x0006,
+    0x0008,
+    0x0005, 0x8001, 0xfb20, 0x0002,
+    0x0008,
+    0x0008,
+    0x0004, 0x8001, 0xfb20, 0x0003,
+    0x0003, 0x8003, 0xfb20, 0xfd40, 0xfb20, 0x0002,
+    0x0002, 0x8004, 0xfb20, 0xfd40, 0xfd40, 0xfb20, 0x0002,
+    0x0002, 0x8003, 0xfb20, 0xfee4, 0xfb20, 0x0003,
+    0x0002, 0x8004, 0xfb20, 0xfee4, 0xfee4, 0xfb20, 0x0002,
+    0x0001, 0x8001, 0x6a86, 0x4004, 0x8b27, 0x8001, 0x6a86, 0x0001,
+    0x0002, 0x8004, 0x49c4, 0x6a86, 0x6a86, 0x49c4, 0x0002,
+    0x0002, 0x8004, 0x6a86, 0x8b27, 0x8b27, 0x6a86, 0x0002,
+    0x0002, 0x8004, 0x49c4, 0x8b27, 0x8b27, 0x49c4, 0x0002,
+    0x0003, 0x8002, 0x49c4, 0x49c4, 0x0003,
+
+    // frame 9/10
+    0x0001, 0x8001, 0xfb20, 0x0006,
+    0x0008,
+    0x0005, 0x8001, 0xfb20, 0x0002,
+    0x0008,
+    0x0008,
+    0x0008,
+    0x0003, 0x8002, 0xfb20, 0xfb20, 0x0003,
+    0x0002, 0x8004, 0xfb20, 0xfd40, 0xfd40, 0xfb20, 0x0002,
+    0x0003, 0x8003, 0xfb20, 0xfd40, 0xfb20, 0x0002,
+    0x0003, 0x8003, 0xfb20, 0xfee4, 0xfb20, 0x0002,
+    0x0002, 0x8004, 0xfb20, 0xfb20, 0xfee4, 0xfb20, 0x0002,
+    0x0001, 0x8001, 0x6a86, 0x4004, 0x8b27, 0x8001, 0x6a86, 0x0001,
+    0x0002, 0x8004, 0x49c4, 0x6a86, 0x6a86, 0x49c4, 0x0002,
+    0x0002, 0x8004, 0x6a86, 0x8b27, 0x8b27, 0x6a86, 0x0002,
+    0x0002, 0x8004, 0x49c4, 0x8b27, 0x8b27, 0x49c4, 0x0002,
+    0x0003, 0x8002, 0x49c4, 0x49c4, 0x0003,
+
+    // frame 10/10
+    0x0008,
+    0x0005, 0x8001, 0xfb20, 0x0002,
+    0x0008,
+    0x0008,
+    0x0008,
+    0x0008,
+    0x0003, 0x8001, 0xfb20, 0x0004,
+    0x0002, 0x8003, 0xfb20, 0xfd40, 0xfb20, 0x0003,
+    0x0002, 0x8003, 0xfb20, 0xfd40, 0xfb20, 0x0003,
+    0x0002, 0x8004, 0xfb20, 0xfee4, 0xfd40, 0xfb20, 0x0002,
+    0x0002, 0x8004, 0xfb20, 0xfee4, 0xfee4, 0xfb20, 0x0002,
+    0x0001, 0x8001, 0x6a86, 0x4004, 0x8b27, 0x8001, 0x6a86, 0x0001,
+    0x0002, 0x8004, 0x49c4, 0x6a86, 0x6a86, 0x49c4, 0x0002,
+    0x0002, 0x8004, 0x6a86, 0x8b27, 0x8b27, 0x6a86, 0x0002,
+    0x0002, 0x8004, 0x49c4, 0x8b27, 0x8b27, 0x49c4, 0x0002,
+    0x0003, 0x8002, 0x49c4, 0x49c4, 0x0003
+
+};
+
+static_assert(gfx::validRle(TORCH_RLE), "TORCH_RLE is not a valid run-length encoded image");
\ No newline at end of file
@@ -17,7 +17,7 @@ const uint8_t SCREEN_HEIGHT = 64;
 
 const uint8_t AVATAR_WIDTH  = SPRITE_DATA[0];
 const uint8_t AVATAR_HEIGHT = SPRITE_DATA[1];
-const uint8_t AVATAR_FRAMES = SPRITE_DATA[2];
+const uint8_t AVATAR_FRAMES = sizeof(SPRITE_FRAMES);
 
 const uint8_t TILE_WIDTH  = TILESET_DATA[0];
 const uint8_t TILE_HEIGHT = TILESET_DATA[1];
@@ -98,7 +98,7 @@ struct Avatar {
 
     void draw() {
         Image sprite(SPRITE_DATA);
-        sprite.setFrame(frame);
+        sprite.setFrame(SPRITE_FRAMES[frame]);
         gb.display.drawImage(x, y, sprite, direction * AVATAR_WIDTH, AVATAR_HEIGHT);
     }
 
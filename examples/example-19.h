@@ -0,0 +1,47 @@
+/**
+ * ----------------------------------------------------------------------------
+ * Handling images on the Gamebuino META
+ * © 2021 Stéphane Calderoni
+ * ----------------------------------------------------------------------------
+ */
+
+#include <Gamebuino-Meta.h>
+#include "../assets/rgb565.h"
+#include "../gfx/video.h"
+
+// splash.gbv is generated from splash.bmp by `make assets` in tools/
+
+File file;
+gfx::Video<File> video(file);
+
+// the video is played into its own buffer, which keeps the previous frame
+// intact under the texts and sprites drawn over it
+Image screen(80, 64, ColorMode::rgb565);
+
+// false once the file turns out to be missing, not a video, or truncated
+bool playing;
+
+void setup() {
+    gb.begin();
+    file = SD.open("splash.gbv");
+    playing = video.begin();
+}
+
+void loop() {
+    
+    gb.waitForUpdate();
+
+    if (!playing || !video.nextFrame(screen)) {
+        playing = false;
+        gb.display.clear();
+        gb.display.print(4, 24, "Cannot play");
+        gb.display.print(4, 32, "splash.gbv");
+        return;
+    }
+
+    gb.display.drawImage(0, 0, screen);
+    
+    gb.display.print(8, 16, "My Stunning Game");
+    gb.display.drawImage(36, 40, SPRITE_DATA);
+    
+}
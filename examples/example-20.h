@@ -0,0 +1,23 @@
+/**
+ * ----------------------------------------------------------------------------
+ * Handling images on the Gamebuino META
+ * © 2021 Stéphane Calderoni
+ * ----------------------------------------------------------------------------
+ */
+
+#include <Gamebuino-Meta.h>
+#include "../gfx/bmp.h"
+
+// same picture as example-17, converted to RGB565 only on the first run:
+// later runs read gamebuino.565, written next to it on the SD card
+Image image(80, 64, ColorMode::rgb565);
+
+void setup() {
+    gb.begin();
+    gfx::loadBMP(SD, "gamebuino.bmp", image);
+    gb.display.drawImage(0, 0, image);
+}
+
+void loop() {
+    gb.waitForUpdate();
+}
\ No newline at end of file
@@ -0,0 +1,58 @@
+/**
+ * ----------------------------------------------------------------------------
+ * Handling images on the Gamebuino META
+ * © 2021 Stéphane Calderoni
+ * ----------------------------------------------------------------------------
+ */
+
+#include <Gamebuino-Meta.h>
+#include "../assets/rgb565.h"
+#include "../gfx/tilemap.h"
+
+// a tilemap twice as wide as the screen, drawn row by row by gfx::TileMap
+// and scrolled with the LEFT and RIGHT buttons
+
+const uint8_t SCREEN_WIDTH  = 80;
+const uint8_t SCREEN_HEIGHT = 64;
+
+const uint8_t TILES_WIDE = 10;
+const uint8_t TILES_HIGH = 8;
+
+const uint8_t TILEMAP[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 2, 2, 1, 1, 1, 2, 2, 2, 2,
+    0, 0, 0, 3, 3, 3, 0, 0, 0, 0,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3
+};
+
+const uint8_t SCROLL_SPEED = 2;
+
+gfx::TileMap tilemap(TILESET_DATA, TILEMAP, TILES_WIDE, TILES_HIGH);
+
+int16_t scrollX = 0;
+
+void setup() {
+    gb.begin();
+    gb.setFrameRate(32);
+}
+
+void loop() {
+
+    gb.waitForUpdate();
+
+    if (gb.buttons.repeat(BUTTON_LEFT, 0)) {
+        scrollX -= SCROLL_SPEED;
+        if (scrollX < 0) scrollX = 0;
+    } else if (gb.buttons.repeat(BUTTON_RIGHT, 0)) {
+        scrollX += SCROLL_SPEED;
+        if (scrollX > tilemap.width() - SCREEN_WIDTH) scrollX = tilemap.width() - SCREEN_WIDTH;
+    }
+
+    // the map covers the whole screen: no need to clear it first
+    tilemap.draw(gb.display, scrollX);
+
+}
@@ -0,0 +1,45 @@
+/**
+ * ----------------------------------------------------------------------------
+ * Handling images on the Gamebuino META
+ * © 2021 Stéphane Calderoni
+ * ----------------------------------------------------------------------------
+ */
+
+#include <Gamebuino-Meta.h>
+#include "../assets/rgb565.h"
+#include "../gfx/scale.h"
+
+// example-02, zoomed through the integer scaling kernel of gfx/scale.h
+// instead of the generic stretching path of drawImage
+
+const uint8_t SCREEN_WIDTH  = 80;
+const uint8_t SCREEN_HEIGHT = 64;
+
+const uint8_t AVATAR_WIDTH  = SPRITE_DATA[0];
+const uint8_t AVATAR_HEIGHT = SPRITE_DATA[1];
+
+constexpr gfx::Sprite AVATAR(SPRITE_DATA);
+
+void setup() {
+    gb.begin();
+    gb.setFrameRate(32);
+}
+
+void loop() {
+
+    gb.waitForUpdate();
+    gb.display.clear();
+
+    uint8_t aw = 3*AVATAR_WIDTH;
+    uint8_t ah = 3*AVATAR_HEIGHT;
+
+    gfx::drawScaled(
+        gb.display,
+        .5*(SCREEN_WIDTH  - aw), // x
+        .5*(SCREEN_HEIGHT - ah), // y
+        AVATAR,                  // sprite
+        aw,                      // x-stretched
+        ah                       // y-stretched
+    );
+
+}
@@ -0,0 +1,62 @@
+/**
+ * ----------------------------------------------------------------------------
+ * Handling images on the Gamebuino META
+ * © 2021 Stéphane Calderoni
+ * ----------------------------------------------------------------------------
+ */
+
+#include <Gamebuino-Meta.h>
+#include "../assets/indexed.h"
+#include "../gfx/color.h"
+#include "../gfx/remap.h"
+
+// example-07, each tint being a color table passed to the draw instead of a
+// rewrite of the display palette before it, and its shades being computed
+// in fixed point
+
+const uint8_t SCREEN_WIDTH  = 80;
+const uint8_t SCREEN_HEIGHT = 64;
+const uint8_t NB_TINTS      = 6;
+
+const uint8_t AVATAR_WIDTH  = SPRITE_DATA[0];
+const uint8_t AVATAR_HEIGHT = SPRITE_DATA[1];
+
+const uint16_t SHADE = gfx::fraction(.8f);
+
+Color tint[] = { PINK, LIGHTBLUE, LIGHTGREEN, YELLOW, ORANGE, RED };
+Color tinted[NB_TINTS][16];
+
+void makeTint(Color *colors, Color color) {
+
+    uint16_t c = (uint16_t)color;
+
+    memcpy(colors, PALETTE, 16*sizeof(Color));
+
+    colors[0xc] = (Color)gfx::shade(c, SHADE);
+    colors[0xb] = (Color)gfx::shade((uint16_t)colors[0xc], SHADE);
+    colors[0xd] = color;
+
+}
+
+void setup() {
+    gb.begin();
+    gb.setFrameRate(32);
+    for (uint8_t i=0; i<NB_TINTS; ++i) makeTint(tinted[i], tint[i]);
+}
+
+void loop() {
+
+    gb.waitForUpdate();
+    gb.display.clear();
+
+    for (uint8_t i=0; i<NB_TINTS; ++i) {
+        gfx::drawRemapped(
+            gb.display,
+            (i+1)*SCREEN_WIDTH/(NB_TINTS+1) - .5*AVATAR_WIDTH,
+            .5*(SCREEN_HEIGHT - AVATAR_HEIGHT),
+            SPRITE_DATA,
+            tinted[i]
+        );
+    }
+    
+}
@@ -0,0 +1,243 @@
+/**
+ * ----------------------------------------------------------------------------
+ * Handling images on the Gamebuino META
+ * © 2021 Stéphane Calderoni
+ * ----------------------------------------------------------------------------
+ */
+
+#include <Gamebuino-Meta.h>
+#include "../assets/atlas.h"
+
+// example-16, every image being a region of a single atlas: no Image object
+// is built, and the frames of the avatar are the ones of its sheet, the
+// duplicate one being shared within the atlas
+
+// ----------------------------------------------------------------------------
+// Global constants
+// ----------------------------------------------------------------------------
+
+const uint8_t SCREEN_WIDTH  = 80;
+const uint8_t SCREEN_HEIGHT = 64;
+
+const uint8_t AVATAR_WIDTH  = ATLAS_REGIONS[ATLAS_SPRITE].width;
+const uint8_t AVATAR_HEIGHT = ATLAS_REGIONS[ATLAS_SPRITE].height;
+const uint8_t AVATAR_FRAMES = ATLAS_REGIONS[ATLAS_SPRITE].frames;
+
+const uint8_t TILE_WIDTH  = ATLAS_REGIONS[ATLAS_TILESET].width;
+const uint8_t TILE_HEIGHT = ATLAS_REGIONS[ATLAS_TILESET].height;
+
+const uint8_t TORCH_FRAMES = ATLAS_REGIONS[ATLAS_TORCH].frames;
+const uint8_t TORCH_LOOP   = ATLAS_REGIONS[ATLAS_TORCH].loop;
+
+const uint8_t TILES_WIDE = SCREEN_WIDTH  / TILE_WIDTH;
+const uint8_t TILES_HIGH = SCREEN_HEIGHT / TILE_HEIGHT;
+
+const uint8_t Y_GROUND = SCREEN_HEIGHT - 2*TILE_HEIGHT;
+
+const uint8_t TILEMAP[] = {
+    0, 0, 0, 0, 0,
+    2, 2, 2, 2, 2,
+    0, 0, 0, 0, 0,
+    2, 2, 2, 2, 2,
+    0, 0, 0, 0, 0,
+    2, 2, 2, 2, 2,
+    1, 1, 1, 1, 1,
+    3, 3, 3, 3, 3
+};
+
+const int8_t AVATAR_SPEED =  2;
+const int8_t AVATAR_JUMP  = -5;
+
+const int8_t GRAVITY = 1;
+
+// ----------------------------------------------------------------------------
+// Definition of the object-oriented model of the avatar
+// ----------------------------------------------------------------------------
+
+struct Avatar {
+
+    int16_t x, y;
+    int8_t  vx, vy;
+    uint8_t frame;
+    int8_t  direction;
+    bool    jumping;
+
+    Avatar(int16_t x, int16_t y) : x(x), y(y), vx(0), vy(0), frame(0), direction(1), jumping(false) {}
+
+    void moveToLeft() {
+        vx = - AVATAR_SPEED;
+        direction = -1;
+    }
+
+    void moveToRight() {
+        vx = AVATAR_SPEED;
+        direction = 1;
+    }
+
+    void stop() {
+        vx = 0;
+        vy = 0;
+        frame = 0;
+        jumping = false;
+    }
+
+    void jump() {
+        vy = AVATAR_JUMP;
+        jumping = true;
+    }
+
+    void update() {
+
+        x += vx;
+        y += vy;
+
+        if (jumping) {
+            
+            frame = 3;
+            
+        } else if (vx && (gb.frameCount & 0x1)) {
+            
+            ++frame %= AVATAR_FRAMES;
+            
+        }
+
+    }
+
+    void draw() {
+        gfx::drawRegion(gb.display, x, y, ATLAS, ATLAS_SPRITE, frame, direction < 0 ? gfx::FLIP_X : gfx::FLIP_NONE);
+    }
+
+};
+
+// ----------------------------------------------------------------------------
+// Global variables
+// ----------------------------------------------------------------------------
+
+uint8_t torchFrame = 0;
+uint8_t torchTicks = 0;
+Avatar avatar(.5*(SCREEN_WIDTH - AVATAR_WIDTH), Y_GROUND - AVATAR_HEIGHT);
+
+// ----------------------------------------------------------------------------
+// Graphics rendering
+// ----------------------------------------------------------------------------
+
+void drawTilemap() {
+
+    for (uint8_t j=0; j<TILES_HIGH; ++j) {
+        for (uint8_t i=0; i<TILES_WIDE; ++i) {
+
+            gfx::drawRegion(
+                gb.display,
+                i*TILE_WIDTH,               // x
+                j*TILE_HEIGHT,              // y
+                ATLAS,                      // atlas
+                ATLAS_TILESET,              // region
+                TILEMAP[i + j * TILES_WIDE] // frame
+            );
+
+        }
+    }
+
+}
+
+// the frame loop of drawImage: one frame every TORCH_LOOP rendered frames
+void drawTorches() {
+
+    if (++torchTicks >= TORCH_LOOP) {
+        torchTicks = 0;
+        torchFrame = (torchFrame + 1) % TORCH_FRAMES;
+    }
+
+    gfx::drawRegion(gb.display, 12, 6, ATLAS, ATLAS_TORCH, torchFrame);
+    gfx::drawRegion(gb.display, 60, 6, ATLAS, ATLAS_TORCH, torchFrame);
+
+}
+
+// ----------------------------------------------------------------------------
+// Handling user input
+// ----------------------------------------------------------------------------
+
+void readUserInput() {
+
+    if (gb.buttons.repeat(BUTTON_LEFT, 0)) {
+
+        avatar.moveToLeft();
+
+    } else if (gb.buttons.repeat(BUTTON_RIGHT, 0)) {
+
+        avatar.moveToRight();
+
+    } else if (gb.buttons.released(BUTTON_LEFT) || gb.buttons.released(BUTTON_RIGHT)) {
+
+        if (!avatar.jumping) avatar.stop();
+
+    }
+
+    if (gb.buttons.pressed(BUTTON_A) && !avatar.jumping) {
+
+        avatar.jump();
+
+    }
+
+}
+
+// ----------------------------------------------------------------------------
+// Handling physical constraints of the game scene
+// ----------------------------------------------------------------------------
+
+void updateGame() {
+
+    if (avatar.x < 0) {
+
+        avatar.x = 0;
+
+    } else if (avatar.x + AVATAR_WIDTH > SCREEN_WIDTH ) {
+
+        avatar.x = SCREEN_WIDTH - AVATAR_WIDTH;
+
+    }
+
+    if (avatar.jumping) {
+
+        avatar.vy += GRAVITY;
+
+        if (avatar.y + AVATAR_HEIGHT > Y_GROUND) {
+
+            avatar.stop();
+            avatar.y = Y_GROUND - AVATAR_HEIGHT;
+
+        }
+
+    }
+
+}
+
+// ----------------------------------------------------------------------------
+// Initialization
+// ----------------------------------------------------------------------------
+
+void setup() {
+
+    gb.begin();
+    gb.setFrameRate(32);
+
+}
+
+// ----------------------------------------------------------------------------
+// Main control loop
+// ----------------------------------------------------------------------------
+
+void loop() {
+
+    gb.waitForUpdate();
+    gb.display.clear();
+
+    readUserInput();
+    avatar.update();
+    updateGame();
+    
+    drawTilemap();
+    drawTorches();
+    avatar.draw();
+
+}
\ No newline at end of file
@@ -0,0 +1,256 @@
+/**
+ * ----------------------------------------------------------------------------
+ * Handling images on the Gamebuino META
+ * © 2021 Stéphane Calderoni
+ * ----------------------------------------------------------------------------
+ */
+
+#include <Gamebuino-Meta.h>
+#include "../assets/descriptors.h"
+#include "../gfx/animation.h"
+#include "../gfx/background.h"
+#include "../gfx/tilemap.h"
+
+// example-21, the frames of the avatar and of the torches being picked by
+// animation players that advance on elapsed time instead of rendered frames:
+// the walk keeps its pace and the torches keep flickering at the speed given
+// by their frame loop whatever the frame rate set in setup(), which can be
+// lowered without slowing the animations down
+
+// ----------------------------------------------------------------------------
+// Global constants
+// ----------------------------------------------------------------------------
+
+const uint8_t SCREEN_WIDTH  = 80;
+const uint8_t SCREEN_HEIGHT = 64;
+
+const uint8_t AVATAR_WIDTH  = SPRITE_ASSET::width;
+const uint8_t AVATAR_HEIGHT = SPRITE_ASSET::height;
+const uint8_t AVATAR_FRAMES = sizeof(SPRITE_FRAMES);
+
+const uint8_t TILE_WIDTH  = TILESET_ASSET::width;
+const uint8_t TILE_HEIGHT = TILESET_ASSET::height;
+
+const uint8_t TILES_WIDE = SCREEN_WIDTH  / TILE_WIDTH;
+const uint8_t TILES_HIGH = SCREEN_HEIGHT / TILE_HEIGHT;
+
+const uint8_t TORCH_WIDTH  = TORCH_ASSET::width;
+const uint8_t TORCH_HEIGHT = TORCH_ASSET::height;
+
+const uint8_t Y_GROUND = SCREEN_HEIGHT - 2*TILE_HEIGHT;
+
+const uint8_t TILEMAP[] = {
+    0, 0, 0, 0, 0,
+    2, 2, 2, 2, 2,
+    0, 0, 0, 0, 0,
+    2, 2, 2, 2, 2,
+    0, 0, 0, 0, 0,
+    2, 2, 2, 2, 2,
+    1, 1, 1, 1, 1,
+    3, 3, 3, 3, 3
+};
+
+const int8_t AVATAR_SPEED =  2;
+const int8_t AVATAR_JUMP  = -5;
+
+const int8_t GRAVITY = 1;
+
+// frame rate the frame loops were designed for
+const uint8_t ANIMATION_FPS = 32;
+
+// frames of SPRITE_FRAMES
+const gfx::Clip IDLE = { 0, 1,             gfx::PLAY_ONCE, 0 };
+const gfx::Clip WALK = { 0, AVATAR_FRAMES, gfx::PLAY_LOOP, 2 };
+const gfx::Clip JUMP = { 3, 1,             gfx::PLAY_ONCE, 0 };
+
+constexpr gfx::Sprite TORCH(TORCH_DATA);
+
+// ----------------------------------------------------------------------------
+// Background layer
+// ----------------------------------------------------------------------------
+
+Image layer(SCREEN_WIDTH, SCREEN_HEIGHT, ColorMode::rgb565);
+gfx::Background<4> background(layer);
+
+// ----------------------------------------------------------------------------
+// Definition of the object-oriented model of the avatar
+// ----------------------------------------------------------------------------
+
+struct Avatar {
+
+    int16_t x, y;
+    int8_t  vx, vy;
+    int8_t  direction;
+    bool    jumping;
+
+    gfx::AnimationPlayer animation;
+
+    Avatar(int16_t x, int16_t y) : x(x), y(y), vx(0), vy(0), direction(1), jumping(false), animation(SPRITE_DATA, ANIMATION_FPS) {
+        animation.play(IDLE);
+    }
+
+    void moveToLeft() {
+        vx = - AVATAR_SPEED;
+        direction = -1;
+    }
+
+    void moveToRight() {
+        vx = AVATAR_SPEED;
+        direction = 1;
+    }
+
+    void stop() {
+        vx = 0;
+        vy = 0;
+        jumping = false;
+    }
+
+    void jump() {
+        vy = AVATAR_JUMP;
+        jumping = true;
+    }
+
+    void update() {
+
+        x += vx;
+        y += vy;
+
+        if (jumping) {
+
+            animation.play(JUMP);
+
+        } else if (vx) {
+
+            animation.play(WALK);
+
+        } else {
+
+            animation.play(IDLE);
+
+        }
+
+    }
+
+    void draw() {
+        uint16_t frame = animation.update(millis());
+        background.mark(x, y, AVATAR_WIDTH, AVATAR_HEIGHT);
+        gfx::drawAsset<SPRITE_ASSET>(gb.display, x, y, SPRITE_FRAMES[frame], direction < 0 ? gfx::FLIP_X : gfx::FLIP_NONE);
+    }
+
+};
+
+// ----------------------------------------------------------------------------
+// Global variables
+// ----------------------------------------------------------------------------
+
+gfx::AnimationPlayer torch(TORCH_DATA, ANIMATION_FPS);
+Avatar avatar(.5*(SCREEN_WIDTH - AVATAR_WIDTH), Y_GROUND - AVATAR_HEIGHT);
+
+// ----------------------------------------------------------------------------
+// Graphics rendering
+// ----------------------------------------------------------------------------
+
+void drawTilemap() {
+
+    gfx::TileMap tilemap(TILESET_DATA, TILEMAP, TILES_WIDE, TILES_HIGH);
+    tilemap.draw(background.cache());
+
+}
+
+void drawTorches() {
+    uint16_t frame = torch.update(millis());
+    background.mark(12, 6, TORCH_WIDTH, TORCH_HEIGHT);
+    background.mark(60, 6, TORCH_WIDTH, TORCH_HEIGHT);
+    gfx::drawSprite(gb.display, 12, 6, TORCH, frame);
+    gfx::drawSprite(gb.display, 60, 6, TORCH, frame);
+}
+
+// ----------------------------------------------------------------------------
+// Handling user input
+// ----------------------------------------------------------------------------
+
+void readUserInput() {
+
+    if (gb.buttons.repeat(BUTTON_LEFT, 0)) {
+
+        avatar.moveToLeft();
+
+    } else if (gb.buttons.repeat(BUTTON_RIGHT, 0)) {
+
+        avatar.moveToRight();
+
+    } else if (gb.buttons.released(BUTTON_LEFT) || gb.buttons.released(BUTTON_RIGHT)) {
+
+        if (!avatar.jumping) avatar.stop();
+
+    }
+
+    if (gb.buttons.pressed(BUTTON_A) && !avatar.jumping) {
+
+        avatar.jump();
+
+    }
+
+}
+
+// ----------------------------------------------------------------------------
+// Handling physical constraints of the game scene
+// ----------------------------------------------------------------------------
+
+void updateGame() {
+
+    if (avatar.x < 0) {
+
+        avatar.x = 0;
+
+    } else if (avatar.x + AVATAR_WIDTH > SCREEN_WIDTH ) {
+
+        avatar.x = SCREEN_WIDTH - AVATAR_WIDTH;
+
+    }
+
+    if (avatar.jumping) {
+
+        avatar.vy += GRAVITY;
+
+        if (avatar.y + AVATAR_HEIGHT > Y_GROUND) {
+
+            avatar.stop();
+            avatar.y = Y_GROUND - AVATAR_HEIGHT;
+
+        }
+
+    }
+
+}
+
+// ----------------------------------------------------------------------------
+// Initialization
+// ----------------------------------------------------------------------------
+
+void setup() {
+
+    gb.begin();
+    gb.setFrameRate(32);
+
+    drawTilemap();
+
+}
+
+// ----------------------------------------------------------------------------
+// Main control loop
+// ----------------------------------------------------------------------------
+
+void loop() {
+
+    gb.waitForUpdate();
+    background.restore(gb.display);
+
+    readUserInput();
+    avatar.update();
+    updateGame();
+    
+    drawTorches();
+    avatar.draw();
+
+}
\ No newline at end of file
@@ -0,0 +1,242 @@
+/**
+ * ----------------------------------------------------------------------------
+ * Handling images on the Gamebuino META
+ * © 2021 Stéphane Calderoni
+ * ----------------------------------------------------------------------------
+ */
+
+#include <Gamebuino-Meta.h>
+#include "../assets/display.h"
+
+// example-16, built for any display mode: the assets come from the variant
+// of the DISPLAY_MODE set in config-gamebuino.h, and the positions and
+// speeds follow the resolution of the screen, so that the full resolution
+// of DISPLAY_MODE_INDEX shows the same scene, twice as large
+
+// ----------------------------------------------------------------------------
+// Global constants
+// ----------------------------------------------------------------------------
+
+// 1 on the 80x64 screens, 2 on the 160x128 one
+const uint8_t SCALE = DISPLAY_MODE == DISPLAY_MODE_INDEX ? 2 : 1;
+
+const uint8_t SCREEN_WIDTH  = 80 * SCALE;
+const uint8_t SCREEN_HEIGHT = 64 * SCALE;
+
+const uint8_t AVATAR_WIDTH  = SPRITE_DATA[0];
+const uint8_t AVATAR_HEIGHT = SPRITE_DATA[1];
+const uint8_t AVATAR_FRAMES = sizeof(SPRITE_FRAMES);
+
+const uint8_t TILE_WIDTH  = TILESET_DATA[0];
+const uint8_t TILE_HEIGHT = TILESET_DATA[1];
+
+const uint8_t TILES_WIDE = SCREEN_WIDTH  / TILE_WIDTH;
+const uint8_t TILES_HIGH = SCREEN_HEIGHT / TILE_HEIGHT;
+
+const uint8_t Y_GROUND = SCREEN_HEIGHT - 2*TILE_HEIGHT;
+
+const uint8_t TILEMAP[] = {
+    0, 0, 0, 0, 0,
+    2, 2, 2, 2, 2,
+    0, 0, 0, 0, 0,
+    2, 2, 2, 2, 2,
+    0, 0, 0, 0, 0,
+    2, 2, 2, 2, 2,
+    1, 1, 1, 1, 1,
+    3, 3, 3, 3, 3
+};
+
+const int8_t AVATAR_SPEED =  2 * SCALE;
+const int8_t AVATAR_JUMP  = -5 * SCALE;
+
+const int8_t GRAVITY = SCALE;
+
+// ----------------------------------------------------------------------------
+// Definition of the object-oriented model of the avatar
+// ----------------------------------------------------------------------------
+
+struct Avatar {
+
+    int16_t x, y;
+    int8_t  vx, vy;
+    uint8_t frame;
+    int8_t  direction;
+    bool    jumping;
+
+    Avatar(int16_t x, int16_t y) : x(x), y(y), vx(0), vy(0), frame(0), direction(1), jumping(false) {}
+
+    void moveToLeft() {
+        vx = - AVATAR_SPEED;
+        direction = -1;
+    }
+
+    void moveToRight() {
+        vx = AVATAR_SPEED;
+        direction = 1;
+    }
+
+    void stop() {
+        vx = 0;
+        vy = 0;
+        frame = 0;
+        jumping = false;
+    }
+
+    void jump() {
+        vy = AVATAR_JUMP;
+        jumping = true;
+    }
+
+    void update() {
+
+        x += vx;
+        y += vy;
+
+        if (jumping) {
+            
+            frame = 3;
+            
+        } else if (vx && (gb.frameCount & 0x1)) {
+            
+            ++frame %= AVATAR_FRAMES;
+            
+        }
+
+    }
+
+    void draw() {
+        Image sprite(SPRITE_DATA);
+        sprite.setFrame(SPRITE_FRAMES[frame]);
+        gb.display.drawImage(x, y, sprite, direction * AVATAR_WIDTH, AVATAR_HEIGHT);
+    }
+
+};
+
+// ----------------------------------------------------------------------------
+// Global variables
+// ----------------------------------------------------------------------------
+
+Image torch(TORCH_DATA);
+Avatar avatar(.5*(SCREEN_WIDTH - AVATAR_WIDTH), Y_GROUND - AVATAR_HEIGHT);
+
+// ----------------------------------------------------------------------------
+// Graphics rendering
+// ----------------------------------------------------------------------------
+
+void drawTilemap() {
+
+    Image tileset(TILESET_DATA);
+
+    for (uint8_t j=0; j<TILES_HIGH; ++j) {
+        for (uint8_t i=0; i<TILES_WIDE; ++i) {
+
+            tileset.setFrame(TILEMAP[i + j * TILES_WIDE]);
+
+            gb.display.drawImage(
+                i*TILE_WIDTH,  // x
+                j*TILE_HEIGHT, // y
+                tileset        // image
+            );
+
+        }
+    }
+
+}
+
+void drawTorches() {
+    gb.display.drawImage(12 * SCALE, 6 * SCALE, torch);
+    gb.display.drawImage(60 * SCALE, 6 * SCALE, torch);
+}
+
+// ----------------------------------------------------------------------------
+// Handling user input
+// ----------------------------------------------------------------------------
+
+void readUserInput() {
+
+    if (gb.buttons.repeat(BUTTON_LEFT, 0)) {
+
+        avatar.moveToLeft();
+
+    } else if (gb.buttons.repeat(BUTTON_RIGHT, 0)) {
+
+        avatar.moveToRight();
+
+    } else if (gb.buttons.released(BUTTON_LEFT) || gb.buttons.released(BUTTON_RIGHT)) {
+
+        if (!avatar.jumping) avatar.stop();
+
+    }
+
+    if (gb.buttons.pressed(BUTTON_A) && !avatar.jumping) {
+
+        avatar.jump();
+
+    }
+
+}
+
+// ----------------------------------------------------------------------------
+// Handling physical constraints of the game scene
+// ----------------------------------------------------------------------------
+
+void updateGame() {
+
+    if (avatar.x < 0) {
+
+        avatar.x = 0;
+
+    } else if (avatar.x + AVATAR_WIDTH > SCREEN_WIDTH ) {
+
+        avatar.x = SCREEN_WIDTH - AVATAR_WIDTH;
+
+    }
+
+    if (avatar.jumping) {
+
+        avatar.vy += GRAVITY;
+
+        if (avatar.y + AVATAR_HEIGHT > Y_GROUND) {
+
+            avatar.stop();
+            avatar.y = Y_GROUND - AVATAR_HEIGHT;
+
+        }
+
+    }
+
+}
+
+// ----------------------------------------------------------------------------
+// Initialization
+// ----------------------------------------------------------------------------
+
+void setup() {
+
+    gb.begin();
+    gb.setFrameRate(32);
+
+#if DISPLAY_MODE != DISPLAY_MODE_RGB565
+    gb.display.setPalette(PALETTE);
+#endif
+
+}
+
+// ----------------------------------------------------------------------------
+// Main control loop
+// ----------------------------------------------------------------------------
+
+void loop() {
+
+    gb.waitForUpdate();
+    gb.display.clear();
+
+    readUserInput();
+    avatar.update();
+    updateGame();
+    
+    drawTilemap();
+    drawTorches();
+    avatar.draw();
+
+}
\ No newline at end of file
@@ -0,0 +1,56 @@
+/**
+ * ----------------------------------------------------------------------------
+ * Handling images on the Gamebuino META
+ * © 2021 Stéphane Calderoni
+ * ----------------------------------------------------------------------------
+ */
+
+#include <Gamebuino-Meta.h>
+#include "../assets/display.h"
+#include "../gfx/memory.h"
+
+// example-17, accounted for: the ledger lists the arrays of the asset
+// variant of the display mode, the framebuffer and the image loaded from
+// the SD card, and shows its report a page at a time
+
+const uint8_t SCREEN_HEIGHT = DISPLAY_MODE == DISPLAY_MODE_INDEX ? 128 : 64;
+const uint8_t LINE_HEIGHT   = 6;
+const uint8_t PAGE_LINES    = (SCREEN_HEIGHT - 2) / LINE_HEIGHT;
+const uint16_t PAGE_MS      = 2000;
+
+gfx::MemoryLedger<16> ledger;
+
+Image image("gamebuino.bmp");
+
+void setup() {
+
+    gb.begin();
+
+    #define REGISTER(NAME) ledger.flash(#NAME, NAME);
+    DISPLAY_ASSETS(REGISTER)
+
+    ledger.image("display", gb.display);
+    ledger.image("gamebuino.bmp", image);
+
+}
+
+void loop() {
+
+    gb.waitForUpdate();
+    ledger.sample(gb.getFreeRam());
+
+    uint8_t lines = 0;
+    char    text[24];
+    while (ledger.line(lines, text, sizeof(text))) ++lines;
+
+    uint8_t pages = (lines + PAGE_LINES - 1) / PAGE_LINES;
+    uint8_t first = millis() / PAGE_MS % pages * PAGE_LINES;
+
+    gb.display.clear();
+    gb.display.setFontSize(1);
+
+    for (uint8_t i=first; i<first + PAGE_LINES && ledger.line(i, text, sizeof(text)); ++i) {
+        gb.display.printf(0, 2 + (i - first) * LINE_HEIGHT, "%s", text);
+    }
+
+}
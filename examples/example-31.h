@@ -0,0 +1,265 @@
+/**
+ * ----------------------------------------------------------------------------
+ * Handling images on the Gamebuino META
+ * © 2021 Stéphane Calderoni
+ * ----------------------------------------------------------------------------
+ * Requires, in config-gamebuino.h:
+ *
+ *   #define DISPLAY_CONSTRUCTOR Image(0, 0, ColorMode::rgb565)
+ *
+ * This sketch sends its bands of lines to the screen itself and never uses
+ * gb.display. With the default display, gb.waitForUpdate() pushes its 80x64
+ * framebuffer over the bands on every frame, and the framebuffer keeps its
+ * 10 KB of RAM. Remove the line again for the other examples.
+ * ----------------------------------------------------------------------------
+ */
+
+#include <Gamebuino-Meta.h>
+#include "../assets/rgb565.h"
+#include "../gfx/animation.h"
+#include "../gfx/strip.h"
+
+// example-16 on the full 160x128 screen in RGB565: the draws of a frame are
+// recorded by a gfx::StripRenderer, which composes the screen 8 lines at a
+// time and sends each band to the screen itself, in about 4 KB of RAM
+// instead of the 40 KB of a full framebuffer (see the requirement above)
+
+// ----------------------------------------------------------------------------
+// Global constants
+// ----------------------------------------------------------------------------
+
+const uint8_t SCREEN_WIDTH  = 160;
+const uint8_t SCREEN_HEIGHT = 128;
+
+const uint8_t AVATAR_WIDTH  = SPRITE_DATA[0];
+const uint8_t AVATAR_HEIGHT = SPRITE_DATA[1];
+const uint8_t AVATAR_FRAMES = sizeof(SPRITE_FRAMES);
+
+const uint8_t TILE_WIDTH  = TILESET_DATA[0];
+const uint8_t TILE_HEIGHT = TILESET_DATA[1];
+
+const uint8_t TILES_WIDE = SCREEN_WIDTH  / TILE_WIDTH;
+const uint8_t TILES_HIGH = SCREEN_HEIGHT / TILE_HEIGHT;
+
+const uint8_t Y_GROUND = SCREEN_HEIGHT - 2*TILE_HEIGHT;
+
+const uint8_t TILEMAP[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3
+};
+
+const int16_t TORCHES[] = { 12, 60, 92, 140 };
+
+const uint8_t ANIMATION_FPS = 32;
+
+const int8_t AVATAR_SPEED =  2;
+const int8_t AVATAR_JUMP  = -5;
+
+const int8_t GRAVITY = 1;
+
+// ----------------------------------------------------------------------------
+// Definition of the object-oriented model of the avatar
+// ----------------------------------------------------------------------------
+
+struct Avatar {
+
+    int16_t x, y;
+    int8_t  vx, vy;
+    uint8_t frame;
+    int8_t  direction;
+    bool    jumping;
+
+    Avatar(int16_t x, int16_t y) : x(x), y(y), vx(0), vy(0), frame(0), direction(1), jumping(false) {}
+
+    void moveToLeft() {
+        vx = - AVATAR_SPEED;
+        direction = -1;
+    }
+
+    void moveToRight() {
+        vx = AVATAR_SPEED;
+        direction = 1;
+    }
+
+    void stop() {
+        vx = 0;
+        vy = 0;
+        frame = 0;
+        jumping = false;
+    }
+
+    void jump() {
+        vy = AVATAR_JUMP;
+        jumping = true;
+    }
+
+    void update() {
+
+        x += vx;
+        y += vy;
+
+        if (jumping) {
+            
+            frame = 3;
+            
+        } else if (vx && (gb.frameCount & 0x1)) {
+            
+            ++frame %= AVATAR_FRAMES;
+            
+        }
+
+    }
+
+    void draw();
+
+};
+
+// ----------------------------------------------------------------------------
+// Global variables
+// ----------------------------------------------------------------------------
+
+constexpr gfx::Sprite AVATAR(SPRITE_DATA);
+constexpr gfx::Sprite TORCH(TORCH_DATA);
+
+gfx::TileMap         tilemap(TILESET_DATA, TILEMAP, TILES_WIDE, TILES_HIGH);
+gfx::AnimationPlayer torch(TORCH_DATA, ANIMATION_FPS);
+gfx::StripRenderer<> strips;
+
+Avatar avatar(.5*(SCREEN_WIDTH - AVATAR_WIDTH), Y_GROUND - AVATAR_HEIGHT);
+
+// ----------------------------------------------------------------------------
+// Graphics rendering
+// ----------------------------------------------------------------------------
+
+void drawTilemap() {
+    strips.tilemap(tilemap);
+}
+
+void drawTorches() {
+    uint16_t frame = torch.update(millis());
+    for (int16_t x : TORCHES) strips.sprite(x, 6, TORCH, frame);
+}
+
+void Avatar::draw() {
+    strips.sprite(x, y, AVATAR, SPRITE_FRAMES[frame], direction < 0 ? gfx::FLIP_X : gfx::FLIP_NONE);
+}
+
+// Sends a band of lines to the screen, which takes its words big-endian.
+// The transfer runs by DMA and must be over before the band is reused.
+void sendToScreen(uint16_t *pixels, int16_t top, int16_t lines) {
+
+    for (uint16_t i=0; i<SCREEN_WIDTH*lines; ++i) pixels[i] = pixels[i] << 8 | pixels[i] >> 8;
+
+    gb.tft.setAddrWindow(0, top, SCREEN_WIDTH - 1, top + lines - 1);
+    SPI.beginTransaction(tftSPISettings);
+    gb.tft.dataMode();
+    gb.tft.sendBuffer(pixels, SCREEN_WIDTH * lines);
+    wait_for_transfers_done();
+    gb.tft.idleMode();
+    SPI.endTransaction();
+
+}
+
+// ----------------------------------------------------------------------------
+// Handling user input
+// ----------------------------------------------------------------------------
+
+void readUserInput() {
+
+    if (gb.buttons.repeat(BUTTON_LEFT, 0)) {
+
+        avatar.moveToLeft();
+
+    } else if (gb.buttons.repeat(BUTTON_RIGHT, 0)) {
+
+        avatar.moveToRight();
+
+    } else if (gb.buttons.released(BUTTON_LEFT) || gb.buttons.released(BUTTON_RIGHT)) {
+
+        if (!avatar.jumping) avatar.stop();
+
+    }
+
+    if (gb.buttons.pressed(BUTTON_A) && !avatar.jumping) {
+
+        avatar.jump();
+
+    }
+
+}
+
+// ----------------------------------------------------------------------------
+// Handling physical constraints of the game scene
+// ----------------------------------------------------------------------------
+
+void updateGame() {
+
+    if (avatar.x < 0) {
+
+        avatar.x = 0;
+
+    } else if (avatar.x + AVATAR_WIDTH > SCREEN_WIDTH ) {
+
+        avatar.x = SCREEN_WIDTH - AVATAR_WIDTH;
+
+    }
+
+    if (avatar.jumping) {
+
+        avatar.vy += GRAVITY;
+
+        if (avatar.y + AVATAR_HEIGHT > Y_GROUND) {
+
+            avatar.stop();
+            avatar.y = Y_GROUND - AVATAR_HEIGHT;
+
+        }
+
+    }
+
+}
+
+// ----------------------------------------------------------------------------
+// Initialization
+// ----------------------------------------------------------------------------
+
+void setup() {
+
+    gb.begin();
+    gb.setFrameRate(32);
+
+}
+
+// ----------------------------------------------------------------------------
+// Main control loop
+// ----------------------------------------------------------------------------
+
+void loop() {
+
+    gb.waitForUpdate();
+
+    readUserInput();
+    avatar.update();
+    updateGame();
+    
+    drawTilemap();
+    drawTorches();
+    avatar.draw();
+
+    strips.render(sendToScreen);
+
+}
\ No newline at end of file
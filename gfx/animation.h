@@ -0,0 +1,171 @@
+/**
+ * ----------------------------------------------------------------------------
+ * Handling images on the Gamebuino META
+ * © 2021 Stéphane Calderoni
+ * ----------------------------------------------------------------------------
+ * Frame animation driven by elapsed time
+ * ----------------------------------------------------------------------------
+ * The frame loop of an image header tells drawImage to move on to the next
+ * frame every `loop` rendered frames, and sketches that pick the frames
+ * themselves count rendered frames too (`gb.frameCount & 0x1`): lowering the
+ * frame rate, or dropping frames under load, slows the animations down.
+ *
+ * An AnimationPlayer reads the frame count and the frame loop of an asset,
+ * turns the loop into a duration with the frame rate the asset was designed
+ * for, and advances on the milliseconds elapsed between two updates:
+ *
+ *   gfx::AnimationPlayer torch(TORCH_DATA, 32); // 2 frames at 32 fps: 62.5 ms
+ *   ...
+ *   gfx::drawSprite(gb.display, x, y, TORCH, torch.update(millis()));
+ *
+ * A Clip plays a range of frames once (holding the last one), in a loop, or
+ * back and forth. Clips are plain constants, named after what they show:
+ *
+ *   const gfx::Clip WALK = { 0, 4, gfx::PLAY_LOOP, 2 };
+ *   const gfx::Clip JUMP = { 3, 1, gfx::PLAY_ONCE, 0 };
+ *
+ * The frame loop of a clip, in rendered frames at the design frame rate,
+ * overrides the one of the asset when it is not 0. A frame loop of 0 on
+ * both holds the first frame of the clip, as drawImage does.
+ *
+ * Durations are kept in 1/16 ms, so that the frame periods of the usual
+ * frame rates (31.25 ms at 32 fps) are exact, and the elapsed time is
+ * accumulated between updates rather than measured from the start of the
+ * clip, which keeps the player free of overflows however long it runs.
+ * ----------------------------------------------------------------------------
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+namespace gfx {
+
+    enum PlayMode : uint8_t {
+        PLAY_ONCE,     // stops on the last frame
+        PLAY_LOOP,     // starts over after the last frame
+        PLAY_PING_PONG // goes back to the first frame, then forth again
+    };
+
+    struct Clip {
+        uint16_t first; // first frame of the range
+        uint16_t count; // number of frames
+        uint8_t  mode;
+        uint8_t  loop;  // 0: frame loop of the asset
+    };
+
+    class AnimationPlayer {
+
+        private:
+
+            const Clip *_clip;
+            Clip        _sheet; // every frame of the asset, in a loop
+            uint16_t    _loop;  // frame loop of the asset
+            uint8_t     _fps;
+            uint32_t    _period; // of the current clip, in 1/16 ms
+            uint32_t    _elapsed; // since the current frame was reached, in 1/16 ms
+            uint32_t    _last;  // time of the last update, in ms
+            uint16_t    _step;  // frames played since the start of the clip
+            bool        _started;
+
+            // Steps before a looping clip starts over: there and back for
+            // ping-pong, the end frames being shown once per round.
+            uint16_t steps() const {
+                uint16_t n = _clip->count;
+                return _clip->mode == PLAY_PING_PONG ? 2 * (n - 1) : n;
+            }
+
+            void start(const Clip &clip) {
+                uint16_t loop = clip.loop ? clip.loop : _loop;
+                _clip    = &clip;
+                _period  = (uint32_t)loop * 16000 / _fps;
+                _elapsed = 0;
+                _step    = 0;
+                _started = false;
+            }
+
+        public:
+
+            // `fps` is the frame rate the frame loops were designed for.
+            AnimationPlayer(uint16_t frames, uint16_t loop, uint8_t fps)
+            : _sheet{ 0, frames, PLAY_LOOP, 0 }
+            , _loop(loop)
+            , _fps(fps)
+            , _last(0) {
+                start(_sheet);
+            }
+
+            // RGB565 asset
+            AnimationPlayer(const uint16_t *data, uint8_t fps)
+            : AnimationPlayer(data[2], data[3], fps) {}
+
+            // Indexed asset
+            AnimationPlayer(const uint8_t *data, uint8_t fps)
+            : AnimationPlayer(data[2] | data[3] << 8, data[4], fps) {}
+
+            AnimationPlayer(const AnimationPlayer &) = delete;
+            AnimationPlayer &operator=(const AnimationPlayer &) = delete;
+
+            // Switches to another clip, from its first frame on, the next
+            // update giving its start time. Playing the clip already playing
+            // does nothing, so that it may be called on every frame.
+            void play(const Clip &clip) {
+                if (&clip != _clip) start(clip);
+            }
+
+            void restart() {
+                start(*_clip);
+            }
+
+            // Moves on by the time elapsed since the previous update, `now`
+            // being given in ms (millis()), and returns the current frame.
+            uint16_t update(uint32_t now) {
+
+                if (!_started) {
+                    _last    = now;
+                    _started = true;
+                }
+
+                uint32_t delta = now - _last;
+                _last = now;
+
+                if (!_period || _clip->count < 2 || finished()) return frame();
+
+                _elapsed += delta << 4;
+
+                if (_elapsed >= _period) {
+
+                    uint32_t n = _elapsed / _period;
+                    _elapsed  -= n * _period;
+
+                    if (_clip->mode == PLAY_ONCE) {
+                        _step = n < _clip->count - 1u - _step ? _step + n : _clip->count - 1;
+                    } else {
+                        _step = (_step + n) % steps();
+                    }
+
+                }
+
+                return frame();
+
+            }
+
+            // Frame of the asset for the current step of the clip.
+            uint16_t frame() const {
+                uint16_t n = _clip->count;
+                uint16_t i = _step < n ? _step : 2 * (n - 1) - _step;
+                return _clip->first + i;
+            }
+
+            // Whether a PLAY_ONCE clip has reached its last frame.
+            bool finished() const {
+                return _clip->mode == PLAY_ONCE && _step + 1u >= _clip->count;
+            }
+
+            const Clip &clip() const {
+                return *_clip;
+            }
+
+    };
+
+}
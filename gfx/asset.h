@@ -0,0 +1,138 @@
+/**
+ * ----------------------------------------------------------------------------
+ * Handling images on the Gamebuino META
+ * © 2021 Stéphane Calderoni
+ * ----------------------------------------------------------------------------
+ * Compile-time asset descriptors and size-specialized blitters
+ * ----------------------------------------------------------------------------
+ * tools/asset-compiler emits, into assets/descriptors.h, one descriptor type
+ * per RGB565 asset, carrying the metadata of the array as template
+ * parameters:
+ *
+ *   typedef gfx::Asset<SPRITE_DATA, 8, 8, 3, 0xf81f, 0> SPRITE_ASSET;
+ *
+ *   const uint8_t AVATAR_WIDTH = SPRITE_ASSET::width;
+ *   gfx::drawAsset<SPRITE_ASSET>(gb.display, x, y, frame, flip);
+ *
+ * Since the size of the frames is known at compile time, `drawAsset` picks a
+ * fully unrolled row kernel for frames of up to 16 pixels wide, which covers
+ * the 8x8, 16x8 and 8x16 sizes shipped with the examples, and a plain loop
+ * beyond. The kernel runs on the whole frame when it lies entirely within
+ * the target, with no clipping test at all, mirrored or not: the mirrored
+ * kernel reads the row backwards with the same unrolled code. Partly visible
+ * frames go through the clipped path of gfx::drawSprite.
+ *
+ * The unclipped path trusts the parameters of the descriptor, so each one is
+ * followed by a static_assert checking them against the header of its array:
+ *
+ *   static_assert(gfx::validAsset<SPRITE_ASSET>(), "...");
+ * ----------------------------------------------------------------------------
+ */
+
+#pragma once
+
+#include "sprite.h"
+
+namespace gfx {
+
+    template <const uint16_t *DATA, int16_t W, int16_t H, uint16_t FRAMES, uint16_t KEY, uint8_t MODE>
+    struct Asset {
+
+        static constexpr const uint16_t *data        = DATA;
+        static constexpr int16_t         width       = W;
+        static constexpr int16_t         height      = H;
+        static constexpr uint16_t        frames      = FRAMES;
+        static constexpr uint16_t        transparent = KEY;
+        static constexpr uint8_t         colorMode   = MODE;
+
+        static const uint16_t *frame(uint16_t f) {
+            return DATA + 6 + checkedFrame(f, FRAMES) * W * H;
+        }
+
+    };
+
+    // Whether the parameters of a descriptor match the header of its array.
+    template <typename A>
+    constexpr bool validAsset() {
+        return A::width == A::data[0] && A::height == A::data[1] && A::frames == A::data[2]
+            && A::transparent == A::data[4] && A::colorMode == A::data[5];
+    }
+
+    namespace kernel {
+
+        // Pixel I of a row of N pixels, then the next ones.
+        template <int16_t I, int16_t N, bool FLIP>
+        struct UnrolledRow {
+
+            __attribute__((always_inline))
+            static inline void draw(uint16_t *dst, const uint16_t *src, uint16_t key, uint32_t &written) {
+                uint16_t c = src[FLIP ? N - 1 - I : I];
+                if (c != key) { dst[I] = c; ++written; }
+                UnrolledRow<I + 1, N, FLIP>::draw(dst, src, key, written);
+            }
+
+        };
+
+        template <int16_t N, bool FLIP>
+        struct UnrolledRow<N, N, FLIP> {
+
+            __attribute__((always_inline))
+            static inline void draw(uint16_t *, const uint16_t *, uint16_t, uint32_t &) {}
+
+        };
+
+        template <int16_t N, bool FLIP>
+        struct LoopRow {
+
+            static inline void draw(uint16_t *dst, const uint16_t *src, uint16_t key, uint32_t &written) {
+                for (int16_t i=0; i<N; ++i) {
+                    uint16_t c = src[FLIP ? N - 1 - i : i];
+                    if (c != key) { dst[i] = c; ++written; }
+                }
+            }
+
+        };
+
+        template <int16_t N, bool FLIP, bool UNROLL = (N <= 16)>
+        struct Row : UnrolledRow<0, N, FLIP> {};
+
+        template <int16_t N, bool FLIP>
+        struct Row<N, FLIP, false> : LoopRow<N, FLIP> {};
+
+        template <class A, bool FLIP>
+        inline void drawFrame(uint16_t *dst, int16_t stride, const uint16_t *src, int16_t step, uint32_t &written) {
+            for (int16_t j=0; j<A::height; ++j, dst+=stride, src+=step) {
+                Row<A::width, FLIP>::draw(dst, src, A::transparent, written);
+            }
+        }
+
+    }
+
+    template <class A>
+    inline void drawAsset(Surface target, int16_t x, int16_t y, uint16_t frame = 0, uint8_t flip = FLIP_NONE) {
+
+        static_assert(A::colorMode == 0, "only RGB565 assets can be drawn by gfx::drawAsset");
+
+        if (x < 0 || y < 0 || x + A::width > target.width || y + A::height > target.height) {
+            drawSprite(target, x, y, Sprite(A::data), frame, flip);
+            return;
+        }
+
+        uint16_t       *dst     = target.row(y) + x;
+        const uint16_t *src     = A::frame(frame);
+        int16_t         step    = A::width;
+        uint32_t        written = 0;
+
+        if (flip & FLIP_Y) {
+            src += (A::height - 1) * A::width;
+            step = -step;
+        }
+
+        if (flip & FLIP_X) kernel::drawFrame<A, true>(dst, target.width, src, step, written);
+        else               kernel::drawFrame<A, false>(dst, target.width, src, step, written);
+
+        GFX_COUNT_PIXELS(written);
+
+    }
+
+}
@@ -0,0 +1,88 @@
+/**
+ * ----------------------------------------------------------------------------
+ * Handling images on the Gamebuino META
+ * © 2021 Stéphane Calderoni
+ * ----------------------------------------------------------------------------
+ * Frames packed into a single RGB565 atlas, drawn by region id
+ * ----------------------------------------------------------------------------
+ * The `atlas` option of artwork/assets.cfg makes tools/asset-compiler pack
+ * the frames of the assets that carry it into one image, ATLAS_DATA in
+ * assets/atlas.h, identical frames being stored once. Next to it come:
+ *
+ *   ATLAS_FRAMES   position of every frame in the atlas
+ *   ATLAS_REGIONS  size, frame count, frame loop and first entry in
+ *                  ATLAS_FRAMES of each asset
+ *   an enum naming the regions (SPRITE_DATA -> ATLAS_SPRITE...)
+ *   ATLAS          the gfx::Atlas tying them together
+ *
+ * ATLAS_DATA is a regular one-frame image, so drawImage can still address
+ * its sub-rectangles, but `drawRegion` needs neither an Image nor the
+ * coordinates of the frames:
+ *
+ *   gfx::drawRegion(gb.display, x, y, ATLAS, ATLAS_TORCH, frame);
+ *
+ * The frames of a region follow the order of its sheet, deduplicated or not.
+ * Like frame numbers, a region id past the end of ATLAS_REGIONS falls back
+ * to the first region, unless GFX_TRUSTED_ASSETS is defined.
+ * ----------------------------------------------------------------------------
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include "sprite.h"
+
+namespace gfx {
+
+    struct AtlasFrame {
+        uint16_t x, y;
+    };
+
+    struct AtlasRegion {
+        uint16_t width, height;
+        uint16_t frames;
+        uint16_t loop;  // frame loop of the asset, for the caller to animate
+        uint16_t first; // entry of the first frame in the frame table
+    };
+
+    struct Atlas {
+
+        int16_t            width, height;
+        uint16_t           transparent;
+        const uint16_t    *pixels;
+        const AtlasRegion *regions;
+        uint8_t            regionCount;
+        const AtlasFrame  *frames;
+
+        // The region table is taken as an array, for its size.
+        template <size_t N>
+        constexpr Atlas(const uint16_t *data, const AtlasRegion (&regions)[N], const AtlasFrame *frames)
+        : width(data[0])
+        , height(data[1])
+        , transparent(data[4])
+        , pixels(data + 6)
+        , regions(regions)
+        , regionCount(N)
+        , frames(frames) {
+            static_assert(N <= 256, "region ids are 8-bit");
+        }
+
+        // Region `id`: the first one when out of range, as for the frames.
+        const AtlasRegion &region(uint8_t id) const {
+            return regions[checkedFrame(id, regionCount)];
+        }
+
+        const uint16_t *frame(const AtlasRegion &region, uint16_t f) const {
+            const AtlasFrame &at = frames[region.first + checkedFrame(f, region.frames)];
+            return pixels + at.y * width + at.x;
+        }
+
+    };
+
+    // Draws a frame of a region, mirrored along the axes set in `flip`.
+    inline void drawRegion(Surface target, int16_t x, int16_t y, const Atlas &atlas, uint8_t region, uint16_t frame = 0, uint8_t flip = FLIP_NONE) {
+        const AtlasRegion &r = atlas.region(region);
+        drawPixels(target, x, y, atlas.frame(r, frame), r.width, r.height, atlas.width, atlas.transparent, flip);
+    }
+
+}
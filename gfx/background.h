@@ -0,0 +1,172 @@
+/**
+ * ----------------------------------------------------------------------------
+ * Handling images on the Gamebuino META
+ * © 2021 Stéphane Calderoni
+ * ----------------------------------------------------------------------------
+ * Cached static background with dirty-rectangle restoring
+ * ----------------------------------------------------------------------------
+ * The static part of a scene (typically a tilemap) is drawn once into a cache
+ * surface of the size of the screen. The framebuffer then only needs to be
+ * cleared of what was drawn over it during the previous frame: each moving
+ * sprite marks the rectangle it covers, and the next frame starts by copying
+ * these rectangles back from the cache, instead of clearing the screen and
+ * drawing the whole background again.
+ *
+ *   background.restore(gb.display); // first thing in the frame
+ *   ...
+ *   background.mark(x, y, w, h);    // for each sprite drawn
+ *   gb.display.drawImage(x, y, sprite);
+ *
+ * The framebuffer must keep its content from one frame to the next, which is
+ * the case of `gb.display` as long as it is not cleared. The very first frame,
+ * and any frame following a call to `invalidate()`, restores the whole screen.
+ *
+ * Overlapping or adjacent rectangles are merged, so that no pixel is copied
+ * twice. When more than MAX_RECTS rectangles are marked, the new one is merged
+ * into the rectangle it enlarges the least.
+ * ----------------------------------------------------------------------------
+ */
+
+#pragma once
+
+#include <string.h>
+#include "surface.h"
+
+namespace gfx {
+
+    struct Rect {
+
+        int16_t x, y, w, h;
+
+        int32_t area() const {
+            return (int32_t)w * h;
+        }
+
+        // Overlapping or sharing an edge.
+        bool touches(const Rect &r) const {
+            return x <= r.x + r.w && r.x <= x + w && y <= r.y + r.h && r.y <= y + h;
+        }
+
+        Rect merged(const Rect &r) const {
+            int16_t left   = x < r.x ? x : r.x;
+            int16_t top    = y < r.y ? y : r.y;
+            int16_t right  = x + w > r.x + r.w ? x + w : r.x + r.w;
+            int16_t bottom = y + h > r.y + r.h ? y + h : r.y + r.h;
+            return { left, top, (int16_t)(right - left), (int16_t)(bottom - top) };
+        }
+
+    };
+
+    template <uint8_t MAX_RECTS = 8>
+    class Background {
+
+        private:
+
+            Surface  _cache;
+            Rect     _dirty[MAX_RECTS];
+            uint8_t  _count;
+            bool     _full;
+            uint32_t _restored;
+
+            void add(Rect r) {
+
+                // merging may make the result touch a rectangle it did not
+                // touch before, hence the restart
+                uint8_t i = 0;
+                while (i < _count) {
+                    if (_dirty[i].touches(r)) {
+                        r = _dirty[i].merged(r);
+                        _dirty[i] = _dirty[--_count];
+                        i = 0;
+                    } else {
+                        ++i;
+                    }
+                }
+
+                if (_count < MAX_RECTS) {
+                    _dirty[_count++] = r;
+                    return;
+                }
+
+                uint8_t best   = 0;
+                int32_t growth = INT32_MAX;
+
+                for (uint8_t i=0; i<_count; ++i) {
+                    int32_t g = _dirty[i].merged(r).area() - _dirty[i].area();
+                    if (g < growth) { growth = g; best = i; }
+                }
+
+                _dirty[best] = _dirty[best].merged(r);
+
+            }
+
+        public:
+
+            Background(Surface cache) : _cache(cache), _count(0), _full(true), _restored(0) {}
+
+            // Where the static layer is drawn.
+            Surface cache() const {
+                return _cache;
+            }
+
+            // Restores the whole screen on the next call to `restore()`, e.g.
+            // after the cache has been redrawn.
+            void invalidate() {
+                _full = true;
+            }
+
+            // Declares that the (x, y, w, h) area of the screen is about to be
+            // drawn over, and must be restored at the start of the next frame.
+            void mark(int16_t x, int16_t y, int16_t w, int16_t h) {
+
+                if (_full) return;
+
+                if (x < 0) { w += x; x = 0; }
+                if (y < 0) { h += y; y = 0; }
+                if (x + w > _cache.width)  w = _cache.width  - x;
+                if (y + h > _cache.height) h = _cache.height - y;
+                if (w <= 0 || h <= 0) return;
+
+                add({ x, y, w, h });
+
+            }
+
+            // Copies the areas marked since the last call back from the cache.
+            void restore(Surface target) {
+
+                _restored = 0;
+
+                if (_full) {
+                    _restored = (uint32_t)_cache.width * _cache.height;
+                    memcpy(target.buffer, _cache.buffer, 2 * _restored);
+                    _full  = false;
+                    _count = 0;
+                    GFX_COUNT_PIXELS(_restored);
+                    return;
+                }
+
+                for (uint8_t i=0; i<_count; ++i) {
+
+                    const Rect &r = _dirty[i];
+
+                    for (int16_t y=r.y; y<r.y + r.h; ++y) {
+                        memcpy(target.row(y) + r.x, _cache.row(y) + r.x, 2 * r.w);
+                    }
+
+                    _restored += r.area();
+
+                }
+
+                _count = 0;
+                GFX_COUNT_PIXELS(_restored);
+
+            }
+
+            // Pixels copied by the last call to `restore()`.
+            uint32_t restored() const {
+                return _restored;
+            }
+
+    };
+
+}
@@ -0,0 +1,159 @@
+/**
+ * ----------------------------------------------------------------------------
+ * Handling images on the Gamebuino META
+ * © 2021 Stéphane Calderoni
+ * ----------------------------------------------------------------------------
+ * Deferred sprite draws, sorted by layer, then by sprite and frame
+ * ----------------------------------------------------------------------------
+ * Drawing each sprite as soon as the game code reaches it ties the drawing
+ * order to the structure of the code, and every draw starts over with its
+ * own setup: reading the header of the sprite and locating the pixels of
+ * the frame. A Batch collects the draws of a frame instead, each with a
+ * layer, and renders them all at once:
+ *
+ *   batch.draw(LAYER_DECOR, 12, 6, TORCH, frame); // anywhere in the code
+ *   ...
+ *   batch.flush(gb.display);                      // once per frame
+ *
+ * The draws are sorted by layer, lower layers being drawn first. Within a
+ * layer, a draw is moved ahead of an earlier one to group the draws by
+ * sprite and frame only when their rectangles do not overlap, so that the
+ * picture is the one the calls give layer by layer: overlapping draws of a
+ * layer keep the order of the calls. Consecutive draws of the same frame,
+ * such as repeated tiles or decor elements, form a run whose sprite and
+ * frame pixels are looked up once, each draw of the run only being clipped
+ * at its own position.
+ *
+ * `setups()` and `draws()` tell how many runs and draws the last flush
+ * handled, the difference being the lookups saved by the sorting. In a
+ * scene of a few dozen draws, the sort costs more than these lookups save
+ * (see tools/batch-bench): what a batch buys is the drawing order.
+ *
+ * The sprites are referenced, not copied, and must outlive the flush, which
+ * is the case of the constexpr Sprites declared next to their asset arrays.
+ * ----------------------------------------------------------------------------
+ */
+
+#pragma once
+
+#include "sprite.h"
+
+namespace gfx {
+
+    template <uint8_t CAPACITY = 32>
+    class Batch {
+
+        private:
+
+            struct Draw {
+                const Sprite *sprite;
+                int16_t       x, y;
+                uint16_t      frame;
+                uint8_t       layer;
+                uint8_t       flip;
+            };
+
+            Draw     _draws[CAPACITY];
+            uint8_t  _order[CAPACITY];
+            uint8_t  _count;
+            uint16_t _lastDraws, _lastSetups;
+
+            static bool sameFrame(const Draw &a, const Draw &b) {
+                return a.sprite == b.sprite && a.frame == b.frame;
+            }
+
+            static bool overlap(const Draw &a, const Draw &b) {
+                return a.x < b.x + b.sprite->width  && b.x < a.x + a.sprite->width
+                    && a.y < b.y + b.sprite->height && b.y < a.y + a.sprite->height;
+            }
+
+            // Whether draw k, issued after draw i, may be drawn before it: a
+            // lower layer always goes first; within a layer, draws are grouped
+            // by sprite and frame, but only past the draws they do not cover.
+            bool passes(uint8_t k, uint8_t i) const {
+                const Draw &a = _draws[k], &b = _draws[i];
+                if (a.layer != b.layer)   return a.layer < b.layer;
+                if (sameFrame(a, b))      return false;
+                if (overlap(a, b))        return false;
+                if (a.sprite != b.sprite) return (uintptr_t)a.sprite < (uintptr_t)b.sprite;
+                return a.frame < b.frame;
+            }
+
+            // Insertion sort of the indices from the order of the calls, each
+            // draw moving back as long as it passes its predecessor. Only
+            // draws that may be swapped are ever swapped, so the order of the
+            // calls holds between the overlapping draws of a layer. It costs
+            // up to n^2 / 2 tests, which a few dozen sprites afford.
+            void sort() {
+
+                for (uint8_t i=0; i<_count; ++i) {
+                    uint8_t k = i;
+                    uint8_t j = i;
+                    while (j && passes(k, _order[j - 1])) {
+                        _order[j] = _order[j - 1];
+                        --j;
+                    }
+                    _order[j] = k;
+                }
+
+            }
+
+        public:
+
+            Batch() : _count(0), _lastDraws(0), _lastSetups(0) {}
+
+            // Queues a draw for the next flush, returns false when the batch
+            // is full and the draw is dropped.
+            bool draw(uint8_t layer, int16_t x, int16_t y, const Sprite &sprite, uint16_t frame = 0, uint8_t flip = FLIP_NONE) {
+
+                if (_count == CAPACITY) return false;
+
+                _draws[_count++] = { &sprite, x, y, frame, layer, flip };
+                return true;
+
+            }
+
+            // Draws everything queued since the last flush, and empties the
+            // batch.
+            void flush(Surface target) {
+
+                sort();
+
+                _lastDraws  = _count;
+                _lastSetups = 0;
+
+                for (uint8_t i=0; i<_count; ) {
+
+                    // setup of the run
+                    const Draw     &first  = _draws[_order[i]];
+                    const Sprite   &sprite = *first.sprite;
+                    const uint16_t *pixels = sprite.frame(first.frame);
+                    ++_lastSetups;
+
+                    do {
+                        const Draw &d = _draws[_order[i]];
+                        drawFrame(target, d.x, d.y, sprite, pixels, d.flip);
+                    } while (++i < _count && sameFrame(first, _draws[_order[i]]));
+
+                }
+
+                _count = 0;
+
+            }
+
+            uint8_t pending() const {
+                return _count;
+            }
+
+            // Draws and runs handled by the last flush.
+            uint16_t draws() const {
+                return _lastDraws;
+            }
+
+            uint16_t setups() const {
+                return _lastSetups;
+            }
+
+    };
+
+}
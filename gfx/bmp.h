@@ -0,0 +1,205 @@
+/**
+ * ----------------------------------------------------------------------------
+ * Handling images on the Gamebuino META
+ * © 2021 Stéphane Calderoni
+ * ----------------------------------------------------------------------------
+ * BMP images loaded from the SD card through an RGB565 cache
+ * ----------------------------------------------------------------------------
+ * The first time a BMP is loaded, its bottom-up BGR rows are converted into
+ * the target surface, which is then saved next to it as a sidecar file in
+ * the exact in-memory RGB565 layout (`gamebuino.bmp` -> `gamebuino.565`).
+ * Later loads read the sidecar straight into the surface in one go, as long
+ * as the size and timestamp of the BMP it was made from did not change.
+ *
+ * Layout of a sidecar file (little-endian):
+ *
+ *   "G565", BMP size (u32), BMP date (u16), BMP time (u16),
+ *   width (u16), height (u16), then width x height RGB565 pixels, top-down
+ *
+ * Supported BMP files are uncompressed 24-bit and 32-bit ones, the latter
+ * possibly with the standard BGRA color masks (BI_BITFIELDS, in the header
+ * or right after a 40-byte BITMAPINFOHEADER), whose size matches the target
+ * surface exactly.
+ *
+ * `FileSystem` needs `File open(const char *path, int flags)` and `File`
+ * needs `read`, `write`, `seekSet`, `fileSize`, `getModifyDateTime` and
+ * `close`, as provided by SdFat.
+ * ----------------------------------------------------------------------------
+ */
+
+#pragma once
+
+#include <string.h>
+#include "surface.h"
+
+namespace gfx {
+
+    enum BmpLoad {
+        BMP_FAILED,  // unreadable or unsupported image
+        BMP_DECODED, // converted from the BMP, cache (re)written if enabled
+        BMP_CACHED   // read from an up-to-date sidecar file
+    };
+
+    const uint8_t  BMP_CACHE_HEADER = 16;
+    const uint16_t BMP_MAX_WIDTH    = 160;
+    const uint8_t  BMP_MAX_PATH     = 64;
+
+    struct BmpStamp {
+
+        uint32_t size;
+        uint16_t date, time;
+
+        template <typename File>
+        bool read(File &file) {
+            size = file.fileSize();
+            return file.getModifyDateTime(&date, &time);
+        }
+
+    };
+
+    inline uint16_t bmpLE16(const uint8_t *p) { return p[0] | p[1] << 8; }
+    inline uint32_t bmpLE32(const uint8_t *p) { return (uint32_t)bmpLE16(p) | (uint32_t)bmpLE16(p + 2) << 16; }
+
+    inline void bmpPutLE16(uint8_t *p, uint16_t v) { p[0] = v; p[1] = v >> 8; }
+    inline void bmpPutLE32(uint8_t *p, uint32_t v) { bmpPutLE16(p, v); bmpPutLE16(p + 2, v >> 16); }
+
+    // gamebuino.bmp -> gamebuino.565
+    inline bool bmpCachePath(const char *path, char *cache) {
+
+        size_t      length = strlen(path);
+        const char *dot    = strrchr(path, '.');
+        if (!dot || strchr(dot, '/')) dot = path + length;
+        if ((dot - path) + 5 > BMP_MAX_PATH) return false;
+
+        memcpy(cache, path, dot - path);
+        strcpy(cache + (dot - path), ".565");
+        return true;
+
+    }
+
+    // Converts the BMP rows into the target, which must be of the same size.
+    template <typename File>
+    bool decodeBMP(File &file, Surface target) {
+
+        uint8_t header[66];
+        if (file.read(header, 54) != 54 || header[0] != 'B' || header[1] != 'M') return false;
+
+        uint32_t offset      = bmpLE32(header + 10);
+        uint32_t info        = bmpLE32(header + 14);
+        int32_t  width       = bmpLE32(header + 18);
+        int32_t  height      = bmpLE32(header + 22);
+        uint16_t bpp         = bmpLE16(header + 28);
+        uint32_t compression = bmpLE32(header + 30);
+
+        if (compression == 3) {
+            // the masks end a header of 52 bytes or more, or follow a
+            // 40-byte one; only the standard BGRA layout is supported
+            bool masks = info >= 52 || (info == 40 && offset >= 54 + 12);
+            if (!masks || bpp != 32 || file.read(header + 54, 12) != 12) return false;
+            if (bmpLE32(header + 54) != 0xff0000 || bmpLE32(header + 58) != 0xff00 || bmpLE32(header + 62) != 0xff) return false;
+        } else if (compression != 0) {
+            return false;
+        }
+
+        bool     bottomUp = height > 0;
+        uint16_t rows     = bottomUp ? height : -height;
+        uint8_t  bytes    = bpp / 8;
+        uint16_t stride   = (width * bytes + 3) & ~3;
+
+        if ((bpp != 24 && bpp != 32) || width != target.width || rows != target.height || width > BMP_MAX_WIDTH) return false;
+        if (!file.seekSet(offset)) return false;
+
+        uint8_t line[4 * BMP_MAX_WIDTH];
+
+        for (uint16_t y=0; y<rows; ++y) {
+
+            if (file.read(line, stride) != (int)stride) return false;
+
+            uint16_t      *dst = target.row(bottomUp ? rows - 1 - y : y);
+            const uint8_t *src = line;
+
+            for (int16_t x=0; x<width; ++x, src+=bytes) {
+                *dst++ = (src[2] >> 3) << 11 | (src[1] >> 2) << 5 | src[0] >> 3;
+            }
+
+        }
+
+        return true;
+
+    }
+
+    template <typename FileSystem>
+    bool readBMPCache(FileSystem &fs, const char *sidecar, const BmpStamp &stamp, Surface target) {
+
+        auto file = fs.open(sidecar, O_RDONLY);
+        if (!file) return false;
+
+        uint8_t header[BMP_CACHE_HEADER];
+        int32_t size  = 2 * target.width * target.height;
+        bool    valid = file.read(header, BMP_CACHE_HEADER) == BMP_CACHE_HEADER
+            && !memcmp(header, "G565", 4)
+            && bmpLE32(header +  4) == stamp.size
+            && bmpLE16(header +  8) == stamp.date
+            && bmpLE16(header + 10) == stamp.time
+            && bmpLE16(header + 12) == target.width
+            && bmpLE16(header + 14) == target.height
+            && file.read(target.buffer, size) == size;
+
+        file.close();
+        return valid;
+
+    }
+
+    template <typename FileSystem>
+    bool writeBMPCache(FileSystem &fs, const char *sidecar, const BmpStamp &stamp, Surface target) {
+
+        auto file = fs.open(sidecar, O_WRONLY | O_CREAT | O_TRUNC);
+        if (!file) return false;
+
+        uint8_t header[BMP_CACHE_HEADER];
+        memcpy(header, "G565", 4);
+        bmpPutLE32(header +  4, stamp.size);
+        bmpPutLE16(header +  8, stamp.date);
+        bmpPutLE16(header + 10, stamp.time);
+        bmpPutLE16(header + 12, target.width);
+        bmpPutLE16(header + 14, target.height);
+
+        size_t size    = 2 * target.width * target.height;
+        bool   written = file.write(header, BMP_CACHE_HEADER) == BMP_CACHE_HEADER
+            && file.write(target.buffer, size) == size;
+
+        file.close();
+        return written;
+
+    }
+
+    // Loads `path` into `target`, going through the sidecar cache unless
+    // `cache` is false.
+    template <typename FileSystem>
+    BmpLoad loadBMP(FileSystem &fs, const char *path, Surface target, bool cache = true) {
+
+        char     sidecar[BMP_MAX_PATH];
+        BmpStamp stamp;
+
+        auto bmp = fs.open(path, O_RDONLY);
+        if (!bmp) return BMP_FAILED;
+
+        cache = cache && bmpCachePath(path, sidecar) && stamp.read(bmp);
+
+        if (cache && readBMPCache(fs, sidecar, stamp, target)) {
+            bmp.close();
+            return BMP_CACHED;
+        }
+
+        bool decoded = decodeBMP(bmp, target);
+        bmp.close();
+        if (!decoded) return BMP_FAILED;
+
+        // the BMP is closed first: the SD library only keeps a few files open
+        if (cache) writeBMPCache(fs, sidecar, stamp, target);
+
+        return BMP_DECODED;
+
+    }
+
+}
@@ -0,0 +1,112 @@
+/**
+ * ----------------------------------------------------------------------------
+ * Handling images on the Gamebuino META
+ * © 2021 Stéphane Calderoni
+ * ----------------------------------------------------------------------------
+ * Fixed-point color math on RGB565 values
+ * ----------------------------------------------------------------------------
+ * The SAMD21 has no FPU: scaling a channel by .8f goes through soft-float
+ * conversions and multiplications. The functions below work on integers
+ * only, with the factors given in fixed point:
+ *
+ *   - shade and tint take k / 256 (0 to 256), `fraction(.8f)` giving k at
+ *     compile time;
+ *   - lerp takes t / 32 (0 to 32) and processes the three channels with two
+ *     multiplications, the color being spread into a 32-bits word with gaps
+ *     between the channels (see `spread`).
+ *
+ * Each result is the one of the float computation truncated to the channel
+ * width, e.g. shade(c, k) gives (uint8_t)(k / 256.f * channel) per channel.
+ *
+ * add and multiply are the per-pixel forms of the blend modes of
+ * gfx/blend.h.
+ *
+ * They are all constexpr, so that palette ramps can be computed by the
+ * compiler and stored in flash:
+ *
+ *   constexpr uint16_t RAMP[] = {
+ *       gfx::lerp(DARK, LIGHT, 0), gfx::lerp(DARK, LIGHT, 8),
+ *       gfx::lerp(DARK, LIGHT, 16), gfx::lerp(DARK, LIGHT, 24)
+ *   };
+ * ----------------------------------------------------------------------------
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+namespace gfx {
+
+    constexpr uint8_t red(uint16_t c)   { return c >> 11; }
+    constexpr uint8_t green(uint16_t c) { return (c >> 5) & 0x3f; }
+    constexpr uint8_t blue(uint16_t c)  { return c & 0x1f; }
+
+    // r and b on 5 bits, g on 6 bits.
+    constexpr uint16_t rgb565(uint8_t r, uint8_t g, uint8_t b) {
+        return r << 11 | g << 5 | b;
+    }
+
+    // Fixed-point factor of shade and tint, for constant arguments.
+    constexpr uint16_t fraction(float f) {
+        return f * 256 + .5f;
+    }
+
+    // Every channel multiplied by k / 256.
+    constexpr uint16_t shade(uint16_t c, uint16_t k) {
+        return rgb565(red(c) * k >> 8, green(c) * k >> 8, blue(c) * k >> 8);
+    }
+
+    // Every channel moved towards its maximum by k / 256 of the distance.
+    constexpr uint16_t tint(uint16_t c, uint16_t k) {
+        return rgb565(
+            red(c)   + ((0x1f - red(c))   * k >> 8),
+            green(c) + ((0x3f - green(c)) * k >> 8),
+            blue(c)  + ((0x1f - blue(c))  * k >> 8)
+        );
+    }
+
+    // 00000ggg ggg00000 rrrrr000 000bbbbb: 5 free bits above each channel,
+    // enough for a product by a factor up to 32 and the sum of two of them.
+    constexpr uint32_t spread(uint16_t c) {
+        return (c | (uint32_t)c << 16) & 0x07e0f81f;
+    }
+
+    constexpr uint16_t pack(uint32_t s) {
+        return (s & 0xf81f) | (s >> 16 & 0x07e0);
+    }
+
+    // a + (b - a) * t / 32 on every channel.
+    constexpr uint16_t lerp(uint16_t a, uint16_t b, uint8_t t) {
+        return pack((spread(a) * (32 - t) + spread(b) * t) >> 5 & 0x07e0f81f);
+    }
+
+    // Mean of a and b on every channel, the low bits of the channels being
+    // dropped before the shift so that they don't spill into their neighbour.
+    constexpr uint16_t blend(uint16_t a, uint16_t b) {
+        return (a & b) + (((a ^ b) & 0xf7de) >> 1);
+    }
+
+    constexpr uint8_t saturate(uint8_t v, uint8_t max) {
+        return v > max ? max : v;
+    }
+
+    // Sum of a and b on every channel, saturated.
+    constexpr uint16_t add(uint16_t a, uint16_t b) {
+        return rgb565(
+            saturate(red(a)   + red(b),   0x1f),
+            saturate(green(a) + green(b), 0x3f),
+            saturate(blue(a)  + blue(b),  0x1f)
+        );
+    }
+
+    // Product of the channels of a and b, the maximum standing for 1: white
+    // leaves a unchanged and black gives black.
+    constexpr uint16_t multiply(uint16_t a, uint16_t b) {
+        return rgb565(
+            red(a)   * (red(b)   + 1) >> 5,
+            green(a) * (green(b) + 1) >> 6,
+            blue(a)  * (blue(b)  + 1) >> 5
+        );
+    }
+
+}
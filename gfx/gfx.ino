@@ -0,0 +1 @@
+// This empty sketch file is only used to open the `gfx` folder with the Arduino IDE
\ No newline at end of file
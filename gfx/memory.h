@@ -0,0 +1,232 @@
+/**
+ * ----------------------------------------------------------------------------
+ * Handling images on the Gamebuino META
+ * © 2021 Stéphane Calderoni
+ * ----------------------------------------------------------------------------
+ * Flash and RAM accounting of the assets and images of a sketch
+ * ----------------------------------------------------------------------------
+ * gb.getFreeRam() tells how much RAM is left, not what holds the rest. A
+ * MemoryLedger keeps a named entry for every array in flash and every buffer
+ * in RAM it is told about, and the highest RAM they have held together:
+ *
+ *   gfx::MemoryLedger<24> ledger;
+ *   ...
+ *   ledger.flash("SPRITE_DATA", SPRITE_DATA);  // sizeof the array
+ *   ledger.image("display", gb.display);      // getBufferSize() of the Image
+ *   ledger.image("gamebuino.bmp", image);      // loaded from the SD card
+ *
+ * Every generated header of assets/ opens with an X-macro naming its arrays
+ * (RGB565_ASSETS, INDEXED_ASSETS..., DISPLAY_ASSETS for the variant chosen by
+ * assets/display.h), which registers them all at once:
+ *
+ *   #define REGISTER(NAME) ledger.flash(#NAME, NAME);
+ *   DISPLAY_ASSETS(REGISTER)
+ *
+ * The size of an Image is read whenever the ledger is, so that buffers
+ * allocated after the registration, like the one of gb.display in
+ * gb.begin(), are accounted for. Only the Images whose buffer lives in RAM
+ * must be registered: one built over a flash array holds no RAM. An Image
+ * going out of scope is released, its bytes being kept in the peak.
+ *
+ * `sample(gb.getFreeRam())` once per frame also keeps the lowest free RAM
+ * seen, which accounts for the stack and the allocations of the library.
+ *
+ * The report is handed out line by line, 20 characters each (the width of
+ * the screen in the low resolution modes), to be printed on the screen, over
+ * the serial port or into a file:
+ *
+ *   char text[24];
+ *   for (uint8_t i=0; ledger.line(i, text, sizeof(text)); ++i) SerialUSB.println(text);
+ * ----------------------------------------------------------------------------
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+namespace gfx {
+
+    enum MemoryKind : uint8_t {
+        MEMORY_FLASH,
+        MEMORY_RAM
+    };
+
+    struct MemoryEntry {
+
+        const char *name;
+        const void *object;
+        uint32_t  (*measure)(const void *object); // bytes of an Image, read on demand
+        uint32_t    size;                          // bytes of an array
+        uint8_t     kind;
+
+        uint32_t bytes() const {
+            return measure ? measure(object) : size;
+        }
+
+    };
+
+    // getBufferSize() is not const in the library.
+    template <typename Image>
+    uint32_t imageBytes(const void *image) {
+        return const_cast<Image*>(static_cast<const Image*>(image))->getBufferSize();
+    }
+
+    template <uint8_t CAPACITY = 32>
+    class MemoryLedger {
+
+        private:
+
+            MemoryEntry _entries[CAPACITY];
+            uint8_t     _count;
+            uint8_t     _dropped; // registrations beyond the capacity
+            uint32_t    _peak;
+            uint32_t    _lowestFree;
+
+            bool add(const char *name, const void *object, uint32_t (*measure)(const void*), uint32_t size, uint8_t kind) {
+
+                if (_count == CAPACITY) {
+                    ++_dropped;
+                    return false;
+                }
+
+                _entries[_count++] = { name, object, measure, size, kind };
+                update();
+                return true;
+
+            }
+
+            // `n`th entry of the given kind
+            const MemoryEntry &nth(uint8_t kind, uint8_t n) const {
+                uint8_t e = 0;
+                for (;; ++e) {
+                    if (_entries[e].kind == kind && !n--) break;
+                }
+                return _entries[e];
+            }
+
+            static bool print(char *text, size_t size, const char *name, uint32_t bytes) {
+                snprintf(text, size, "%-13.13s %6lu", name, (unsigned long)bytes);
+                return true;
+            }
+
+            void update() {
+                uint32_t held = total(MEMORY_RAM);
+                if (held > _peak) _peak = held;
+            }
+
+        public:
+
+            MemoryLedger() : _count(0), _dropped(0), _peak(0), _lowestFree(~0u) {}
+
+            MemoryLedger(const MemoryLedger &) = delete;
+            MemoryLedger &operator=(const MemoryLedger &) = delete;
+
+            // The registrations return false when the ledger is full and the
+            // entry is dropped, which the report tells.
+
+            // Array in flash, such as the generated asset arrays.
+            template <typename T, size_t N>
+            bool flash(const char *name, const T (&data)[N]) {
+                return add(name, data, NULL, sizeof(data), MEMORY_FLASH);
+            }
+
+            // Array in RAM, such as a palette or a buffer of the sketch.
+            template <typename T, size_t N>
+            bool ram(const char *name, const T (&data)[N]) {
+                return add(name, data, NULL, sizeof(data), MEMORY_RAM);
+            }
+
+            // Image with a buffer in RAM: sized like a blank image or loaded
+            // from the SD card, or the display.
+            template <typename Image>
+            bool image(const char *name, Image &image) {
+                return add(name, &image, &imageBytes<Image>, 0, MEMORY_RAM);
+            }
+
+            // Removes the entry of an object about to be freed.
+            void release(const void *object) {
+
+                update();
+
+                for (uint8_t i=0; i<_count; ++i) {
+                    if (_entries[i].object != object) continue;
+                    for (--_count; i<_count; ++i) _entries[i] = _entries[i + 1];
+                    return;
+                }
+
+            }
+
+            // Once per frame, with gb.getFreeRam().
+            void sample(uint32_t freeRam) {
+                update();
+                if (freeRam < _lowestFree) _lowestFree = freeRam;
+            }
+
+            uint8_t count() const {
+                return _count;
+            }
+
+            const MemoryEntry &entry(uint8_t i) const {
+                return _entries[i];
+            }
+
+            uint32_t total(uint8_t kind) const {
+                uint32_t bytes = 0;
+                for (uint8_t i=0; i<_count; ++i) {
+                    if (_entries[i].kind == kind) bytes += _entries[i].bytes();
+                }
+                return bytes;
+            }
+
+            // Highest RAM held by the registered entries together, as of the
+            // last registration, release or sample.
+            uint32_t peak() const {
+                return _peak;
+            }
+
+            // ~0 until sampled.
+            uint32_t lowestFree() const {
+                return _lowestFree;
+            }
+
+            uint8_t dropped() const {
+                return _dropped;
+            }
+
+            // Line `i` of the report: the flash entries and their total, the
+            // RAM entries, their total and the peak, then the lowest free RAM
+            // once sampled and the dropped entries if any. Returns false past
+            // the last line.
+            bool line(uint8_t i, char *text, size_t size) const {
+
+                uint8_t counts[2] = { 0, 0 };
+                for (uint8_t e=0; e<_count; ++e) ++counts[_entries[e].kind];
+
+                for (uint8_t kind=MEMORY_FLASH; kind<=MEMORY_RAM; ++kind) {
+
+                    if (!counts[kind] && (kind == MEMORY_FLASH || !_peak)) continue;
+
+                    if (i < counts[kind]) {
+                        const MemoryEntry &e = nth(kind, i);
+                        return print(text, size, e.name, e.bytes());
+                    }
+
+                    i -= counts[kind];
+                    if (i == 0) return print(text, size, kind == MEMORY_FLASH ? "flash" : "ram", total(kind));
+                    if (kind == MEMORY_RAM && i == 1) return print(text, size, "peak", _peak);
+                    i -= kind == MEMORY_FLASH ? 1 : 2;
+
+                }
+
+                if (_lowestFree != ~0u && i-- == 0) return print(text, size, "free min", _lowestFree);
+                if (_dropped && i == 0)             return print(text, size, "dropped", _dropped);
+
+                return false;
+
+            }
+
+    };
+
+}
@@ -0,0 +1,308 @@
+/**
+ * ----------------------------------------------------------------------------
+ * Handling images on the Gamebuino META
+ * © 2021 Stéphane Calderoni
+ * ----------------------------------------------------------------------------
+ * Frame time profiler: per-phase timings, on-screen overlay and dumps
+ * ----------------------------------------------------------------------------
+ * The frame rate tells when loop() takes too long, not which part of it. A
+ * Profiler times the phases a sketch names, and keeps the timings of the
+ * last FRAMES frames in a ring buffer, allocated with it:
+ *
+ *   enum Phase { PHASE_INPUT, PHASE_TILEMAP, ... };
+ *   const char *PHASES[] = { "input", "tilemap", ... };
+ *
+ *   gfx::Profiler<2> profiler(PHASES, micros);
+ *
+ *   void loop() {
+ *       gb.waitForUpdate();
+ *       profiler.frame();                          // closes the previous one
+ *       {
+ *           gfx::Profiler<2>::Scope scope(profiler, PHASE_TILEMAP);
+ *           drawTilemap();
+ *       }
+ *       ...
+ *   }
+ *
+ * A phase entered several times in a frame adds up. Phases are not meant to
+ * nest: the time of an inner phase would be counted in the outer one too.
+ * Timings are kept in µs, from the clock given to the constructor, and a
+ * phase saturates at 65535 µs. The time of a frame runs from `frame()` to
+ * the end of its last phase, so that the wait for the next frame is not part
+ * of it, while the work done between the phases is.
+ *
+ * `average(phase)` and `averageFrame()` are rolling averages over the frames
+ * in the ring, `worst()` is the longest of them. `drawProfile` shows them on
+ * top of the picture, a bar per phase giving its share of the average frame
+ * and the bar of the frame its share of the budget:
+ *
+ *   gfx::drawProfile<gfx::Surface>(gb.display, profiler, 1000000 / 32);
+ *
+ * `csv(i, ...)` hands out the ring as CSV lines, oldest frame first, for the
+ * serial port or, in the host build, the file given to the runner with -S.
+ * Rows are numbered from the first frame recorded, so that dumping the ring
+ * every FRAMES frames writes every frame exactly once.
+ * ----------------------------------------------------------------------------
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include "surface.h"
+
+namespace gfx {
+
+    template <uint8_t PHASES, uint8_t FRAMES = 32>
+    class Profiler {
+
+        private:
+
+            const char *const *_names;
+            uint32_t         (*_clock)();
+
+            uint16_t _times[FRAMES][PHASES]; // µs
+            uint32_t _busy[FRAMES];          // µs
+            uint32_t _sums[PHASES];          // over the frames in the ring
+            uint32_t _busySum;
+            uint16_t _current[PHASES];       // frame being timed
+            uint32_t _begin[PHASES];         // clock at the start of each phase
+            uint32_t _frameStart, _lastEnd;
+            uint32_t _recorded;              // frames recorded since the start
+            uint8_t  _head;                  // slot of the next frame recorded
+            bool     _running;
+
+            uint8_t count() const {
+                return _recorded < FRAMES ? _recorded : FRAMES;
+            }
+
+            // Slot of the `i`th frame of the ring, the oldest one first.
+            uint8_t slot(uint8_t i) const {
+                return (_head + FRAMES - count() + i) % FRAMES;
+            }
+
+        public:
+
+            Profiler(const char *const (&names)[PHASES], uint32_t (*clock)())
+            : _names(names), _clock(clock), _busySum(0), _frameStart(0), _lastEnd(0), _recorded(0), _head(0), _running(false) {
+                for (uint8_t p=0; p<PHASES; ++p) _sums[p] = _current[p] = 0;
+            }
+
+            Profiler(const Profiler &) = delete;
+            Profiler &operator=(const Profiler &) = delete;
+
+            // Times a phase from its construction to its destruction.
+            class Scope {
+
+                private:
+
+                    Profiler &_profiler;
+                    uint8_t   _phase;
+
+                public:
+
+                    Scope(Profiler &profiler, uint8_t phase)
+                    : _profiler(profiler), _phase(phase) {
+                        profiler.begin(phase);
+                    }
+
+                    ~Scope() {
+                        _profiler.end(_phase);
+                    }
+
+                    Scope(const Scope &) = delete;
+                    Scope &operator=(const Scope &) = delete;
+
+            };
+
+            // Once per frame, when the work of the frame starts: records the
+            // frame timed so far, if any, and starts the next one.
+            void frame() {
+
+                uint32_t now = _clock();
+
+                if (_running) {
+
+                    uint16_t *times = _times[_head];
+                    uint32_t  busy  = _lastEnd - _frameStart;
+
+                    // the oldest frame leaves a full ring
+                    if (_recorded >= FRAMES) {
+                        for (uint8_t p=0; p<PHASES; ++p) _sums[p] -= times[p];
+                        _busySum -= _busy[_head];
+                    }
+
+                    for (uint8_t p=0; p<PHASES; ++p) {
+                        times[p]    = _current[p];
+                        _sums[p]   += _current[p];
+                        _current[p] = 0;
+                    }
+
+                    _busy[_head] = busy;
+                    _busySum    += busy;
+                    _head        = (_head + 1) % FRAMES;
+                    ++_recorded;
+
+                }
+
+                _frameStart = _lastEnd = now;
+                _running    = true;
+
+            }
+
+            void begin(uint8_t phase) {
+                _begin[phase] = _clock();
+            }
+
+            void end(uint8_t phase) {
+                uint32_t now = _clock();
+                uint32_t t   = _current[phase] + (now - _begin[phase]);
+                _current[phase] = t < 0xffff ? t : 0xffff;
+                _lastEnd = now;
+            }
+
+            uint8_t phases() const {
+                return PHASES;
+            }
+
+            const char *name(uint8_t phase) const {
+                return _names[phase];
+            }
+
+            // Frames in the ring.
+            uint8_t frames() const {
+                return count();
+            }
+
+            uint32_t recorded() const {
+                return _recorded;
+            }
+
+            // Time of a phase in the `i`th frame of the ring, the oldest first.
+            uint16_t time(uint8_t i, uint8_t phase) const {
+                return _times[slot(i)][phase];
+            }
+
+            uint32_t frameTime(uint8_t i) const {
+                return _busy[slot(i)];
+            }
+
+            uint32_t average(uint8_t phase) const {
+                return count() ? _sums[phase] / count() : 0;
+            }
+
+            uint32_t averageFrame() const {
+                return count() ? _busySum / count() : 0;
+            }
+
+            uint32_t worst() const {
+                uint32_t t = 0;
+                for (uint8_t i=0; i<count(); ++i) {
+                    if (frameTime(i) > t) t = frameTime(i);
+                }
+                return t;
+            }
+
+            // CSV line `i`: the names of the columns, then a row per frame of
+            // the ring, the oldest first. Returns false past the last row.
+            bool csv(uint8_t i, char *text, size_t size) const {
+
+                if (i > count() || !size) return false;
+
+                size_t n = 0;
+
+                #define GFX_CSV(...) n += snprintf(text + (n < size ? n : size - 1), n < size ? size - n : 1, __VA_ARGS__)
+
+                if (i == 0) {
+                    GFX_CSV("frame");
+                    for (uint8_t p=0; p<PHASES; ++p) GFX_CSV(",%s", _names[p]);
+                    GFX_CSV(",total");
+                } else {
+                    GFX_CSV("%lu", (unsigned long)(_recorded - count() + i));
+                    for (uint8_t p=0; p<PHASES; ++p) GFX_CSV(",%u", time(i - 1, p));
+                    GFX_CSV(",%lu", (unsigned long)frameTime(i - 1));
+                }
+
+                #undef GFX_CSV
+
+                return true;
+
+            }
+
+    };
+
+    // Colors of the overlay: the phases, then black and white, in RGB565 and
+    // in the default palette.
+    const uint8_t  PROFILE_BLACK = 8;
+    const uint8_t  PROFILE_WHITE = 9;
+    const uint16_t PROFILE_COLORS[10]  = { 0xf809, 0xfd00, 0xff64, 0x0727, 0x2d7f, 0x83b3, 0xfbb5, 0xfe75, 0x0000, 0xffff };
+    const uint8_t  PROFILE_INDICES[10] = { 8, 9, 10, 11, 12, 13, 14, 15, 0, 7 };
+
+    const uint8_t PROFILE_LINE = 6;  // height of a line of the overlay
+    const uint8_t PROFILE_TEXT = 50; // width of its text, 12 characters
+
+    inline void fillProfileRect(Surface target, int16_t x, int16_t y, int16_t w, int16_t h, uint8_t color) {
+        for (int16_t j=0; j<h; ++j) {
+            uint16_t *row = target.row(y + j) + x;
+            for (int16_t i=0; i<w; ++i) row[i] = PROFILE_COLORS[color];
+        }
+        GFX_COUNT_PIXELS(w * h);
+    }
+
+    inline void fillProfileRect(IndexedSurface target, int16_t x, int16_t y, int16_t w, int16_t h, uint8_t color) {
+        for (int16_t j=0; j<h; ++j) {
+            uint8_t *row = target.row(y + j);
+            for (int16_t i=0; i<w; ++i) setNibble(row, x + i, PROFILE_INDICES[color]);
+        }
+        GFX_COUNT_PIXELS(w * h);
+    }
+
+    // Draws the overlay from line `top` of the display, down to its bottom
+    // at most: a line per phase, with its name, its average time in µs and a
+    // bar giving its share of the average frame, then the average frame time
+    // and the worst one, their bars giving their share of `budget` µs (red
+    // past it). The lines are cleared to black, the text is printed in the
+    // current color of the display. `Target` is the Surface or the
+    // IndexedSurface matching the display mode.
+    template <typename Target, typename Display, typename Profiler>
+    void drawProfile(Display &display, const Profiler &profiler, uint32_t budget, int16_t top = 0) {
+
+        Target target(display);
+
+        const int16_t  bar   = target.width - PROFILE_TEXT - 1;
+        const uint32_t frame = profiler.averageFrame();
+        const uint32_t worst = profiler.worst();
+
+        for (uint8_t line=0; line<profiler.phases() + 2; ++line) {
+
+            int16_t y = top + line * PROFILE_LINE;
+            if (y < 0 || y + PROFILE_LINE > target.height) break;
+
+            const char *label;
+            uint32_t    time, scale;
+            uint8_t     color;
+
+            if (line < profiler.phases()) {
+                label = profiler.name(line);
+                time  = profiler.average(line);
+                scale = frame;
+                color = line & 7;
+            } else {
+                label = line == profiler.phases() ? "frame" : "worst";
+                time  = line == profiler.phases() ? frame : worst;
+                scale = budget;
+                color = time > budget ? 0 : PROFILE_WHITE;
+            }
+
+            int16_t w = scale ? (time < scale ? time * bar / scale : bar) : 0;
+
+            fillProfileRect(target, 0, y, target.width, PROFILE_LINE, PROFILE_BLACK);
+            fillProfileRect(target, PROFILE_TEXT, y, w, PROFILE_LINE - 1, color);
+            display.printf(1, y, "%-6.6s%6lu", label, (unsigned long)time);
+
+        }
+
+    }
+
+}
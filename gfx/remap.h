@@ -0,0 +1,92 @@
+/**
+ * ----------------------------------------------------------------------------
+ * Handling images on the Gamebuino META
+ * © 2021 Stéphane Calderoni
+ * ----------------------------------------------------------------------------
+ * Indexed images drawn through a per-draw remap table
+ * ----------------------------------------------------------------------------
+ * Recoloring a sprite by rewriting the palette passed to setPalette between
+ * two drawImage calls works on an RGB565 display only, and makes every draw
+ * depend on the palette state left by the previous ones. The blitters below
+ * take the recoloring as an argument of the draw instead, and leave the
+ * palette of the display alone:
+ *
+ *   - onto an RGB565 target, a 16-entry color table gives the color of each
+ *     index: a copy of the palette with a few entries changed;
+ *   - onto an indexed target, a 16-entry index table replaces each index by
+ *     another one of the display palette.
+ *
+ *   gfx::drawRemapped(gb.display, x, y, SPRITE_DATA, RED_TEAM);
+ *
+ * Pixels of the transparent index of the image are skipped before remapping.
+ * ----------------------------------------------------------------------------
+ */
+
+#pragma once
+
+#include "surface.h"
+
+namespace gfx {
+
+    // Calls write(line, tx, index) for every opaque pixel of the visible part
+    // of the frame, returns the number of pixels written.
+    template <typename Line, typename Target, typename Write>
+    inline uint32_t forEachIndex(Target target, int16_t x, int16_t y, const IndexedFrame &image, Write write) {
+
+        int16_t left   = x < 0 ? -x : 0;
+        int16_t top    = y < 0 ? -y : 0;
+        int16_t right  = x + image.width  > target.width  ? target.width  - x : image.width;
+        int16_t bottom = y + image.height > target.height ? target.height - y : image.height;
+
+        uint32_t written = 0;
+
+        for (int16_t j=top; j<bottom; ++j) {
+
+            const uint8_t *src  = image.pixels + j * image.stride;
+            Line          *line = target.row(y + j);
+
+            for (int16_t i=left; i<right; ++i) {
+                uint8_t index = getNibble(src, i);
+                if (index == image.transparent) continue;
+                write(line, x + i, index);
+                ++written;
+            }
+
+        }
+
+        return written;
+
+    }
+
+    // Indexed image onto an RGB565 target, colors[i] giving the color of
+    // index i (Color or uint16_t entries).
+    template <typename C>
+    inline void drawRemapped(Surface target, int16_t x, int16_t y, const uint8_t *data, const C *colors, uint16_t frame = 0) {
+
+        static_assert(sizeof(C) == 2, "the color table must hold RGB565 colors");
+
+        uint32_t written = forEachIndex<uint16_t>(target, x, y, IndexedFrame(data, frame), [colors](uint16_t *line, int16_t tx, uint8_t index) {
+            line[tx] = (uint16_t)colors[index];
+        });
+
+        GFX_COUNT_PIXELS(written);
+
+    }
+
+    // Indexed image onto an indexed target, index i being drawn as remap[i].
+    inline void drawRemapped(IndexedSurface target, int16_t x, int16_t y, const uint8_t *data, const uint8_t *remap, uint16_t frame = 0) {
+
+        uint32_t written = forEachIndex<uint8_t>(target, x, y, IndexedFrame(data, frame), [remap](uint8_t *line, int16_t tx, uint8_t index) {
+            setNibble(line, tx, remap[index]);
+        });
+
+        GFX_COUNT_PIXELS(written);
+
+    }
+
+    // remap[i] = i, to be edited for the indices to change.
+    inline void identityRemap(uint8_t *remap) {
+        for (uint8_t i=0; i<16; ++i) remap[i] = i;
+    }
+
+}
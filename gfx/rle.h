@@ -0,0 +1,101 @@
+/**
+ * ----------------------------------------------------------------------------
+ * Handling images on the Gamebuino META
+ * © 2021 Stéphane Calderoni
+ * ----------------------------------------------------------------------------
+ * Run-length compressed RGB565 images and their streaming decoder
+ * ----------------------------------------------------------------------------
+ * Layout of a compressed image (uint16_t words):
+ *
+ *   width, height, frames, frame loop, transparent color, color mode (2)
+ *   one offset per frame, counted in words from the start of the array
+ *   (identical frames share the same offset and are stored only once)
+ *   frame data: for each row, tokens covering exactly `width` pixels
+ *
+ * Each token starts with a word holding an opcode in its 2 upper bits and a
+ * pixel count in the 14 lower bits:
+ *
+ *   RLE_SKIP  n          n transparent pixels, nothing follows
+ *   RLE_FILL  n, color   n pixels of the same color
+ *   RLE_COPY  n, c1..cn  n literal pixels
+ *
+ * The decoder expands a frame straight into the target framebuffer, with
+ * clipping, so no staging buffer is ever needed. Transparent runs cost one
+ * word of flash and are skipped without touching the framebuffer.
+ * ----------------------------------------------------------------------------
+ */
+
+#pragma once
+
+#include <string.h>
+#include "surface.h"
+
+namespace gfx {
+
+    const uint16_t RLE_SKIP   = 0x0000;
+    const uint16_t RLE_FILL   = 0x4000;
+    const uint16_t RLE_COPY   = 0x8000;
+    const uint16_t RLE_OPCODE = 0xc000;
+    const uint16_t RLE_COUNT  = 0x3fff;
+
+    const uint16_t RLE_COLOR_MODE = 2;
+    const uint8_t  RLE_HEADER     = 6;
+
+    inline const uint16_t *rleFrame(const uint16_t *data, uint16_t frame) {
+        return data + data[RLE_HEADER + checkedFrame(frame, data[2])];
+    }
+
+    inline void drawRLE(Surface target, int16_t x, int16_t y, const uint16_t *data, uint16_t frame = 0) {
+
+        const int16_t   w     = data[0];
+        const int16_t   h     = data[1];
+        const uint16_t *token = rleFrame(data, frame);
+
+        for (int16_t j=0; j<h; ++j) {
+
+            int16_t ty = y + j;
+            if (ty >= target.height) break;
+
+            bool      visible = ty >= 0;
+            uint16_t *line    = target.row(ty);
+            int16_t   tx      = x;
+            int16_t   end     = x + w;
+
+            while (tx < end) {
+
+                uint16_t op = *token & RLE_OPCODE;
+                int16_t  n  = *token++ & RLE_COUNT;
+
+                if (op == RLE_SKIP) {
+                    tx += n;
+                    continue;
+                }
+
+                const uint16_t *src = token;
+                token += op == RLE_FILL ? 1 : n;
+
+                int16_t x0 = tx;
+                int16_t x1 = tx + n;
+                tx = x1;
+
+                if (!visible) continue;
+                if (x0 < 0) x0 = 0;
+                if (x1 > target.width) x1 = target.width;
+                if (x0 >= x1) continue;
+
+                uint16_t *dst = line + x0;
+
+                if (op == RLE_FILL) {
+                    uint16_t color = *src;
+                    for (int16_t i=x1-x0; i; --i) *dst++ = color;
+                } else {
+                    memcpy(dst, src + (x0 - (tx - n)), (x1 - x0) * sizeof(uint16_t));
+                }
+
+            }
+
+        }
+
+    }
+
+}
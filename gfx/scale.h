@@ -0,0 +1,285 @@
+/**
+ * ----------------------------------------------------------------------------
+ * Handling images on the Gamebuino META
+ * © 2021 Stéphane Calderoni
+ * ----------------------------------------------------------------------------
+ * Sprites stretched by integer factors
+ * ----------------------------------------------------------------------------
+ * `drawScaled` follows the stretching overload of drawImage: the frame is
+ * drawn over a |w| x |h| area, mirrored along the axes whose size is
+ * negative. When both sizes are whole multiples of the frame size, which is
+ * the case of zoomed sprites (2x, 3x, 4x...), no per-pixel division is made:
+ *
+ *   - each source pixel is replicated into a run of `fx` target pixels;
+ *   - the `fy - 1` target rows repeating a source row are not expanded
+ *     again: its opaque runs are copied with memcpy from the row above.
+ *
+ * Other ratios fall back to a generic path mapping every target pixel back
+ * to the source, like drawImage does.
+ *
+ *   gfx::drawScaled(gb.display, x, y, AVATAR, 3 * 8, 3 * 8, frame);
+ *
+ * The indexed overloads draw an indexed asset onto the framebuffer of an
+ * indexed display mode the same way: a source index is replicated into a
+ * run of nibbles, whole bytes set at once, and the repeated rows copy their
+ * opaque runs from the row above. On an RGB565 display, indexed assets are
+ * still stretched by drawImage through the palette.
+ *
+ *   gfx::drawScaled(gfx::IndexedSurface(gb.display), x, y, SPRITE_DATA, 24, 24, frame);
+ * ----------------------------------------------------------------------------
+ */
+
+#pragma once
+
+#include <string.h>
+#include "sprite.h"
+
+namespace gfx {
+
+    // Generic path: one multiplication and division per target pixel.
+    inline void drawStretched(Surface target, int16_t x, int16_t y, const Sprite &sprite, int16_t w, int16_t h, uint16_t frame = 0) {
+
+        const uint16_t *pixels  = sprite.frame(frame);
+        const bool      flipX   = w < 0, flipY = h < 0;
+        const int16_t   aw      = flipX ? -w : w;
+        const int16_t   ah      = flipY ? -h : h;
+        uint32_t        written = 0;
+
+        for (int16_t j=0; j<ah; ++j) {
+
+            int16_t ty = y + j;
+            if (ty < 0 || ty >= target.height) continue;
+
+            const uint16_t *src  = pixels + (int32_t)(flipY ? ah - 1 - j : j) * sprite.height / ah * sprite.width;
+            uint16_t       *line = target.row(ty);
+
+            for (int16_t i=0; i<aw; ++i) {
+
+                int16_t tx = x + i;
+                if (tx < 0 || tx >= target.width) continue;
+
+                uint16_t c = src[(int32_t)(flipX ? aw - 1 - i : i) * sprite.width / aw];
+                if (c != sprite.transparent) { line[tx] = c; ++written; }
+
+            }
+
+        }
+
+        GFX_COUNT_PIXELS(written);
+
+    }
+
+    inline void drawScaled(Surface target, int16_t x, int16_t y, const Sprite &sprite, int16_t w, int16_t h, uint16_t frame = 0) {
+
+        const bool    flipX = w < 0, flipY = h < 0;
+        const int16_t aw    = flipX ? -w : w;
+        const int16_t ah    = flipY ? -h : h;
+
+        if (!aw || !ah || aw % sprite.width || ah % sprite.height) {
+            drawStretched(target, x, y, sprite, w, h, frame);
+            return;
+        }
+
+        const int16_t fx = aw / sprite.width;
+        const int16_t fy = ah / sprite.height;
+
+        // visible part of the stretched frame, relative to (x, y)
+        const int16_t left   = x < 0 ? -x : 0;
+        const int16_t top    = y < 0 ? -y : 0;
+        const int16_t right  = x + aw > target.width  ? target.width  - x : aw;
+        const int16_t bottom = y + ah > target.height ? target.height - y : ah;
+
+        if (left >= right || top >= bottom) return;
+
+        // source columns crossed by the visible part
+        const int16_t first = left / fx;
+        const int16_t last  = (right - 1) / fx;
+
+        const uint16_t *pixels  = sprite.frame(frame);
+        const uint16_t  key     = sprite.transparent;
+        uint32_t        written = 0;
+        int16_t         source  = -1; // source row of the previous target row
+
+        for (int16_t j=top; j<bottom; ++j) {
+
+            // src[u * dir] is the source pixel of the stretched column u
+            int16_t         v    = j / fy;
+            const uint16_t *src  = pixels + (flipY ? sprite.height - 1 - v : v) * sprite.width + (flipX ? sprite.width - 1 : 0);
+            const int16_t   dir  = flipX ? -1 : 1;
+            uint16_t       *line = target.row(y + j) + x;
+
+            if (v == source) {
+
+                // same source row: copy its opaque runs from the row above
+                const uint16_t *above = line - target.width;
+
+                for (int16_t u=first; u<=last; ) {
+
+                    if (src[u * dir] == key) { ++u; continue; }
+
+                    int16_t start = u;
+                    while (u <= last && src[u * dir] != key) ++u;
+
+                    int16_t from = start * fx < left  ? left  : start * fx;
+                    int16_t to   = u * fx     > right ? right : u * fx;
+                    memcpy(line + from, above + from, 2 * (to - from));
+                    written += to - from;
+
+                }
+
+            } else {
+
+                for (int16_t u=first; u<=last; ++u) {
+
+                    uint16_t c = src[u * dir];
+                    if (c == key) continue;
+
+                    int16_t from = u * fx;
+                    int16_t to   = from + fx;
+
+                    if (from >= left && to <= right) {
+                        uint16_t *p = line + from;
+                        switch (fx) {
+                            case 4:  p[3] = c; // fall through
+                            case 3:  p[2] = c; // fall through
+                            case 2:  p[1] = c; p[0] = c; break;
+                            default: for (int16_t i=0; i<fx; ++i) p[i] = c;
+                        }
+                    } else {
+                        if (from < left) from = left;
+                        if (to > right)  to   = right;
+                        for (int16_t i=from; i<to; ++i) line[i] = c;
+                    }
+
+                    written += to - from;
+
+                }
+
+                source = v;
+
+            }
+
+        }
+
+        GFX_COUNT_PIXELS(written);
+
+    }
+
+    // Generic path of the indexed assets.
+    inline void drawStretched(IndexedSurface target, int16_t x, int16_t y, const uint8_t *data, int16_t w, int16_t h, uint16_t frame = 0) {
+
+        const IndexedFrame image(data, frame);
+        const bool         flipX   = w < 0, flipY = h < 0;
+        const int16_t      aw      = flipX ? -w : w;
+        const int16_t      ah      = flipY ? -h : h;
+        uint32_t           written = 0;
+
+        for (int16_t j=0; j<ah; ++j) {
+
+            int16_t ty = y + j;
+            if (ty < 0 || ty >= target.height) continue;
+
+            const uint8_t *src  = image.pixels + (int32_t)(flipY ? ah - 1 - j : j) * image.height / ah * image.stride;
+            uint8_t       *line = target.row(ty);
+
+            for (int16_t i=0; i<aw; ++i) {
+
+                int16_t tx = x + i;
+                if (tx < 0 || tx >= target.width) continue;
+
+                uint8_t c = getNibble(src, (int32_t)(flipX ? aw - 1 - i : i) * image.width / aw);
+                if (c != image.transparent) { setNibble(line, tx, c); ++written; }
+
+            }
+
+        }
+
+        GFX_COUNT_PIXELS(written);
+
+    }
+
+    inline void drawScaled(IndexedSurface target, int16_t x, int16_t y, const uint8_t *data, int16_t w, int16_t h, uint16_t frame = 0) {
+
+        const IndexedFrame image(data, frame);
+        const bool         flipX = w < 0, flipY = h < 0;
+        const int16_t      aw    = flipX ? -w : w;
+        const int16_t      ah    = flipY ? -h : h;
+
+        if (!aw || !ah || aw % image.width || ah % image.height) {
+            drawStretched(target, x, y, data, w, h, frame);
+            return;
+        }
+
+        const int16_t fx = aw / image.width;
+        const int16_t fy = ah / image.height;
+
+        // visible part of the stretched frame, relative to (x, y)
+        const int16_t left   = x < 0 ? -x : 0;
+        const int16_t top    = y < 0 ? -y : 0;
+        const int16_t right  = x + aw > target.width  ? target.width  - x : aw;
+        const int16_t bottom = y + ah > target.height ? target.height - y : ah;
+
+        if (left >= right || top >= bottom) return;
+
+        // source columns crossed by the visible part
+        const int16_t first = left / fx;
+        const int16_t last  = (right - 1) / fx;
+
+        const uint8_t key     = image.transparent;
+        uint32_t      written = 0;
+        int16_t       source  = -1; // source row of the previous target row
+
+        for (int16_t j=top; j<bottom; ++j) {
+
+            // nibble base + u * dir of src is the source index of the stretched column u
+            int16_t        v    = j / fy;
+            const uint8_t *src  = image.pixels + (flipY ? image.height - 1 - v : v) * image.stride;
+            const int16_t  base = flipX ? image.width - 1 : 0;
+            const int16_t  dir  = flipX ? -1 : 1;
+            uint8_t       *line = target.row(y + j);
+
+            if (v == source) {
+
+                // same source row: copy its opaque runs from the row above,
+                // byte by byte as both rows share the nibble alignment
+                const uint8_t *above = target.row(y + j - 1);
+
+                for (int16_t u=first; u<=last; ) {
+
+                    if (getNibble(src, base + u * dir) == key) { ++u; continue; }
+
+                    int16_t start = u;
+                    while (u <= last && getNibble(src, base + u * dir) != key) ++u;
+
+                    int16_t from = start * fx < left  ? left  : start * fx;
+                    int16_t to   = u * fx     > right ? right : u * fx;
+                    copyNibbles(line, x + from, above, x + from, to - from);
+                    written += to - from;
+
+                }
+
+            } else {
+
+                for (int16_t u=first; u<=last; ++u) {
+
+                    uint8_t c = getNibble(src, base + u * dir);
+                    if (c == key) continue;
+
+                    int16_t from = u * fx < left  ? left  : u * fx;
+                    int16_t to   = u * fx + fx > right ? right : u * fx + fx;
+                    fillNibbles(line, x + from, to - from, c);
+                    written += to - from;
+
+                }
+
+                source = v;
+
+            }
+
+        }
+
+        GFX_COUNT_PIXELS(written);
+
+    }
+
+}
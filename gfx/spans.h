@@ -0,0 +1,134 @@
+/**
+ * ----------------------------------------------------------------------------
+ * Handling images on the Gamebuino META
+ * © 2021 Stéphane Calderoni
+ * ----------------------------------------------------------------------------
+ * Sprites drawn through precomputed spans of opaque pixels
+ * ----------------------------------------------------------------------------
+ * The `spans` option of artwork/assets.cfg makes tools/asset-compiler emit,
+ * next to the RGB565 and indexed arrays of an asset, a table listing the runs
+ * of opaque pixels of each row of each stored frame (uint8_t):
+ *
+ *   frame offsets: one little-endian word per frame, counted in bytes from
+ *   the start of the table
+ *   frame data: for each row, the span count, then (start, length) of each
+ *   span
+ *
+ * The blitters below copy whole spans, with memcpy in RGB565 mode, and never
+ * read nor test the transparent pixels, so that sprites with large keyed
+ * areas cost only their opaque pixels. The table only depends on where the
+ * transparent pixels are, so it is the same for both variants of an asset.
+ *
+ *   gfx::drawSpans(gb.display, x, y, SPRITE_DATA, SPRITE_SPANS, frame);
+ * ----------------------------------------------------------------------------
+ */
+
+#pragma once
+
+#include <string.h>
+#include "surface.h"
+
+namespace gfx {
+
+    // The frame must have been checked against the frame count of the image.
+    inline const uint8_t *spanFrame(const uint8_t *spans, uint16_t frame) {
+        return spans + (spans[2 * frame] | spans[2 * frame + 1] << 8);
+    }
+
+    // Clips the span [start, start + length) of a sprite drawn at x to the
+    // target width, returns false when nothing is left.
+    inline bool clipSpan(int16_t x, int16_t width, int16_t &start, int16_t &length) {
+
+        int16_t left  = x + start;
+        int16_t right = left + length;
+
+        if (left < 0) { start -= left; left = 0; }
+        if (right > width) right = width;
+
+        length = right - left;
+        return length > 0;
+
+    }
+
+    inline void drawSpans(Surface target, int16_t x, int16_t y, const uint16_t *data, const uint8_t *spans, uint16_t frame = 0) {
+
+        frame = checkedFrame(frame, data[2]);
+
+        const int16_t   w       = data[0];
+        const int16_t   h       = data[1];
+        const uint16_t *pixels  = data + 6 + frame * w * h;
+        const uint8_t  *span    = spanFrame(spans, frame);
+        uint32_t        written = 0;
+
+        for (int16_t j=0; j<h; ++j, pixels+=w) {
+
+            int16_t ty = y + j;
+            if (ty >= target.height) break;
+
+            uint8_t count = *span++;
+
+            if (ty < 0) {
+                span += 2 * count;
+                continue;
+            }
+
+            uint16_t *line = target.row(ty);
+
+            for (uint8_t s=0; s<count; ++s, span+=2) {
+
+                int16_t start = span[0], length = span[1];
+                if (!clipSpan(x, target.width, start, length)) continue;
+
+                memcpy(line + x + start, pixels + start, 2 * length);
+                written += length;
+
+            }
+
+        }
+
+        GFX_COUNT_PIXELS(written);
+
+    }
+
+    inline void drawSpans(IndexedSurface target, int16_t x, int16_t y, const uint8_t *data, const uint8_t *spans, uint16_t frame = 0) {
+
+        frame = checkedFrame(frame, data[2] | data[3] << 8);
+
+        const int16_t   w       = data[0];
+        const int16_t   h       = data[1];
+        const int16_t   stride  = (w + 1) / 2;
+        const uint8_t  *pixels  = data + 7 + frame * h * stride;
+        const uint8_t  *span    = spanFrame(spans, frame);
+        uint32_t        written = 0;
+
+        for (int16_t j=0; j<h; ++j, pixels+=stride) {
+
+            int16_t ty = y + j;
+            if (ty >= target.height) break;
+
+            uint8_t count = *span++;
+
+            if (ty < 0) {
+                span += 2 * count;
+                continue;
+            }
+
+            uint8_t *line = target.row(ty);
+
+            for (uint8_t s=0; s<count; ++s, span+=2) {
+
+                int16_t start = span[0], length = span[1];
+                if (!clipSpan(x, target.width, start, length)) continue;
+
+                copyNibbles(line, x + start, pixels, start, length);
+                written += length;
+
+            }
+
+        }
+
+        GFX_COUNT_PIXELS(written);
+
+    }
+
+}
@@ -0,0 +1,103 @@
+/**
+ * ----------------------------------------------------------------------------
+ * Handling images on the Gamebuino META
+ * © 2021 Stéphane Calderoni
+ * ----------------------------------------------------------------------------
+ * Lightweight sprite views over the RGB565 asset arrays
+ * ----------------------------------------------------------------------------
+ * Building an Image from an asset array in a draw call parses its header and
+ * runs the Image constructor on every frame. A Sprite is a plain, trivially
+ * copyable view whose header fields are decoded by a constexpr constructor,
+ * so that a sprite declared as
+ *
+ *   constexpr gfx::Sprite AVATAR(SPRITE_DATA);
+ *
+ * is fully resolved at compile time and lives in flash, like the array. The
+ * pixels of a frame are then reached by arithmetic alone, and `drawSprite`
+ * blits it with the clipping computed once per call instead of per pixel.
+ *
+ * Mirrored frames are drawn by walking the source rows backwards (FLIP_X)
+ * and taking them from the bottom up (FLIP_Y), with the same inner loop as
+ * unmirrored ones: unlike drawImage with a negative size, no per-pixel
+ * coordinate is computed.
+ * ----------------------------------------------------------------------------
+ */
+
+#pragma once
+
+#include "surface.h"
+
+namespace gfx {
+
+    enum Flip : uint8_t {
+        FLIP_NONE = 0,
+        FLIP_X    = 1, // mirrored horizontally
+        FLIP_Y    = 2, // mirrored vertically
+        FLIP_XY   = 3
+    };
+
+    struct Sprite {
+
+        int16_t         width, height;
+        uint16_t        frames;
+        uint16_t        transparent;
+        const uint16_t *pixels;
+
+        constexpr Sprite(const uint16_t *data)
+        : width(data[0])
+        , height(data[1])
+        , frames(data[2])
+        , transparent(data[4])
+        , pixels(data + 6) {}
+
+        constexpr const uint16_t *frame(uint16_t f) const {
+            return pixels + checkedFrame(f, frames) * width * height;
+        }
+
+    };
+
+    // Draws the width x height block of pixels starting at `pixels`, whose
+    // rows are `stride` pixels apart, mirrored along the axes set in `flip`
+    // and skipping the pixels of the `key` color.
+    inline void drawPixels(Surface target, int16_t x, int16_t y, const uint16_t *pixels, int16_t width, int16_t height, int16_t stride, uint16_t key, uint8_t flip = FLIP_NONE) {
+
+        // visible part of the block, in block coordinates
+        int16_t left   = x < 0 ? -x : 0;
+        int16_t top    = y < 0 ? -y : 0;
+        int16_t right  = x + width  > target.width  ? target.width  - x : width;
+        int16_t bottom = y + height > target.height ? target.height - y : height;
+
+        if (left >= right || top >= bottom) return;
+
+        // source row of the first visible target row, and step between rows
+        const int16_t   step    = flip & FLIP_Y ? -stride : stride;
+        const uint16_t *src     = pixels + (flip & FLIP_Y ? height - 1 - top : top) * stride;
+        uint32_t        written = 0;
+
+        for (int16_t j=top; j<bottom; ++j, src+=step) {
+
+            uint16_t *dst = target.row(y + j) + x;
+
+            if (flip & FLIP_X) {
+                const uint16_t *s = src + width - 1;
+                for (int16_t i=left; i<right; ++i) if (s[-i] != key) { dst[i] = s[-i]; ++written; }
+            } else {
+                for (int16_t i=left; i<right; ++i) if (src[i] != key) { dst[i] = src[i]; ++written; }
+            }
+
+        }
+
+        GFX_COUNT_PIXELS(written);
+
+    }
+
+    // Draws the frame of the sprite whose pixels start at `pixels`.
+    inline void drawFrame(Surface target, int16_t x, int16_t y, const Sprite &sprite, const uint16_t *pixels, uint8_t flip = FLIP_NONE) {
+        drawPixels(target, x, y, pixels, sprite.width, sprite.height, sprite.width, sprite.transparent, flip);
+    }
+
+    inline void drawSprite(Surface target, int16_t x, int16_t y, const Sprite &sprite, uint16_t frame = 0, uint8_t flip = FLIP_NONE) {
+        drawFrame(target, x, y, sprite, sprite.frame(frame), flip);
+    }
+
+}
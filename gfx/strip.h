@@ -0,0 +1,178 @@
+/**
+ * ----------------------------------------------------------------------------
+ * Handling images on the Gamebuino META
+ * © 2021 Stéphane Calderoni
+ * ----------------------------------------------------------------------------
+ * Full resolution RGB565 scenes rendered a band of lines at a time
+ * ----------------------------------------------------------------------------
+ * A 160x128 RGB565 framebuffer takes 40 KB, more than the RAM of the META,
+ * which is why DISPLAY_MODE_RGB565 stops at 80x64. A StripRenderer records
+ * the draws of a frame instead, then composes the screen in horizontal bands
+ * of BAND lines, each one handed to a flush function as soon as it is done:
+ *
+ *   gfx::StripRenderer<> strips;                   // 2.5 KB of band, 1 KB of draws
+ *   ...
+ *   strips.tilemap(tilemap);
+ *   strips.sprite(x, y, AVATAR, frame, gfx::FLIP_X);
+ *   strips.render(sendToScreen);                   // once per frame
+ *
+ * with `void sendToScreen(uint16_t *pixels, int16_t top, int16_t lines)`
+ * writing the WIDTH x `lines` pixels of the band to the screen from line
+ * `top`. The flush may modify the pixels (to swap their bytes for the
+ * screen, for instance), but must be done with them when it returns: the
+ * next band is composed in the same buffer. gb.tft.sendBuffer only starts
+ * a DMA transfer, so the flush must not return while DMA still owns the
+ * band: it calls wait_for_transfers_done() first.
+ *
+ * Every band replays the draws that reach its lines, in the order of the
+ * calls, through the kernels of sprite.h and tilemap.h, the band being their
+ * target: their clipping keeps each draw within the band, and the result
+ * is the picture a full framebuffer would hold. The pixels no draw covers
+ * are left from the previous band, so a scene starts with a tilemap or a
+ * `fill` covering the screen.
+ *
+ * Sprites and tilemaps are referenced, not copied, and must outlive the
+ * render, like the Sprites declared constexpr next to their arrays.
+ * ----------------------------------------------------------------------------
+ */
+
+#pragma once
+
+#include "sprite.h"
+#include "tilemap.h"
+
+namespace gfx {
+
+    // Fills a rectangle of the target, clipped to it.
+    inline void fillRect(Surface target, int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+
+        int16_t left   = x < 0 ? 0 : x;
+        int16_t top    = y < 0 ? 0 : y;
+        int16_t right  = x + w > target.width  ? target.width  : x + w;
+        int16_t bottom = y + h > target.height ? target.height : y + h;
+
+        if (left >= right || top >= bottom) return;
+
+        for (int16_t j=top; j<bottom; ++j) {
+            uint16_t *dst = target.row(j);
+            for (int16_t i=left; i<right; ++i) dst[i] = color;
+        }
+
+        GFX_COUNT_PIXELS((uint32_t)(right - left) * (bottom - top));
+
+    }
+
+    template <uint8_t CAPACITY = 64, uint8_t BAND = 8, int16_t WIDTH = 160, int16_t HEIGHT = 128>
+    class StripRenderer {
+
+        private:
+
+            enum Type : uint8_t { FILL, SPRITE, TILEMAP };
+
+            struct Draw {
+                const void *object; // Sprite or TileMap
+                int16_t     x, y;   // position, or scroll of a tilemap
+                int16_t     w, h;   // size of a fill
+                uint16_t    value;  // frame, or color of a fill
+                uint8_t     type;
+                uint8_t     flip;
+            };
+
+            Draw     _draws[CAPACITY];
+            uint8_t  _count;
+            uint8_t  _dropped;
+            uint16_t _band[WIDTH * BAND];
+
+            bool add(const Draw &draw) {
+
+                if (_count == CAPACITY) {
+                    ++_dropped;
+                    return false;
+                }
+
+                _draws[_count++] = draw;
+                return true;
+
+            }
+
+            // Screen lines covered by a draw, from `top` to `bottom` - 1.
+            static void extent(const Draw &d, int16_t &top, int16_t &bottom) {
+                switch (d.type) {
+                    case SPRITE:  top = d.y;  bottom = d.y + static_cast<const Sprite*>(d.object)->height;   break;
+                    case TILEMAP: top = -d.y; bottom = static_cast<const TileMap*>(d.object)->height() - d.y; break;
+                    default:      top = d.y;  bottom = d.y + d.h;
+                }
+            }
+
+            static void replay(Surface band, int16_t top, const Draw &d) {
+                switch (d.type) {
+                    case SPRITE:  drawSprite(band, d.x, d.y - top, *static_cast<const Sprite*>(d.object), d.value, d.flip); break;
+                    case TILEMAP: static_cast<const TileMap*>(d.object)->draw(band, d.x, d.y + top);                      break;
+                    default:      fillRect(band, d.x, d.y - top, d.w, d.h, d.value);
+                }
+            }
+
+        public:
+
+            StripRenderer() : _count(0), _dropped(0) {}
+
+            StripRenderer(const StripRenderer &) = delete;
+            StripRenderer &operator=(const StripRenderer &) = delete;
+
+            // The draws return false when the renderer is full and the draw
+            // is dropped.
+
+            bool fill(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+                return add({ NULL, x, y, w, h, color, FILL, FLIP_NONE });
+            }
+
+            bool fill(uint16_t color) {
+                return fill(0, 0, WIDTH, HEIGHT, color);
+            }
+
+            bool sprite(int16_t x, int16_t y, const Sprite &sprite, uint16_t frame = 0, uint8_t flip = FLIP_NONE) {
+                return add({ &sprite, x, y, 0, 0, frame, SPRITE, flip });
+            }
+
+            // The map pixel (scrollX, scrollY) lands on the top left corner
+            // of the screen, as with TileMap::draw.
+            bool tilemap(const TileMap &map, int16_t scrollX = 0, int16_t scrollY = 0) {
+                return add({ &map, scrollX, scrollY, 0, 0, 0, TILEMAP, FLIP_NONE });
+            }
+
+            // Composes the screen band by band, handing each one to `flush`,
+            // and empties the renderer.
+            template <typename Flush>
+            void render(Flush &&flush) {
+
+                for (int16_t top=0; top<HEIGHT; top+=BAND) {
+
+                    int16_t lines = HEIGHT - top < BAND ? HEIGHT - top : BAND;
+                    Surface band(_band, WIDTH, lines);
+
+                    for (uint8_t i=0; i<_count; ++i) {
+                        int16_t first, last;
+                        extent(_draws[i], first, last);
+                        if (first < top + lines && last > top) replay(band, top, _draws[i]);
+                    }
+
+                    flush(_band, top, lines);
+
+                }
+
+                _count = 0;
+
+            }
+
+            uint8_t pending() const {
+                return _count;
+            }
+
+            // Draws dropped since the start, the renderer being full.
+            uint8_t dropped() const {
+                return _dropped;
+            }
+
+    };
+
+}
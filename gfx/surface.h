@@ -0,0 +1,163 @@
+/**
+ * ----------------------------------------------------------------------------
+ * Handling images on the Gamebuino META
+ * © 2021 Stéphane Calderoni
+ * ----------------------------------------------------------------------------
+ * Raw RGB565 and 4-bits indexed drawing targets
+ * ----------------------------------------------------------------------------
+ * A Surface is a plain view over a 16-bits framebuffer. It can be built from
+ * any Image in RGB565 mode, `gb.display` included, which lets the blitters of
+ * this folder run unchanged on the console and in the host-side tools. An
+ * IndexedSurface does the same for the Images in indexed mode.
+ * ----------------------------------------------------------------------------
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+
+// Hook letting a host-side build count the pixels that the helpers of this
+// folder write without going through drawImage.
+#ifndef GFX_COUNT_PIXELS
+#define GFX_COUNT_PIXELS(n)
+#endif
+
+// Set to 1 in the build flags when every asset drawn comes from assets/,
+// whose arrays are validated at compile time (see gfx/validate.h), and every
+// frame number from a validated frame table or a loop bounded by the frame
+// count: the blitters then trust the frame numbers they are given instead
+// of falling back to the first frame past the last one.
+#ifndef GFX_TRUSTED_ASSETS
+#define GFX_TRUSTED_ASSETS 0
+#endif
+
+// Set to 1 in the build flags to have the helpers of this folder check at
+// run time what the assets cannot, e.g. the indices of a tilemap. Arduino
+// builds do not define NDEBUG, so assert() would run on the console.
+#ifndef GFX_DEBUG
+#define GFX_DEBUG 0
+#endif
+
+namespace gfx {
+
+    // Frame `f` of an image of `frames` frames: the first one when out of
+    // range, as Image::setFrame does, unless the assets are trusted.
+    constexpr uint16_t checkedFrame(uint16_t f, uint16_t frames) {
+#if GFX_TRUSTED_ASSETS
+        return (void)frames, f;
+#else
+        return f < frames ? f : 0;
+#endif
+    }
+
+    struct Surface {
+
+        uint16_t *buffer;
+        int16_t   width, height;
+
+        Surface(uint16_t *buffer, int16_t width, int16_t height)
+        : buffer(buffer), width(width), height(height) {}
+
+        // Keeps the template below from catching copies of non-const surfaces.
+        Surface(Surface &surface)
+        : buffer(surface.buffer), width(surface.width), height(surface.height) {}
+
+        Surface(const Surface &) = default;
+
+        template <typename Image>
+        Surface(Image &image)
+        : buffer((uint16_t*)image._buffer), width(image.width()), height(image.height()) {}
+
+        uint16_t *row(int16_t y) const {
+            return buffer + y * width;
+        }
+
+    };
+
+    // The same for the 4-bits framebuffers of the indexed modes: two pixels
+    // per byte, the left one in the upper nibble.
+    struct IndexedSurface {
+
+        uint8_t *buffer;
+        int16_t  width, height;
+
+        IndexedSurface(uint8_t *buffer, int16_t width, int16_t height)
+        : buffer(buffer), width(width), height(height) {}
+
+        IndexedSurface(IndexedSurface &surface)
+        : buffer(surface.buffer), width(surface.width), height(surface.height) {}
+
+        IndexedSurface(const IndexedSurface &) = default;
+
+        template <typename Image>
+        IndexedSurface(Image &image)
+        : buffer((uint8_t*)image._buffer), width(image.width()), height(image.height()) {}
+
+        uint8_t *row(int16_t y) const {
+            return buffer + y * ((width + 1) / 2);
+        }
+
+    };
+
+    // Frame of an indexed asset, laid out as the arrays of assets/indexed.h:
+    // rows of `stride` bytes, two pixels per byte as in an IndexedSurface.
+    struct IndexedFrame {
+
+        int16_t        width, height, stride;
+        uint8_t        transparent;
+        const uint8_t *pixels;
+
+        IndexedFrame(const uint8_t *data, uint16_t frame)
+        : width(data[0])
+        , height(data[1])
+        , stride((data[0] + 1) / 2)
+        , transparent(data[5])
+        , pixels(data + 7 + checkedFrame(frame, data[2] | data[3] << 8) * data[1] * ((data[0] + 1) / 2)) {}
+
+    };
+
+    inline uint8_t getNibble(const uint8_t *row, int16_t x) {
+        return x & 1 ? row[x >> 1] & 0xf : row[x >> 1] >> 4;
+    }
+
+    inline void setNibble(uint8_t *row, int16_t x, uint8_t index) {
+        uint8_t &byte = row[x >> 1];
+        byte = x & 1 ? (byte & 0xf0) | index : (byte & 0x0f) | index << 4;
+    }
+
+    // Copies n 4-bits pixels, byte by byte when both sides share the same
+    // nibble alignment.
+    inline void copyNibbles(uint8_t *dst, int16_t dx, const uint8_t *src, int16_t sx, int16_t n) {
+
+        if ((dx ^ sx) & 1) {
+            for (int16_t i=0; i<n; ++i) setNibble(dst, dx + i, getNibble(src, sx + i));
+            return;
+        }
+
+        if (dx & 1) {
+            setNibble(dst, dx++, getNibble(src, sx++));
+            --n;
+        }
+
+        memcpy(dst + (dx >> 1), src + (sx >> 1), n >> 1);
+
+        if (n & 1) setNibble(dst, dx + n - 1, getNibble(src, sx + n - 1));
+
+    }
+
+    // Sets n nibbles from x to `index`, the whole bytes at once.
+    inline void fillNibbles(uint8_t *row, int16_t x, int16_t n, uint8_t index) {
+
+        if (x & 1) {
+            setNibble(row, x++, index);
+            --n;
+        }
+
+        memset(row + (x >> 1), index * 0x11, n >> 1);
+
+        if (n & 1) setNibble(row, x + n - 1, index);
+
+    }
+
+}
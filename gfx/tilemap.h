@@ -0,0 +1,174 @@
+/**
+ * ----------------------------------------------------------------------------
+ * Handling images on the Gamebuino META
+ * © 2021 Stéphane Calderoni
+ * ----------------------------------------------------------------------------
+ * Tilemaps rendered band by band with span copies
+ * ----------------------------------------------------------------------------
+ * A TileMap draws a grid of tile indices over an RGB565 tileset, laid out as
+ * the assets of assets/rgb565.h (one frame per tile). Instead of one general
+ * drawImage per tile, the target is filled one band of screen rows at a time,
+ * a row of tiles high: each tile crossed by the band is looked up once, then
+ * contributes a single span of pixels to each row of the band, copied from
+ * the tileset data 8 pixels at a time with no test on the pixels. Only the
+ * first band and the first column may start inside a tile, so the divisions
+ * are done once per band.
+ *
+ *   gfx::TileMap tilemap(TILESET_DATA, TILEMAP, 5, 8);
+ *   tilemap.draw(gb.display, scrollX, scrollY);
+ *
+ * The map pixel (scrollX, scrollY) lands on the top left corner of the
+ * target. Only the part of the target covered by the map is written: the
+ * areas left uncovered by a scroll past the edges of the map keep their
+ * content.
+ *
+ * Tiles holding the transparent color of the tileset are detected once, on
+ * construction, and only those are drawn pixel by pixel with the color key.
+ * Only the first 32 tiles are checked: any further tile is always drawn with
+ * the color key. The pixels left unchanged by the key are not counted as
+ * written.
+ *
+ * Every index of the map must be a frame of the tileset, which builds made
+ * with GFX_DEBUG (see gfx/surface.h) assert on construction.
+ * ----------------------------------------------------------------------------
+ */
+
+#pragma once
+
+#include <assert.h>
+#include <string.h>
+#include "surface.h"
+
+namespace gfx {
+
+    class TileMap {
+
+        private:
+
+            const uint16_t *_tileset;
+            const uint8_t  *_map;
+            uint8_t         _columns, _rows;
+            int16_t         _tileWidth, _tileHeight;
+            uint16_t        _tileSize;
+            uint16_t        _transparent;
+            uint32_t        _opaque; // bit i set when tile i has no transparent pixel
+
+            static const uint8_t HEADER        = 6;
+            static const uint8_t CHECKED_TILES = 32;
+
+            const uint16_t *tile(uint8_t index) const {
+                return _tileset + HEADER + index * _tileSize;
+            }
+
+            bool opaque(uint8_t index) const {
+                return index < CHECKED_TILES && (_opaque >> index & 1);
+            }
+
+            // Spans are a tile wide at most: fixed 16-byte copies compile to
+            // plain loads and stores, where memcpy would be called per span.
+            static void copy(uint16_t *dst, const uint16_t *src, int16_t n) {
+                int16_t i = 0;
+                for (; i + 8 <= n; i += 8) memcpy(dst + i, src + i, 16);
+                for (; i < n; ++i) dst[i] = src[i];
+            }
+
+        public:
+
+            TileMap(const uint16_t *tileset, const uint8_t *map, uint8_t columns, uint8_t rows)
+            : _tileset(tileset)
+            , _map(map)
+            , _columns(columns)
+            , _rows(rows)
+            , _tileWidth(tileset[0])
+            , _tileHeight(tileset[1])
+            , _tileSize(tileset[0] * tileset[1])
+            , _transparent(tileset[4])
+            , _opaque(0) {
+
+                #if GFX_DEBUG
+                for (uint16_t i=0; i<columns * rows; ++i) assert(map[i] < tileset[2]);
+                #endif
+
+                uint16_t tiles = tileset[2] < CHECKED_TILES ? tileset[2] : CHECKED_TILES;
+
+                for (uint8_t t=0; t<tiles; ++t) {
+                    const uint16_t *p = tile(t);
+                    uint16_t        i = 0;
+                    while (i < _tileSize && p[i] != _transparent) ++i;
+                    if (i == _tileSize) _opaque |= (uint32_t)1 << t;
+                }
+
+            }
+
+            int16_t width()  const { return _columns * _tileWidth;  }
+            int16_t height() const { return _rows    * _tileHeight; }
+
+            void draw(Surface target, int16_t scrollX = 0, int16_t scrollY = 0) const {
+
+                // visible part of the map, in target coordinates
+                int16_t left   = scrollX < 0 ? -scrollX : 0;
+                int16_t top    = scrollY < 0 ? -scrollY : 0;
+                int16_t right  = width()  - scrollX < target.width  ? width()  - scrollX : target.width;
+                int16_t bottom = height() - scrollY < target.height ? height() - scrollY : target.height;
+
+                if (left >= right || top >= bottom) return;
+
+                // copied once: the stores into the target could alias the members
+                const int16_t   tileWidth   = _tileWidth;
+                const uint16_t  tileSize    = _tileSize;
+                const uint16_t  transparent = _transparent;
+                const uint16_t *tileset     = tile(0);
+                const int16_t   stride      = target.width;
+
+                uint32_t written = 0;
+
+                // only the first band may start inside a row of tiles, and only
+                // the first span of a band inside a tile
+                const uint8_t *tiles = _map + (scrollY + top) / _tileHeight * _columns + (scrollX + left) / tileWidth;
+                int16_t        ty    = (scrollY + top) % _tileHeight;
+                const int16_t  first = (scrollX + left) % tileWidth;
+
+                for (int16_t y=top; y<bottom; ) {
+
+                    int16_t        lines = _tileHeight - ty < bottom - y ? _tileHeight - ty : bottom - y;
+                    uint16_t      *band  = target.row(y);
+                    int16_t        x     = left;
+                    int16_t        tx    = first;
+                    const uint8_t *cell  = tiles;
+
+                    while (x < right) {
+
+                        uint8_t         index = *cell++;
+                        int16_t         n     = tileWidth - tx < right - x ? tileWidth - tx : right - x;
+                        const uint16_t *src   = tileset + index * tileSize + ty * tileWidth + tx;
+                        uint16_t       *dst   = band + x;
+
+                        if (opaque(index)) {
+                            for (int16_t l=0; l<lines; ++l, src+=tileWidth, dst+=stride) copy(dst, src, n);
+                            written += n * lines;
+                        } else {
+                            for (int16_t l=0; l<lines; ++l, src+=tileWidth, dst+=stride) {
+                                for (int16_t i=0; i<n; ++i) {
+                                    if (src[i] != transparent) dst[i] = src[i], ++written;
+                                }
+                            }
+                        }
+
+                        x += n;
+                        tx = 0;
+
+                    }
+
+                    y     += lines;
+                    ty     = 0;
+                    tiles += _columns;
+
+                }
+
+                GFX_COUNT_PIXELS(written);
+
+            }
+
+    };
+
+}
@@ -0,0 +1,152 @@
+/**
+ * ----------------------------------------------------------------------------
+ * Handling images on the Gamebuino META
+ * © 2021 Stéphane Calderoni
+ * ----------------------------------------------------------------------------
+ * Compile-time validation of the asset arrays
+ * ----------------------------------------------------------------------------
+ * An asset array carries its own size in its header, and nothing at run
+ * time can tell whether the array is as long as the header says: a draw
+ * that doesn't trust it has to check every source access. The generated
+ * headers declare the arrays constexpr and follow each of them with a
+ * static_assert built on the functions below, so that an array whose header
+ * does not match its length, or a hand edit gone wrong, stops the build:
+ *
+ *   static_assert(gfx::validRgb565(SPRITE_DATA), "SPRITE_DATA: ...");
+ *
+ * What is checked:
+ *
+ *   - RGB565: 6 header words, width x height x frames pixels, mode 0;
+ *   - indexed: 7 header bytes, (width + 1) / 2 x height x frames bytes,
+ *     mode 1, a transparent index within the 16 entries of the palette;
+ *   - run-length encoded: mode 2, one offset per frame, each pointing past
+ *     the offsets and into the array;
+ *   - frame tables: every entry is a stored frame of the image;
+ *   - span tables: one offset per stored frame, pointing past the offsets,
+ *     then for each row of the frame a span count and as many spans, all
+ *     within the table and the width of the image;
+ *   - atlas regions: the frames of each region are entries of the frame
+ *     table, and each of them lies within the atlas image.
+ *
+ * With every asset validated at compile time, a build can define
+ * GFX_TRUSTED_ASSETS (see gfx/surface.h): the blitters of gfx/ then trust
+ * the frame numbers they are given and skip their range checks. The
+ * descriptors of assets/descriptors.h (gfx::validAsset) and the tables of
+ * assets/atlas.h (gfx::validAtlas) are checked the same way.
+ * ----------------------------------------------------------------------------
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace gfx {
+
+    constexpr uint16_t frameCount(const uint16_t *data) { return data[2]; }
+    constexpr uint16_t frameCount(const uint8_t *data)  { return data[2] | data[3] << 8; }
+
+    template <size_t N>
+    constexpr bool validRgb565(const uint16_t (&data)[N]) {
+        return N >= 6 && data[5] == 0 && N == 6 + (uint32_t)data[0] * data[1] * data[2];
+    }
+
+    template <size_t N>
+    constexpr bool validIndexed(const uint8_t (&data)[N]) {
+        return N >= 7 && data[6] == 1 && data[5] < 16
+            && N == 7 + (uint32_t)((data[0] + 1) / 2) * data[1] * frameCount(data);
+    }
+
+    // Offsets of frames `first` to `last` - 1, checked by halves so that the
+    // recursion depth stays logarithmic.
+    template <size_t N>
+    constexpr bool validOffsets(const uint16_t (&data)[N], uint16_t first, uint16_t last) {
+        return last - first == 1
+            ? data[6 + first] >= 6 + data[2] && data[6 + first] < N
+            : validOffsets(data, first, (first + last) / 2) && validOffsets(data, (first + last) / 2, last);
+    }
+
+    template <size_t N>
+    constexpr bool validRle(const uint16_t (&data)[N]) {
+        return N >= 6 && data[5] == 2 && data[2] && N > 6u + data[2] && validOffsets(data, 0, data[2]);
+    }
+
+    // Spans `first` to `last` - 1 of the row of a span table whose first
+    // span starts at `at`.
+    template <size_t N>
+    constexpr bool spansInside(const uint8_t (&spans)[N], size_t at, uint8_t first, uint8_t last, uint16_t width) {
+        return last - first <= 1
+            ? last == first || spans[at + 2 * first] + spans[at + 2 * first + 1] <= width
+            : spansInside(spans, at, first, (first + last) / 2, width) && spansInside(spans, at, (first + last) / 2, last, width);
+    }
+
+    // Rows `row` to `height` - 1 of a frame of a span table, the first of
+    // them starting at `at`. The rows follow one another, so they recurse
+    // one by one.
+    template <size_t N>
+    constexpr bool validSpanRows(const uint8_t (&spans)[N], size_t at, uint16_t row, uint16_t height, uint16_t width) {
+        return row == height || (at < N && at + 1 + 2 * spans[at] <= N
+            && spansInside(spans, at + 1, 0, spans[at], width)
+            && validSpanRows(spans, at + 1 + 2 * spans[at], row + 1, height, width));
+    }
+
+    // Frames `first` to `last` - 1 of a span table for `frames` frames of
+    // width x height.
+    template <size_t N>
+    constexpr bool validSpanFrames(const uint8_t (&spans)[N], uint16_t frames, uint16_t width, uint16_t height, uint16_t first, uint16_t last) {
+        return last - first == 1
+            ? (spans[2 * first] | spans[2 * first + 1] << 8) >= 2 * frames
+                && validSpanRows(spans, spans[2 * first] | spans[2 * first + 1] << 8, 0, height, width)
+            : validSpanFrames(spans, frames, width, height, first, (first + last) / 2) && validSpanFrames(spans, frames, width, height, (first + last) / 2, last);
+    }
+
+    // `spans` lists the opaque runs of the stored frames of `data` (see
+    // gfx/spans.h).
+    template <size_t N, typename D, size_t M>
+    constexpr bool validSpans(const uint8_t (&spans)[N], const D (&data)[M]) {
+        return frameCount(data) && N >= 2u * frameCount(data)
+            && validSpanFrames(spans, frameCount(data), data[0], data[1], 0, frameCount(data));
+    }
+
+    template <typename T, size_t N>
+    constexpr bool entriesBelow(const T (&table)[N], uint16_t max, size_t first, size_t last) {
+        return last - first == 1
+            ? table[first] < max
+            : entriesBelow(table, max, first, (first + last) / 2) && entriesBelow(table, max, (first + last) / 2, last);
+    }
+
+    // `table` maps frames to the stored frames of `data`.
+    template <typename T, size_t N, typename D, size_t M>
+    constexpr bool validFrames(const T (&table)[N], const D (&data)[M]) {
+        return entriesBelow(table, frameCount(data), 0, N);
+    }
+
+    // Frames `first` to `last` - 1 of the table, width x height each, lie
+    // within the image `data`.
+    template <typename F, size_t N>
+    constexpr bool framesInside(const F (&frames)[N], uint16_t width, uint16_t height, const uint16_t *data, uint16_t first, uint16_t last) {
+        return last - first == 1
+            ? frames[first].x + width <= data[0] && frames[first].y + height <= data[1]
+            : framesInside(frames, width, height, data, first, (first + last) / 2) && framesInside(frames, width, height, data, (first + last) / 2, last);
+    }
+
+    template <typename R, size_t N, typename F, size_t M>
+    constexpr bool validRegion(const R (&regions)[N], size_t r, const F (&frames)[M], const uint16_t *data) {
+        return regions[r].frames && regions[r].first + regions[r].frames <= M
+            && framesInside(frames, regions[r].width, regions[r].height, data, regions[r].first, regions[r].first + regions[r].frames);
+    }
+
+    // Regions `first` to `last` - 1 of an atlas (see gfx/atlas.h).
+    template <typename R, size_t N, typename F, size_t M>
+    constexpr bool validRegions(const R (&regions)[N], const F (&frames)[M], const uint16_t *data, size_t first, size_t last) {
+        return last - first == 1
+            ? validRegion(regions, first, frames, data)
+            : validRegions(regions, frames, data, first, (first + last) / 2) && validRegions(regions, frames, data, (first + last) / 2, last);
+    }
+
+    template <typename R, size_t N, typename F, size_t M, size_t D>
+    constexpr bool validAtlas(const R (&regions)[N], const F (&frames)[M], const uint16_t (&data)[D]) {
+        return validRegions(regions, frames, data, 0, N);
+    }
+
+}
@@ -0,0 +1,174 @@
+/**
+ * ----------------------------------------------------------------------------
+ * Handling images on the Gamebuino META
+ * © 2021 Stéphane Calderoni
+ * ----------------------------------------------------------------------------
+ * Delta-encoded RGB565 videos streamed from the SD card
+ * ----------------------------------------------------------------------------
+ * Layout of a video file (little-endian):
+ *
+ *   "GBDV", width (u16), height (u16), frames (u16)
+ *   the keyframe, i.e. frame 1 encoded against a blank picture
+ *   frames 2..n, each one encoded against the previous one
+ *   a loop frame bringing frame n back to frame 1
+ *
+ * A frame is encoded row by row. Each row starts with its number of spans
+ * (u8), then for each span:
+ *
+ *   skip (u8)          pixels left unchanged since the end of the previous span
+ *   count (u8)         number of pixels that changed
+ *   count RGB565 words the new pixels
+ *
+ * The player only reads the pixels that changed, through a small sector
+ * buffer, and applies them to the target surface in place. The target must
+ * therefore still hold the previous frame when `nextFrame()` is called: draw
+ * any overlay elsewhere, e.g. into gb.display after copying the video onto it.
+ *
+ * `File` only needs `int read(void *buffer, size_t size)` and
+ * `bool seekSet(uint32_t position)`, which SdFat files provide.
+ * ----------------------------------------------------------------------------
+ */
+
+#pragma once
+
+#include <string.h>
+#include "surface.h"
+
+namespace gfx {
+
+    const uint8_t  VIDEO_HEADER = 10;
+    const uint16_t VIDEO_BUFFER = 512; // one SD card sector
+
+    template <typename File>
+    class Video {
+
+        public:
+
+            Video(File &file)
+            : _file(file), _width(0), _height(0), _frames(0), _frame(0)
+            , _head(0), _tail(0), _offset(0), _loop(0), _bytesRead(0) {}
+
+            // Reads the header, the file being positioned at its beginning.
+            bool begin() {
+
+                uint8_t header[VIDEO_HEADER];
+                if (!read(header, VIDEO_HEADER) || memcmp(header, "GBDV", 4)) return false;
+
+                _width  = header[4] | header[5] << 8;
+                _height = header[6] | header[7] << 8;
+                _frames = header[8] | header[9] << 8;
+                _frame  = 0;
+                _loop   = 0;
+
+                return _frames > 0;
+
+            }
+
+            uint16_t width()  const { return _width;  }
+            uint16_t height() const { return _height; }
+            uint16_t frames() const { return _frames; }
+
+            // Frame currently shown, counted from 0.
+            uint16_t frame() const { return _frame; }
+
+            // Bytes read from the file since it was opened.
+            uint32_t bytesRead() const { return _bytesRead; }
+
+            // Applies the next frame, the first call drawing the keyframe.
+            // Returns false when the file is truncated.
+            bool nextFrame(Surface target) {
+
+                bool first = !_loop;
+
+                for (uint16_t y=0; y<_height; ++y) {
+
+                    uint8_t spans;
+                    if (!read(&spans, 1)) return false;
+
+                    uint16_t *line = y < target.height ? target.row(y) : NULL;
+                    uint16_t  x    = 0;
+
+                    while (spans--) {
+
+                        uint8_t span[2];
+                        if (!read(span, 2)) return false;
+
+                        x += span[0];
+                        uint16_t count = span[1];
+                        uint16_t shown = line && x < target.width ? count : 0;
+                        if (x + shown > target.width) shown = target.width - x;
+
+                        if (!read(shown ? line + x : NULL, 2 * shown)) return false;
+                        if (!read(NULL, 2 * (count - shown))) return false;
+
+                        x += count;
+
+                    }
+
+                }
+
+                if (first) {
+
+                    _loop  = _offset - (_tail - _head); // where frame 2 starts
+                    _frame = 0;
+
+                } else if (++_frame == _frames) {
+
+                    // the loop frame was just applied: back to frame 2
+                    _frame = 0;
+                    _head  = _tail = 0;
+                    _offset = _loop;
+                    if (!_file.seekSet(_loop)) return false;
+
+                }
+
+                return true;
+
+            }
+
+        private:
+
+            File     &_file;
+            uint16_t  _width, _height, _frames, _frame;
+            uint8_t   _buffer[VIDEO_BUFFER];
+            uint16_t  _head, _tail;
+            uint32_t  _offset;    // file position of the end of the buffer
+            uint32_t  _loop;      // file position of frame 2, 0 before the keyframe
+            uint32_t  _bytesRead;
+
+            // Copies `size` bytes into `to`, or skips them when `to` is NULL.
+            bool read(void *to, uint32_t size) {
+
+                uint8_t *dst = (uint8_t*)to;
+
+                while (size) {
+
+                    if (_head == _tail) {
+                        int n = _file.read(_buffer, VIDEO_BUFFER);
+                        if (n <= 0) return false;
+                        _head       = 0;
+                        _tail       = n;
+                        _offset    += n;
+                        _bytesRead += n;
+                    }
+
+                    uint16_t n = _tail - _head;
+                    if (n > size) n = size;
+
+                    if (dst) {
+                        memcpy(dst, _buffer + _head, n);
+                        dst += n;
+                    }
+
+                    _head += n;
+                    size  -= n;
+
+                }
+
+                return true;
+
+            }
+
+    };
+
+}
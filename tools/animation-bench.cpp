@@ -0,0 +1,210 @@
+/**
+ * ----------------------------------------------------------------------------
+ * Handling images on the Gamebuino META
+ * © 2021 Stéphane Calderoni
+ * ----------------------------------------------------------------------------
+ * Benchmark: time-based animation against frame-counted animation
+ * ----------------------------------------------------------------------------
+ * Usage: animation-bench [runs]
+ *
+ * Plays the torch (2 frames, frame loop 2, designed for 32 fps) for 10
+ * seconds at several frame rates, millis() advancing like gb.millis(), and
+ * reports how many of its frames are played per second when they are
+ * counted in rendered frames, as drawImage does, and through a
+ * gfx::AnimationPlayer. The player keeps the 16 frames per second of the
+ * design frame rate.
+ *
+ * Every clip mode is checked, at every frame rate and with frames dropped
+ * at random, against the frame computed from the time elapsed since the
+ * start of the clip, along with the switching between clips, the reading
+ * of the headers and a run across the wrap-around of millis(). The cost of
+ * an update is measured too.
+ * ----------------------------------------------------------------------------
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include "bench.h"
+#include "../gfx/animation.h"
+#include "../assets/rgb565.h"
+
+const uint8_t DESIGN_FPS = 32;
+const uint8_t RATES[]    = { 32, 25, 20, 16, 10 };
+
+// frame of a clip `ms` after its start, from the elapsed time alone
+uint16_t expected(const gfx::Clip &clip, uint16_t loop, uint64_t ms) {
+
+    uint16_t n = clip.count;
+    if (n < 2 || !loop) return clip.first;
+
+    uint64_t step = ms * DESIGN_FPS / (1000 * loop);
+
+    switch (clip.mode) {
+        case gfx::PLAY_ONCE:
+            return clip.first + (step < n ? step : n - 1);
+        case gfx::PLAY_LOOP:
+            return clip.first + step % n;
+        default: {
+            uint16_t p = step % (2 * (n - 1));
+            return clip.first + (p < n ? p : 2 * (n - 1) - p);
+        }
+    }
+
+}
+
+// Plays `clip` for `seconds` at `fps` from `start` ms, skipping the given
+// percentage of the updates, and compares every frame with the expected one.
+bool checkClip(const gfx::Clip &clip, uint8_t fps, uint8_t dropped, uint32_t start, uint32_t seconds) {
+
+    gfx::AnimationPlayer player(8, 3, DESIGN_FPS); // asset loop of 3, for clips with loop 0
+    player.play(clip);
+
+    const uint16_t effective = clip.loop ? clip.loop : 3;
+
+    for (uint32_t f=0; f<=seconds * fps; ++f) {
+
+        if (f && (uint32_t)rand() % 100 < dropped) continue;
+
+        uint64_t ms    = (uint64_t)f * 1000 / fps;
+        uint16_t frame = player.update(start + (uint32_t)ms);
+
+        if (frame != expected(clip, effective, ms)) {
+            fprintf(stderr, "error: clip %u+%u, mode %u, %u fps: frame %u at %u ms, %u expected\n",
+                clip.first, clip.count, clip.mode, fps, frame, (unsigned)ms, expected(clip, effective, ms));
+            return false;
+        }
+
+    }
+
+    return true;
+
+}
+
+bool check() {
+
+    const gfx::Clip CLIPS[] = {
+        { 2, 5, gfx::PLAY_ONCE,      2 },
+        { 1, 4, gfx::PLAY_LOOP,      0 },
+        { 0, 8, gfx::PLAY_LOOP,      5 },
+        { 3, 4, gfx::PLAY_PING_PONG, 1 },
+        { 0, 2, gfx::PLAY_PING_PONG, 3 },
+        { 5, 1, gfx::PLAY_LOOP,      2 }
+    };
+
+    srand(1);
+
+    for (const gfx::Clip &clip : CLIPS) {
+        for (uint8_t fps : RATES) {
+            if (!checkClip(clip, fps, 0, 0, 10))  return false;
+            if (!checkClip(clip, fps, 30, 0, 10)) return false;
+        }
+        // across the wrap-around of millis(), after 49.7 days
+        if (!checkClip(clip, 25, 10, 0xffffffff - 5000, 10)) return false;
+    }
+
+    // headers
+    gfx::AnimationPlayer torch(TORCH_DATA, DESIGN_FPS);
+    const uint8_t INDEXED[] = { 8, 8, 0x2c, 0x01, 4, 0xe, 1 }; // 300 frames
+    gfx::AnimationPlayer indexed(INDEXED, DESIGN_FPS);
+
+    if (torch.clip().count != TORCH_DATA[2] || indexed.clip().count != 300) {
+        fprintf(stderr, "error: the frame count is not read from the header\n");
+        return false;
+    }
+
+    // 4 frames of 4 x 31.25 ms: frame 1 from 125 ms on
+    indexed.update(1000);
+    if (indexed.update(1124) != 0 || indexed.update(1125) != 1) {
+        fprintf(stderr, "error: the frame loop is not read from the header\n");
+        return false;
+    }
+
+    // switching clips
+    const gfx::Clip WALK = { 0, 4, gfx::PLAY_LOOP, 2 };
+    const gfx::Clip JUMP = { 3, 1, gfx::PLAY_ONCE, 0 };
+
+    gfx::AnimationPlayer avatar(SPRITE_DATA, DESIGN_FPS);
+    avatar.play(WALK);
+    avatar.update(0);
+    avatar.update(100);  // frame 1
+    avatar.play(WALK);   // already playing
+    uint16_t walking = avatar.update(130);
+    avatar.play(JUMP);
+    uint16_t jumping = avatar.update(500);
+    bool     done    = avatar.finished();
+    avatar.play(WALK);   // starts over at the next update
+    uint16_t again   = avatar.update(2000);
+
+    if (walking != 2 || jumping != 3 || !done || again != 0) {
+        fprintf(stderr, "error: clip switching (%u, %u, %d, %u)\n", walking, jumping, done, again);
+        return false;
+    }
+
+    // no frame loop at all: the first frame is held
+    gfx::AnimationPlayer still(SPRITE_DATA, DESIGN_FPS);
+    still.update(0);
+    if (still.update(10000) != 0) {
+        fprintf(stderr, "error: an asset without frame loop must not be animated\n");
+        return false;
+    }
+
+    return true;
+
+}
+
+// Frames of the torch animation played per second of play, over a sheet
+// long enough not to wrap: when several frames are played between two
+// rendered frames, the changes seen on screen would alias.
+const uint16_t SHEET = 1000;
+
+double counted(uint8_t fps) {
+
+    const uint16_t loop = TORCH_DATA[3];
+    uint16_t frame = 0, counter = 0;
+
+    for (uint32_t f=1; f<=10u * fps; ++f) {
+        if (++counter >= loop) {
+            counter = 0;
+            ++frame;
+        }
+    }
+
+    return frame / 10.;
+
+}
+
+double timed(uint8_t fps) {
+
+    gfx::AnimationPlayer torch(SHEET, TORCH_DATA[3], DESIGN_FPS);
+    uint16_t frame = torch.update(0);
+
+    for (uint32_t f=1; f<=10u * fps; ++f) frame = torch.update(f * 1000 / fps);
+
+    return frame / 10.;
+
+}
+
+int main(int argc, char **argv) {
+
+    const uint32_t runs = argc > 1 ? strtoul(argv[1], NULL, 0) : 1000000;
+
+    bool ok = check();
+
+    printf("frames played per second\n%-6s %14s %14s\n", "fps", "frame-counted", "time-based");
+    for (uint8_t fps : RATES) {
+        printf("%-6u %12.1f/s %12.1f/s\n", fps, counted(fps), timed(fps));
+    }
+
+    const gfx::Clip WALK = { 0, 4, gfx::PLAY_PING_PONG, 2 };
+    gfx::AnimationPlayer player(SPRITE_DATA, DESIGN_FPS);
+    player.play(WALK);
+
+    uint32_t now = 0;
+    uint16_t frame;
+    double update = measure(runs, [&] { now += 31; frame = player.update(now); consume(&frame); });
+
+    printf("update: %.1f ns\n", update);
+
+    return ok ? 0 : 1;
+
+}
@@ -0,0 +1,1149 @@
+/**
+ * ----------------------------------------------------------------------------
+ * Handling images on the Gamebuino META
+ * © 2021 Stéphane Calderoni
+ * ----------------------------------------------------------------------------
+ * Asset compiler: artwork PNG sheets -> assets/rgb565.h, indexed.h,
+ * fullres.h, rle.h, descriptors.h, atlas.h and display.h
+ * ----------------------------------------------------------------------------
+ * Usage: asset-compiler [-f] <manifest> <output directory>
+ *
+ * Every asset listed in the manifest is sliced into frames and written in the
+ * Gamebuino image format, metadata block included. Each generated array is
+ * preceded by a `// source:` line carrying a hash of its source file and
+ * options: when the hash did not change, the array is copied as is from the
+ * previous header instead of being regenerated. Use -f to rebuild everything.
+ *
+ * The image arrays, frame tables and span tables are constexpr, each followed
+ * by a static_assert checking it against its header (see gfx/validate.h).
+ *
+ * The artwork is drawn for the 80x64 screens of DISPLAY_MODE_RGB565 and
+ * DISPLAY_MODE_INDEX_HALFRES, whose variants are rgb565.h and indexed.h.
+ * fullres.h holds the variant of DISPLAY_MODE_INDEX, 160x128, with every
+ * pixel doubled, and display.h includes the one of the mode being built.
+ * ----------------------------------------------------------------------------
+ */
+
+#include <stdarg.h>
+#include <map>
+#include "manifest.h"
+
+// ----------------------------------------------------------------------------
+// Generated header layout
+// ----------------------------------------------------------------------------
+
+const char *BANNER =
+    "/**\n"
+    " * ----------------------------------------------------------------------------\n"
+    " * Handling images on the Gamebuino META\n"
+    " * © 2021 Stéphane Calderoni\n"
+    " * ----------------------------------------------------------------------------\n"
+    " * %s\n"
+    " * ----------------------------------------------------------------------------\n"
+    " * Generated by tools/asset-compiler from artwork/assets.cfg\n"
+    " * ----------------------------------------------------------------------------\n"
+    " */\n"
+    "\n"
+    "#pragma once\n";
+
+const char *SOURCE_TAG = "// source: ";
+
+struct Block {
+
+    std::string name;
+    std::string tag;  // `// source:` line identifying the inputs
+    std::string text; // tag line included
+
+};
+
+struct Header {
+
+    std::string file;
+    std::string title;
+    std::string preamble;
+    std::vector<Block> blocks;
+    std::string list; // X-macro naming the arrays, for gfx/memory.h
+
+};
+
+std::string format(const char *fmt, ...) __attribute__((format(printf, 1, 2)));
+
+// Compile-time check following an array, see gfx/validate.h.
+std::string validation(const std::string &condition, const std::string &message) {
+    return "\n\nstatic_assert(" + condition + ", \"" + message + "\");";
+}
+
+std::string format(const char *fmt, ...) {
+
+    va_list args;
+    va_start(args, fmt);
+    int size = vsnprintf(NULL, 0, fmt, args);
+    va_end(args);
+
+    std::vector<char> buffer(size + 1);
+    va_start(args, fmt);
+    vsnprintf(&buffer[0], buffer.size(), fmt, args);
+    va_end(args);
+
+    return &buffer[0];
+
+}
+
+std::string sourceTag(const std::string &source, uint32_t hash) {
+    return format("%s%s (fnv1a 0x%08x)", SOURCE_TAG, source.c_str(), hash);
+}
+
+// ----------------------------------------------------------------------------
+// Previous output: blocks indexed by their source tag
+// ----------------------------------------------------------------------------
+
+std::map<std::string, std::string> readPreviousBlocks(const std::string &path) {
+
+    std::map<std::string, std::string> blocks;
+    std::ifstream in(path.c_str());
+
+    std::string line, tag, text, last;
+    while (std::getline(in, line)) {
+
+        if (line.compare(0, strlen(SOURCE_TAG), SOURCE_TAG) == 0) {
+            tag  = line;
+            text = line;
+        } else if (!tag.empty()) {
+            text += "\n" + line;
+            // a block ends with the first unindented statement end
+            if (!line.empty() && line[0] != ' ' && line[line.size() - 1] == ';') {
+                blocks[tag] = text;
+                last = tag;
+                tag.clear();
+            }
+        } else if (!last.empty() && line.compare(0, 14, "static_assert(") == 0) {
+            // the validation following the array, see validation()
+            blocks[last] += "\n\n" + line;
+        }
+
+    }
+
+    return blocks;
+
+}
+
+// ----------------------------------------------------------------------------
+// Array generation
+// ----------------------------------------------------------------------------
+
+// TORCH_DATA -> TORCH_RLE, TORCH_FRAMES...
+std::string derivedName(const std::string &name, const std::string &suffix) {
+
+    const std::string SUFFIX = "_DATA";
+
+    if (name.size() > SUFFIX.size() && name.compare(name.size() - SUFFIX.size(), SUFFIX.size(), SUFFIX) == 0) {
+        return name.substr(0, name.size() - SUFFIX.size()) + suffix;
+    }
+
+    return name + suffix;
+
+}
+
+std::string rleName(const std::string &name) {
+    return derivedName(name, "_RLE");
+}
+
+std::string framesName(const std::string &name) {
+    return derivedName(name, "_FRAMES");
+}
+
+std::string mirrorName(const std::string &name) {
+    return derivedName(name, "_MIRROR");
+}
+
+std::string spansName(const std::string &name) {
+    return derivedName(name, "_SPANS");
+}
+
+std::string descriptorName(const std::string &name) {
+    return derivedName(name, "_ASSET");
+}
+
+// SPRITE_DATA -> ATLAS_SPRITE
+std::string regionName(const std::string &name) {
+    return "ATLAS_" + derivedName(name, "");
+}
+
+std::string rgb565Array(const AssetSpec &asset, const Frames &frames, uint16_t transparent) {
+
+    std::string out = "constexpr uint16_t " + asset.name + "[] = {\n\n";
+
+    out += "    // metadata\n\n";
+    out += format("    %-8s// frame width\n",       format("%u,", frames.width).c_str());
+    out += format("    %-8s// frame height\n",      format("%u,", frames.height).c_str());
+    out += format("    %-8s// frames\n",            format("%u,", frames.count).c_str());
+    out += format("    %-8s// frame loop\n",        format("%u,", asset.loop).c_str());
+    out += format("    %-8s// transparent color\n", format("0x%04x,", transparent).c_str());
+    out += format("    %-8s// 16-bits color mode\n", "0,");
+    out += "\n    // colormap\n";
+
+    for (uint16_t f=0; f<frames.count; ++f) {
+
+        out += format("\n    // frame %u/%u\n", f + 1, frames.count);
+
+        const uint16_t *pixel = frames.frame(f);
+        for (uint16_t y=0; y<frames.height; ++y) {
+            out += "    ";
+            for (uint16_t x=0; x<frames.width; ++x, ++pixel) {
+                bool last = f + 1 == frames.count && y + 1 == frames.height && x + 1 == frames.width;
+                out += format("0x%04x%s", *pixel, last ? "" : (x + 1 == frames.width ? "," : ", "));
+            }
+            out += "\n";
+        }
+
+    }
+
+    return out + "\n};" + validation("gfx::validRgb565(" + asset.name + ")", asset.name + " is not a valid RGB565 image");
+
+}
+
+bool indexedArray(const AssetSpec &asset, const Frames &frames, const std::vector<uint16_t> &palette, uint8_t transparent, std::string &out, std::string &error) {
+
+    uint16_t stride = (frames.width + 1) / 2;
+
+    out  = "constexpr uint8_t " + asset.name + "[] = {\n\n";
+
+    out += "    // metadata\n\n";
+    out += format("    %-6s// frame width\n",           format("%u,", frames.width).c_str());
+    out += format("    %-6s// frame height\n",          format("%u,", frames.height).c_str());
+    out += format("    %-6s// frames (lower byte)\n",   format("0x%02x,", frames.count & 0xff).c_str());
+    out += format("    %-6s// frames (upper byte)\n",   format("0x%02x,", frames.count >> 8).c_str());
+    out += format("    %-6s// frame loop\n",            format("%u,", asset.loop).c_str());
+    out += format("    %-6s// transparent color\n",     format("0x%x,", transparent).c_str());
+    out += format("    %-6s// indexed color mode\n",    "1,");
+    out += "\n    // colormap\n";
+
+    for (uint16_t f=0; f<frames.count; ++f) {
+
+        out += format("\n    // frame %u/%u\n", f + 1, frames.count);
+
+        const uint16_t *row = frames.frame(f);
+        for (uint16_t y=0; y<frames.height; ++y, row+=frames.width) {
+            out += "    ";
+            for (uint16_t i=0; i<stride; ++i) {
+
+                uint8_t byte = 0;
+                for (uint8_t n=0; n<2; ++n) {
+
+                    // the assets emitted for every display mode take the
+                    // closest entry of the colors missing from the palette
+                    uint16_t x = 2*i + n;
+                    int index  = x < frames.width ? paletteIndex(palette, row[x]) : transparent;
+                    if (index < 0 && asset.modes) index = nearestIndex(palette, row[x], transparent);
+                    if (index < 0) {
+                        error = format("%s: color 0x%04x of frame %u is not in the palette", asset.source.c_str(), row[x], f + 1);
+                        return false;
+                    }
+                    byte |= index << (4 * (1 - n));
+
+                }
+
+                bool last = f + 1 == frames.count && y + 1 == frames.height && i + 1 == stride;
+                out += format("0x%02x%s", byte, last ? "" : (i + 1 == stride ? "," : ", "));
+
+            }
+            out += "\n";
+        }
+
+    }
+
+    out += "\n};" + validation("gfx::validIndexed(" + asset.name + ")", asset.name + " is not a valid indexed image");
+    return true;
+
+}
+
+// Frame indirection table of a deduplicated asset: `image.setFrame(TABLE[f])`
+// selects the stored copy of frame f.
+std::string frameTable(const AssetSpec &asset, const std::vector<uint16_t> &table, uint16_t stored, uint32_t frameBytes, std::string &note) {
+
+    std::string out = format("constexpr %s %s[] = {\n\n", stored > 0x100 ? "uint16_t" : "uint8_t", framesName(asset.name).c_str());
+
+    note = format("%u frames stored as %u, %u bytes saved", (unsigned)table.size(), stored, (unsigned)(table.size() - stored) * frameBytes);
+    out += "    // " + note + "\n\n    ";
+
+    for (size_t f=0; f<table.size(); ++f) {
+        out += format("%u%s", table[f], f + 1 == table.size() ? "\n" : ", ");
+    }
+
+    std::string name = framesName(asset.name);
+    return out + "\n};" + validation("gfx::validFrames(" + name + ", " + asset.name + ")", name + " refers to frames missing from " + asset.name);
+
+}
+
+// Runs of opaque pixels of each stored frame, see gfx/spans.h for the layout.
+bool spanTable(const AssetSpec &asset, const Frames &frames, uint16_t transparent, std::string &out, std::string &error, std::string &note) {
+
+    std::vector<std::string> rows;
+    uint32_t offset = 2 * frames.count;
+    uint32_t opaque = 0, spans = 0;
+    std::vector<uint32_t> offsets;
+
+    for (uint16_t f=0; f<frames.count; ++f) {
+
+        offsets.push_back(offset);
+
+        const uint16_t *row = frames.frame(f);
+        for (uint16_t y=0; y<frames.height; ++y, row+=frames.width) {
+
+            std::vector<uint8_t> bytes(1, 0);
+
+            for (uint16_t x=0; x<frames.width; ) {
+
+                if (row[x] == transparent) { ++x; continue; }
+
+                uint16_t start = x;
+                while (x < frames.width && row[x] != transparent) ++x;
+
+                if (start > 0xff || x - start > 0xff || bytes[0] == 0xff) {
+                    error = asset.source + ": frames are too wide for a span table";
+                    return false;
+                }
+
+                bytes.push_back(start);
+                bytes.push_back(x - start);
+                ++bytes[0];
+                opaque += x - start;
+
+            }
+
+            std::string line = "    ";
+            for (size_t i=0; i<bytes.size(); ++i) line += format("%u,%s", bytes[i], i + 1 == bytes.size() ? "" : " ");
+            rows.push_back(line);
+
+            spans  += bytes[0];
+            offset += bytes.size();
+
+        }
+
+    }
+
+    if (offset > 0xffff) {
+        error = asset.source + ": span table larger than 64 KB";
+        return false;
+    }
+
+    note = format("%u spans, %u of %u pixels opaque", spans, opaque, frames.count * frames.size());
+
+    out  = "constexpr uint8_t " + spansName(asset.name) + "[] = {\n\n";
+    out += "    // " + note + "\n\n";
+    out += "    // frame offsets (lower byte, upper byte)\n\n    ";
+    for (uint16_t f=0; f<frames.count; ++f) {
+        out += format("0x%02x, 0x%02x,%s", offsets[f] & 0xff, offsets[f] >> 8, f + 1 == frames.count ? "\n" : " ");
+    }
+
+    size_t line = 0;
+    for (uint16_t f=0; f<frames.count; ++f) {
+        out += format("\n    // frame %u/%u: span count, then (start, length) of each span\n\n", f + 1, frames.count);
+        for (uint16_t y=0; y<frames.height; ++y, ++line) out += rows[line] + "\n";
+    }
+
+    out.erase(out.size() - 2, 1); // no comma after the last byte
+    out += "\n};" + validation("gfx::validSpans(" + spansName(asset.name) + ", " + asset.name + ")", spansName(asset.name) + " does not match the frames of " + asset.name);
+    return true;
+
+}
+
+// Compile-time descriptor of an RGB565 array, see gfx/asset.h.
+std::string descriptorBlock(const AssetSpec &asset, const Frames &frames, uint16_t transparent) {
+
+    std::string out = "typedef gfx::Asset<\n";
+
+    out += "    " + asset.name + ",\n";
+    out += format("    %-8s// frame width\n",       format("%u,", frames.width).c_str());
+    out += format("    %-8s// frame height\n",      format("%u,", frames.height).c_str());
+    out += format("    %-8s// frames\n",            format("%u,", frames.count).c_str());
+    out += format("    %-8s// transparent color\n", format("0x%04x,", transparent).c_str());
+    out += format("    %-8s// 16-bits color mode\n", "0");
+
+    out += "> " + descriptorName(asset.name) + ";";
+
+    return out + validation("gfx::validAsset<" + descriptorName(asset.name) + ">()", descriptorName(asset.name) + " does not match the header of " + asset.name);
+
+}
+
+// Position of every frame of every region, see gfx/atlas.h.
+std::string atlasFrameTable(const AtlasLayout &atlas) {
+
+    std::string out = "constexpr gfx::AtlasFrame ATLAS_FRAMES[] = {\n";
+
+    for (size_t r=0; r<atlas.regions.size(); ++r) {
+
+        const AtlasLayout::Region &region = atlas.regions[r];
+        out += "\n    // " + region.name + "\n\n    ";
+
+        for (uint16_t f=0; f<region.frames; ++f) {
+            const AtlasLayout::Place &at = atlas.places[atlas.frames[region.first + f]];
+            bool last = r + 1 == atlas.regions.size() && f + 1 == region.frames;
+            out += format("{ %u, %u }%s", at.x, at.y, last ? "\n" : (f + 1 == region.frames ? ",\n" : ", "));
+        }
+
+    }
+
+    return out + "\n};";
+
+}
+
+std::string atlasRegionTable(const AtlasLayout &atlas) {
+
+    std::string out = "constexpr gfx::AtlasRegion ATLAS_REGIONS[] = {\n\n";
+    out += "    // width, height, frames, frame loop, first entry in ATLAS_FRAMES\n\n";
+
+    for (size_t r=0; r<atlas.regions.size(); ++r) {
+        const AtlasLayout::Region &region = atlas.regions[r];
+        std::string entry = format("{ %u, %u, %u, %u, %u }%s", region.width, region.height, region.frames, region.loop, region.first, r + 1 == atlas.regions.size() ? "" : ",");
+        out += format("    %-22s // %s\n", entry.c_str(), regionName(region.name).c_str());
+    }
+
+    return out + "\n};" + validation("gfx::validAtlas(ATLAS_REGIONS, ATLAS_FRAMES, ATLAS_DATA)", "ATLAS_REGIONS refers to frames missing from ATLAS_FRAMES or lying outside ATLAS_DATA");
+
+}
+
+std::string atlasRegionIds(const AtlasLayout &atlas) {
+
+    std::string out = "enum AtlasRegionId : uint8_t {\n";
+
+    for (size_t r=0; r<atlas.regions.size(); ++r) {
+        out += "    " + regionName(atlas.regions[r].name) + (r + 1 == atlas.regions.size() ? "\n" : ",\n");
+    }
+
+    return out + "};";
+
+}
+
+// Row-wise run-length encoding, see gfx/rle.h for the token layout.
+void rleRow(const uint16_t *row, uint16_t width, uint16_t transparent, std::vector<uint16_t> &tokens) {
+
+    const uint16_t SKIP = 0x0000, FILL = 0x4000, COPY = 0x8000;
+
+    size_t literal = 0; // index of the pending RLE_COPY token, if any
+    bool   copying = false;
+
+    for (uint16_t x=0; x<width;) {
+
+        uint16_t color = row[x];
+        uint16_t run   = 1;
+        while (x + run < width && row[x + run] == color && run < 0x3fff) ++run;
+
+        if (color == transparent) {
+
+            tokens.push_back(SKIP | run);
+            copying = false;
+
+        } else if (run >= 3) {
+
+            tokens.push_back(FILL | run);
+            tokens.push_back(color);
+            copying = false;
+
+        } else {
+
+            if (!copying || (tokens[literal] & 0x3fff) + run > 0x3fff) {
+                literal = tokens.size();
+                tokens.push_back(COPY);
+                copying = true;
+            }
+
+            tokens[literal] += run;
+            tokens.insert(tokens.end(), run, color);
+
+        }
+
+        x += run;
+
+    }
+
+}
+
+bool rleArray(const AssetSpec &asset, const Frames &frames, uint16_t transparent, std::string &out, std::string &error) {
+
+    const uint8_t HEADER = 6;
+
+    // identical frames share their offset, so they are stored only once
+    Frames unique;
+    std::vector<uint16_t> table;
+    dedupFrames(frames, unique, table);
+
+    std::vector<std::vector<std::vector<uint16_t> > > rows(unique.count);
+    std::vector<uint32_t> offsets;
+
+    uint32_t offset = HEADER + frames.count;
+    for (uint16_t u=0; u<unique.count; ++u) {
+
+        offsets.push_back(offset);
+
+        const uint16_t *row = unique.frame(u);
+        for (uint16_t y=0; y<unique.height; ++y, row+=unique.width) {
+            rows[u].push_back(std::vector<uint16_t>());
+            rleRow(row, unique.width, transparent, rows[u].back());
+            offset += rows[u].back().size();
+        }
+
+    }
+
+    if (offset > 0xffff) {
+        error = asset.name + " is too large to be run-length encoded";
+        return false;
+    }
+
+    out  = "constexpr uint16_t " + rleName(asset.name) + "[] = {\n\n";
+
+    out += "    // metadata\n\n";
+    out += format("    %-8s// frame width\n",       format("%u,", frames.width).c_str());
+    out += format("    %-8s// frame height\n",      format("%u,", frames.height).c_str());
+    out += format("    %-8s// frames\n",            format("%u,", frames.count).c_str());
+    out += format("    %-8s// frame loop\n",        format("%u,", asset.loop).c_str());
+    out += format("    %-8s// transparent color\n", format("0x%04x,", transparent).c_str());
+    out += format("    %-8s// run-length encoded 16-bits color mode\n", "2,");
+
+    out += "\n    // frame offsets\n\n    ";
+    for (uint16_t f=0; f<frames.count; ++f) {
+        out += format("%u,%s", offsets[table[f]], f + 1 == frames.count ? "\n" : " ");
+    }
+
+    for (uint16_t f=0, u=0; f<frames.count; ++f) {
+
+        if (table[f] < u) continue; // already stored
+
+        out += format("\n    // frame %u/%u\n", f + 1, frames.count);
+
+        for (uint16_t y=0; y<frames.height; ++y) {
+            const std::vector<uint16_t> &tokens = rows[u][y];
+            out += "    ";
+            for (size_t i=0; i<tokens.size(); ++i) {
+                bool last = u + 1 == unique.count && y + 1 == frames.height && i + 1 == tokens.size();
+                out += format("0x%04x%s", tokens[i], last ? "" : (i + 1 == tokens.size() ? "," : ", "));
+            }
+            out += "\n";
+        }
+
+        ++u;
+
+    }
+
+    out += "\n};" + validation("gfx::validRle(" + rleName(asset.name) + ")", rleName(asset.name) + " is not a valid run-length encoded image");
+    return true;
+
+}
+
+std::string paletteArray(const std::vector<uint16_t> &palette) {
+
+    std::string out = "const Color PALETTE[] = {\n\n";
+
+    for (size_t i=0; i<palette.size(); ++i) {
+        out += format("    (Color) 0x%04x%s // 0x%x\n", palette[i], i + 1 == palette.size() ? " " : ",", (unsigned)i);
+    }
+
+    return out + "\n};" + validation("sizeof(PALETTE) / sizeof(*PALETTE) == 16", "PALETTE must give a color to every index");
+
+}
+
+// ----------------------------------------------------------------------------
+// Build driver
+// ----------------------------------------------------------------------------
+
+struct Compiler {
+
+    Manifest manifest;
+    std::string output;
+    std::string note; // extra detail a generator may report
+    bool force;
+
+    std::vector<uint16_t> palette;
+    uint32_t paletteHash;
+
+    uint8_t scale; // of the frames being generated
+
+    Compiler() : force(false), paletteHash(0), scale(1) {}
+
+    bool hashFile(const std::string &file, uint32_t &hash, std::string &error) {
+
+        std::vector<uint8_t> bytes;
+        if (!readFile(manifest.path(file), bytes)) {
+            error = "cannot read " + manifest.path(file);
+            return false;
+        }
+
+        hash = fnv1a(bytes.empty() ? NULL : &bytes[0], bytes.size());
+        return true;
+
+    }
+
+    bool loadFrames(const AssetSpec &asset, Frames &frames, std::string &error) {
+
+        Bitmap sheet;
+        if (!loadPNG(manifest.path(asset.source), sheet, error) || !sliceFrames(sheet, asset, manifest.transparent, frames, error)) return false;
+
+        if (scale > 1) {
+            Frames scaled;
+            scaleFrames(frames, scale, scaled);
+            frames = scaled;
+        }
+
+        return true;
+
+    }
+
+    // Either reuses the previous block with the same tag or regenerates it.
+    bool emit(Header &header, const std::map<std::string, std::string> &previous, const std::string &name, const std::string &tag, std::string &error, bool (Compiler::*generate)(const AssetSpec*, std::string&, std::string&), const AssetSpec *asset) {
+
+        Block block;
+        block.name = name;
+        block.tag  = tag;
+
+        std::map<std::string, std::string>::const_iterator it = previous.find(tag);
+        if (!force && it != previous.end()) {
+
+            block.text = it->second;
+            printf("  %-14s up to date\n", name.c_str());
+
+        } else {
+
+            std::string body;
+            note.clear();
+            if (!(this->*generate)(asset, body, error)) return false;
+            block.text = tag + "\n" + body;
+            printf("  %-14s rebuilt%s\n", name.c_str(), note.empty() ? "" : (" (" + note + ")").c_str());
+
+        }
+
+        header.blocks.push_back(block);
+        return true;
+
+    }
+
+    // Frames as they are stored: only the first copy of each when deduplicated.
+    bool loadStoredFrames(const AssetSpec &asset, Frames &frames, std::vector<uint16_t> &table, std::string &error) {
+
+        if (!loadFrames(asset, frames, error)) return false;
+
+        if (asset.dedup) {
+            Frames unique;
+            dedupFrames(frames, unique, table);
+            frames = unique;
+        }
+
+        return true;
+
+    }
+
+    bool generateRgb565(const AssetSpec *asset, std::string &body, std::string &error) {
+
+        Frames frames;
+        std::vector<uint16_t> table;
+        if (!loadStoredFrames(*asset, frames, table, error)) return false;
+
+        body = rgb565Array(*asset, frames, manifest.transparent);
+        return true;
+
+    }
+
+    bool generateRgb565Frames(const AssetSpec *asset, std::string &body, std::string &error) {
+
+        Frames frames;
+        std::vector<uint16_t> table;
+        if (!loadStoredFrames(*asset, frames, table, error)) return false;
+
+        body = frameTable(*asset, table, frames.count, frames.size() * sizeof(uint16_t), note);
+        return true;
+
+    }
+
+    bool generateSpans(const AssetSpec *asset, std::string &body, std::string &error) {
+
+        Frames frames;
+        std::vector<uint16_t> table;
+        return loadStoredFrames(*asset, frames, table, error) && spanTable(*asset, frames, manifest.transparent, body, error, note);
+
+    }
+
+    bool generateDescriptor(const AssetSpec *asset, std::string &body, std::string &error) {
+
+        Frames frames;
+        std::vector<uint16_t> table;
+        if (!loadStoredFrames(*asset, frames, table, error)) return false;
+
+        body = descriptorBlock(*asset, frames, manifest.transparent);
+        return true;
+
+    }
+
+    // Horizontally mirrored copy of an asset, stored under its own name.
+    bool loadMirroredFrames(const AssetSpec &asset, AssetSpec &mirror, Frames &frames, std::string &error) {
+
+        Frames stored;
+        std::vector<uint16_t> table;
+        if (!loadStoredFrames(asset, stored, table, error)) return false;
+
+        mirrorFrames(stored, frames);
+        mirror      = asset;
+        mirror.name = mirrorName(asset.name);
+        return true;
+
+    }
+
+    bool generateRgb565Mirror(const AssetSpec *asset, std::string &body, std::string &error) {
+
+        AssetSpec mirror;
+        Frames    frames;
+        if (!loadMirroredFrames(*asset, mirror, frames, error)) return false;
+
+        body = rgb565Array(mirror, frames, manifest.transparent);
+        return true;
+
+    }
+
+    bool generateIndexedMirror(const AssetSpec *asset, std::string &body, std::string &error) {
+
+        AssetSpec mirror;
+        Frames    frames;
+        return loadMirroredFrames(*asset, mirror, frames, error)
+            && indexedArray(mirror, frames, palette, paletteIndex(palette, manifest.transparent), body, error);
+
+    }
+
+    bool generateIndexed(const AssetSpec *asset, std::string &body, std::string &error) {
+
+        Frames frames;
+        std::vector<uint16_t> table;
+        if (!loadStoredFrames(*asset, frames, table, error)) return false;
+
+        uint32_t missing = asset->modes ? missingColors(frames, palette) : 0;
+        if (missing) note = format("%u colors out of the palette approximated", missing);
+
+        return indexedArray(*asset, frames, palette, paletteIndex(palette, manifest.transparent), body, error);
+
+    }
+
+    bool generateIndexedFrames(const AssetSpec *asset, std::string &body, std::string &error) {
+
+        Frames frames;
+        std::vector<uint16_t> table;
+        if (!loadStoredFrames(*asset, frames, table, error)) return false;
+
+        body = frameTable(*asset, table, frames.count, frames.height * ((frames.width + 1) / 2), note);
+        return true;
+
+    }
+
+    bool generateRle(const AssetSpec *asset, std::string &body, std::string &error) {
+
+        Frames frames;
+        return loadFrames(*asset, frames, error) && rleArray(*asset, frames, manifest.transparent, body, error);
+
+    }
+
+    // The frames of every asset carrying the `atlas` option, packed.
+    bool loadAtlas(AtlasLayout &atlas, std::string &error) {
+
+        std::vector<const AssetSpec*> assets;
+        std::vector<Frames>           sheets;
+
+        for (size_t i=0; i<manifest.assets.size(); ++i) {
+
+            const AssetSpec &asset = manifest.assets[i];
+            if (!asset.atlas) continue;
+
+            sheets.push_back(Frames());
+            assets.push_back(&asset);
+            if (!loadFrames(asset, sheets.back(), error)) return false;
+
+        }
+
+        packAtlas(assets, sheets, manifest.transparent, atlas);
+
+        if (atlas.width > 0x7fff || atlas.height > 0x7fff) {
+            error = "atlas too large";
+            return false;
+        }
+
+        uint32_t separate = 0;
+        for (size_t s=0; s<sheets.size(); ++s) separate += 2 * (6 + sheets[s].count * sheets[s].size());
+
+        note = format("%u frames stored as %u in %ux%u, %u bytes instead of %u", (unsigned)atlas.frames.size(), (unsigned)atlas.places.size(), atlas.width, atlas.height, 2 * (6 + atlas.width * atlas.height), separate);
+        return true;
+
+    }
+
+    bool generateAtlas(const AssetSpec *, std::string &body, std::string &error) {
+
+        AtlasLayout atlas;
+        if (!loadAtlas(atlas, error)) return false;
+
+        AssetSpec spec;
+        spec.name = "ATLAS_DATA";
+
+        Frames image;
+        image.width  = atlas.width;
+        image.height = atlas.height;
+        image.count  = 1;
+        image.pixels = atlas.pixels;
+
+        body = rgb565Array(spec, image, manifest.transparent);
+        return true;
+
+    }
+
+    bool generateAtlasFrames(const AssetSpec *, std::string &body, std::string &error) {
+
+        AtlasLayout atlas;
+        if (!loadAtlas(atlas, error)) return false;
+
+        body = atlasFrameTable(atlas);
+        note.clear();
+        return true;
+
+    }
+
+    bool generateAtlasRegions(const AssetSpec *, std::string &body, std::string &error) {
+
+        AtlasLayout atlas;
+        if (!loadAtlas(atlas, error)) return false;
+
+        body = atlasRegionTable(atlas);
+        note.clear();
+        return true;
+
+    }
+
+    bool generateAtlasIds(const AssetSpec *, std::string &body, std::string &error) {
+
+        AtlasLayout atlas;
+        if (!loadAtlas(atlas, error)) return false;
+
+        body = atlasRegionIds(atlas);
+        note.clear();
+        return true;
+
+    }
+
+    bool generateAtlasView(const AssetSpec *, std::string &body, std::string &) {
+        body = "constexpr gfx::Atlas ATLAS(ATLAS_DATA, ATLAS_REGIONS, ATLAS_FRAMES);";
+        return true;
+    }
+
+    bool generatePalette(const AssetSpec *, std::string &body, std::string &) {
+        body = paletteArray(palette);
+        return true;
+    }
+
+    bool write(const Header &header) {
+
+        std::string path = output + "/" + header.file;
+        std::string text = format(BANNER, header.title.c_str()) + header.preamble;
+
+        if (!header.list.empty()) {
+
+            text += "\n// arrays of this header, ASSET(NAME) each\n#define " + header.list + "(ASSET)";
+
+            for (size_t i=0; i<header.blocks.size(); ++i) {
+                const std::string &name = header.blocks[i].name;
+                if (header.blocks[i].text.find(" " + name + "[] = {") != std::string::npos) text += " \\\n    ASSET(" + name + ")";
+            }
+
+            text += "\n";
+
+        }
+
+        for (size_t i=0; i<header.blocks.size(); ++i) {
+            text += "\n" + header.blocks[i].text + "\n";
+        }
+        text.erase(text.size() - 1); // the headers do not end with a newline
+
+        std::vector<uint8_t> current;
+        if (readFile(path, current) && std::string(current.begin(), current.end()) == text) {
+            printf("%s is up to date\n", path.c_str());
+            return true;
+        }
+
+        FILE *file = fopen(path.c_str(), "wb");
+        if (!file || fwrite(text.data(), 1, text.size(), file) != text.size()) {
+            fprintf(stderr, "error: cannot write %s\n", path.c_str());
+            if (file) fclose(file);
+            return false;
+        }
+
+        fclose(file);
+        printf("%s written\n", path.c_str());
+        return true;
+
+    }
+
+    bool buildRgb565(std::string &error) {
+
+        Header header;
+        header.file     = "rgb565.h";
+        header.title    = "Assets encoded for full 16-bits RGB565 display mode";
+        header.preamble = "\n#include \"../gfx/validate.h\"\n";
+        header.list     = "RGB565_ASSETS";
+
+        std::map<std::string, std::string> previous = readPreviousBlocks(output + "/" + header.file);
+        printf("%s/%s\n", output.c_str(), header.file.c_str());
+
+        for (size_t i=0; i<manifest.assets.size(); ++i) {
+
+            const AssetSpec &asset = manifest.assets[i];
+            if (!asset.rgb565) continue;
+
+            uint32_t hash;
+            if (!hashFile(asset.source, hash, error)) return false;
+            hash = fnv1a(format("%04x", manifest.transparent), fnv1a(asset.params(), hash));
+
+            if (!emit(header, previous, asset.name, sourceTag(asset.source, hash), error, &Compiler::generateRgb565, &asset)) return false;
+
+            if (asset.dedup) {
+                std::string table = framesName(asset.name);
+                if (!emit(header, previous, table, sourceTag(asset.source, fnv1a(table, hash)), error, &Compiler::generateRgb565Frames, &asset)) return false;
+            }
+
+            if (asset.spans) {
+                std::string spans = spansName(asset.name);
+                if (!emit(header, previous, spans, sourceTag(asset.source, fnv1a(spans, hash)), error, &Compiler::generateSpans, &asset)) return false;
+            }
+
+            if (asset.mirror) {
+                std::string mirror = mirrorName(asset.name);
+                if (!emit(header, previous, mirror, sourceTag(asset.source, fnv1a(mirror, hash)), error, &Compiler::generateRgb565Mirror, &asset)) return false;
+            }
+
+        }
+
+        return write(header);
+
+    }
+
+    // Indexed arrays of the assets carrying `option`, with their frames
+    // enlarged `factor` times.
+    bool buildIndexed(const std::string &file, const std::string &title, const std::string &list, bool AssetSpec::*option, uint8_t factor, std::string &error) {
+
+        Header header;
+        header.file     = file;
+        header.title    = title;
+        header.preamble = "\n#include <Gamebuino-Meta.h>\n#include \"../gfx/validate.h\"\n";
+        header.list     = list;
+
+        std::map<std::string, std::string> previous = readPreviousBlocks(output + "/" + header.file);
+        printf("%s/%s\n", output.c_str(), header.file.c_str());
+
+        if (!loadPalette(manifest, palette, error) || !hashFile(manifest.palette, paletteHash, error)) return false;
+
+        if (paletteIndex(palette, manifest.transparent) < 0) {
+            error = format("transparent color 0x%04x is not in %s", manifest.transparent, manifest.palette.c_str());
+            return false;
+        }
+
+        if (!emit(header, previous, "PALETTE", sourceTag(manifest.palette, paletteHash), error, &Compiler::generatePalette, NULL)) return false;
+
+        scale = factor;
+
+        for (size_t i=0; i<manifest.assets.size(); ++i) {
+
+            const AssetSpec &asset = manifest.assets[i];
+            if (!(asset.*option)) continue;
+
+            uint32_t hash;
+            if (!hashFile(asset.source, hash, error)) return false;
+            hash = fnv1a(format("%04x", manifest.transparent), fnv1a(asset.params(), fnv1a(&paletteHash, sizeof(paletteHash), hash)));
+            if (asset.modes) hash = fnv1a(std::string("modes"), hash); // nearest colors
+            if (factor > 1)  hash = fnv1a(format("x%u", factor), hash);
+
+            if (!emit(header, previous, asset.name, sourceTag(asset.source, hash), error, &Compiler::generateIndexed, &asset)) return false;
+
+            if (asset.dedup) {
+                std::string table = framesName(asset.name);
+                if (!emit(header, previous, table, sourceTag(asset.source, fnv1a(table, hash)), error, &Compiler::generateIndexedFrames, &asset)) return false;
+            }
+
+            if (asset.spans) {
+                std::string spans = spansName(asset.name);
+                if (!emit(header, previous, spans, sourceTag(asset.source, fnv1a(spans, hash)), error, &Compiler::generateSpans, &asset)) return false;
+            }
+
+            if (asset.mirror) {
+                std::string mirror = mirrorName(asset.name);
+                if (!emit(header, previous, mirror, sourceTag(asset.source, fnv1a(mirror, hash)), error, &Compiler::generateIndexedMirror, &asset)) return false;
+            }
+
+        }
+
+        scale = 1;
+        return write(header);
+
+    }
+
+    bool buildIndexed(std::string &error) {
+        return buildIndexed("indexed.h", "Assets encoded for 16-indexed colors display mode", "INDEXED_ASSETS", &AssetSpec::indexed, 1, error);
+    }
+
+    bool buildFullres(std::string &error) {
+        return buildIndexed("fullres.h", "Assets encoded for 16-indexed colors display mode at full resolution (160x128)", "FULLRES_ASSETS", &AssetSpec::modes, 2, error);
+    }
+
+    bool buildRle(std::string &error) {
+
+        Header header;
+        header.file     = "rle.h";
+        header.title    = "Assets run-length encoded for full 16-bits RGB565 display mode";
+        header.preamble = "\n#include \"../gfx/validate.h\"\n";
+        header.list     = "RLE_ASSETS";
+
+        std::map<std::string, std::string> previous = readPreviousBlocks(output + "/" + header.file);
+        printf("%s/%s\n", output.c_str(), header.file.c_str());
+
+        for (size_t i=0; i<manifest.assets.size(); ++i) {
+
+            const AssetSpec &asset = manifest.assets[i];
+            if (!asset.rle) continue;
+
+            uint32_t hash;
+            if (!hashFile(asset.source, hash, error)) return false;
+            hash = fnv1a(format("%04x", manifest.transparent), fnv1a(asset.params(), hash));
+
+            if (!emit(header, previous, rleName(asset.name), sourceTag(asset.source, hash), error, &Compiler::generateRle, &asset)) return false;
+
+        }
+
+        return write(header);
+
+    }
+
+    bool buildDescriptors(std::string &error) {
+
+        Header header;
+        header.file     = "descriptors.h";
+        header.title    = "Compile-time descriptors of the RGB565 assets";
+        header.preamble = "\n#include \"rgb565.h\"\n#include \"../gfx/asset.h\"\n";
+
+        std::map<std::string, std::string> previous = readPreviousBlocks(output + "/" + header.file);
+        printf("%s/%s\n", output.c_str(), header.file.c_str());
+
+        for (size_t i=0; i<manifest.assets.size(); ++i) {
+
+            const AssetSpec &asset = manifest.assets[i];
+            if (!asset.rgb565) continue;
+
+            uint32_t hash;
+            if (!hashFile(asset.source, hash, error)) return false;
+            hash = fnv1a(format("%04x", manifest.transparent), fnv1a(asset.params(), hash));
+
+            std::string name = descriptorName(asset.name);
+            if (!emit(header, previous, name, sourceTag(asset.source, fnv1a(name, hash)), error, &Compiler::generateDescriptor, &asset)) return false;
+
+        }
+
+        return write(header);
+
+    }
+
+    bool buildAtlas(std::string &error) {
+
+        Header header;
+        header.file     = "atlas.h";
+        header.title    = "Frames of the RGB565 assets packed into a single atlas";
+        header.preamble = "\n#include \"../gfx/atlas.h\"\n#include \"../gfx/validate.h\"\n";
+        header.list     = "ATLAS_ASSETS";
+
+        std::map<std::string, std::string> previous = readPreviousBlocks(output + "/" + header.file);
+        printf("%s/%s\n", output.c_str(), header.file.c_str());
+
+        // every source of the atlas is part of the hash of every block
+        std::string sources;
+        uint32_t    hash = fnv1a(format("%04x", manifest.transparent));
+
+        for (size_t i=0; i<manifest.assets.size(); ++i) {
+
+            const AssetSpec &asset = manifest.assets[i];
+            if (!asset.atlas) continue;
+
+            uint32_t file;
+            if (!hashFile(asset.source, file, error)) return false;
+
+            hash     = fnv1a(asset.name, fnv1a(&file, sizeof(file), hash));
+            sources += (sources.empty() ? "" : " ") + asset.source;
+
+        }
+
+        if (sources.empty()) return true;
+
+        struct { const char *name; bool (Compiler::*generate)(const AssetSpec*, std::string&, std::string&); } blocks[] = {
+            { "ATLAS_DATA",    &Compiler::generateAtlas        },
+            { "ATLAS_FRAMES",  &Compiler::generateAtlasFrames  },
+            { "ATLAS_REGIONS", &Compiler::generateAtlasRegions },
+            { "AtlasRegionId", &Compiler::generateAtlasIds     },
+            { "ATLAS",         &Compiler::generateAtlasView    }
+        };
+
+        for (size_t b=0; b<sizeof(blocks)/sizeof(*blocks); ++b) {
+            if (!emit(header, previous, blocks[b].name, sourceTag(sources, fnv1a(std::string(blocks[b].name), hash)), error, blocks[b].generate, NULL)) return false;
+        }
+
+        return write(header);
+
+    }
+
+    // The single include of the sketches that run in every display mode.
+    bool buildDisplay(std::string &) {
+
+        Header header;
+        header.file     = "display.h";
+        header.title    = "Assets of the display mode set by DISPLAY_MODE in config-gamebuino.h";
+        header.preamble =
+            "\n"
+            "#include <Gamebuino-Meta.h>\n"
+            "\n"
+            "// only the arrays of the selected variant end up in flash\n"
+            "#if DISPLAY_MODE == DISPLAY_MODE_INDEX\n"
+            "#include \"fullres.h\"\n"
+            "#define DISPLAY_ASSETS FULLRES_ASSETS\n"
+            "#elif DISPLAY_MODE == DISPLAY_MODE_INDEX_HALFRES\n"
+            "#include \"indexed.h\"\n"
+            "#define DISPLAY_ASSETS INDEXED_ASSETS\n"
+            "#else\n"
+            "#include \"rgb565.h\"\n"
+            "#define DISPLAY_ASSETS RGB565_ASSETS\n"
+            "#endif\n";
+
+        printf("%s/%s\n", output.c_str(), header.file.c_str());
+        return write(header);
+
+    }
+
+};
+
+int main(int argc, char **argv) {
+
+    Compiler compiler;
+    int arg = 1;
+
+    if (arg < argc && !strcmp(argv[arg], "-f")) {
+        compiler.force = true;
+        ++arg;
+    }
+
+    if (argc - arg != 2) {
+        fprintf(stderr, "usage: %s [-f] <manifest> <output directory>\n", argv[0]);
+        return 2;
+    }
+
+    compiler.output = argv[arg + 1];
+
+    std::string error;
+    if (!loadManifest(argv[arg], compiler.manifest, error)
+        || !compiler.buildRgb565(error)
+        || !compiler.buildIndexed(error)
+        || !compiler.buildFullres(error)
+        || !compiler.buildRle(error)
+        || !compiler.buildDescriptors(error)
+        || !compiler.buildAtlas(error)
+        || !compiler.buildDisplay(error)) {
+        fprintf(stderr, "error: %s\n", error.c_str());
+        return 1;
+    }
+
+    return 0;
+
+}
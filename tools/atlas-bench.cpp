@@ -0,0 +1,159 @@
+/**
+ * ----------------------------------------------------------------------------
+ * Handling images on the Gamebuino META
+ * © 2021 Stéphane Calderoni
+ * ----------------------------------------------------------------------------
+ * Benchmark: atlas regions against separate sprite arrays
+ * ----------------------------------------------------------------------------
+ * Usage: atlas-bench [runs]
+ *
+ * Draws every frame of every region of assets/atlas.h with gfx::drawRegion,
+ * mirrored or not and at clipped positions, and compares the results pixel
+ * by pixel with gfx::drawSprite on the separate arrays of assets/rgb565.h.
+ * A region id past the end of the table must draw the first region.
+ * Then reports the time taken by both, and the flash taken by the atlas and
+ * its tables against the separate arrays.
+ * ----------------------------------------------------------------------------
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bench.h"
+#include "../assets/rgb565.h"
+#include "../assets/atlas.h"
+
+const int16_t SCREEN_WIDTH  = 80;
+const int16_t SCREEN_HEIGHT = 64;
+
+// The regions keep every frame of the sheet, the stored frames of a
+// deduplicated array being reached through its frame table.
+struct Pair {
+    const char    *name;
+    gfx::Sprite    sprite;
+    const uint8_t *table;
+    uint16_t       frames;
+    uint8_t        region;
+    size_t         bytes;
+};
+
+const Pair PAIRS[] = {
+    { "SPRITE",  gfx::Sprite(SPRITE_DATA),  SPRITE_FRAMES, sizeof(SPRITE_FRAMES), ATLAS_SPRITE,  sizeof(SPRITE_DATA) + sizeof(SPRITE_FRAMES) },
+    { "TILESET", gfx::Sprite(TILESET_DATA), NULL,          TILESET_DATA[2],       ATLAS_TILESET, sizeof(TILESET_DATA) },
+    { "TORCH",   gfx::Sprite(TORCH_DATA),   NULL,          TORCH_DATA[2],         ATLAS_TORCH,   sizeof(TORCH_DATA)   }
+};
+
+const size_t PAIR_COUNT = sizeof(PAIRS) / sizeof(*PAIRS);
+
+bool check(const Pair &pair) {
+
+    static uint16_t expected[SCREEN_WIDTH * SCREEN_HEIGHT];
+    static uint16_t actual[SCREEN_WIDTH * SCREEN_HEIGHT];
+
+    gfx::Surface reference(expected, SCREEN_WIDTH, SCREEN_HEIGHT);
+    gfx::Surface target(actual, SCREEN_WIDTH, SCREEN_HEIGHT);
+
+    const gfx::Sprite      &sprite = pair.sprite;
+    const gfx::AtlasRegion &region = ATLAS.region(pair.region);
+
+    if (region.width != sprite.width || region.height != sprite.height || region.frames != pair.frames) {
+        fprintf(stderr, "error: region %s is %ux%u with %u frames\n", pair.name, region.width, region.height, region.frames);
+        return false;
+    }
+
+    const int16_t X[] = { (int16_t)(1 - sprite.width), -3, 0, 30, (int16_t)(SCREEN_WIDTH - 3) };
+    const int16_t Y[] = { (int16_t)(1 - sprite.height), -2, 0, 20, (int16_t)(SCREEN_HEIGHT - 2) };
+
+    for (uint16_t f=0; f<pair.frames; ++f)
+    for (uint8_t flip=0; flip<4; ++flip)
+    for (size_t i=0; i<sizeof(X)/sizeof(*X); ++i)
+    for (size_t j=0; j<sizeof(Y)/sizeof(*Y); ++j) {
+
+        for (int k=0; k<SCREEN_WIDTH * SCREEN_HEIGHT; ++k) expected[k] = actual[k] = k;
+
+        gfx::drawSprite(reference, X[i], Y[j], sprite, pair.table ? pair.table[f] : f, flip);
+        gfx::drawRegion(target, X[i], Y[j], ATLAS, pair.region, f, flip);
+
+        if (memcmp(expected, actual, sizeof(actual))) {
+            fprintf(stderr, "error: %s frame %u flip %u differs at (%d, %d)\n", pair.name, f, flip, X[i], Y[j]);
+            return false;
+        }
+
+    }
+
+    return true;
+
+}
+
+bool checkRegionCount() {
+
+    static uint16_t expected[SCREEN_WIDTH * SCREEN_HEIGHT];
+    static uint16_t actual[SCREEN_WIDTH * SCREEN_HEIGHT];
+
+    gfx::Surface reference(expected, SCREEN_WIDTH, SCREEN_HEIGHT);
+    gfx::Surface target(actual, SCREEN_WIDTH, SCREEN_HEIGHT);
+
+    const size_t count = sizeof(ATLAS_REGIONS) / sizeof(*ATLAS_REGIONS);
+
+    if (ATLAS.regionCount != count) {
+        fprintf(stderr, "error: the atlas counts %u regions, %zu expected\n", ATLAS.regionCount, count);
+        return false;
+    }
+
+    memset(expected, 0, sizeof(expected));
+    memset(actual, 0, sizeof(actual));
+
+    gfx::drawRegion(reference, 0, 0, ATLAS, 0, 0);
+    gfx::drawRegion(target, 0, 0, ATLAS, count, 0);
+
+    if (memcmp(expected, actual, sizeof(actual))) {
+        fprintf(stderr, "error: region %zu is past the table and must draw region 0\n", count);
+        return false;
+    }
+
+    return true;
+
+}
+
+int main(int argc, char **argv) {
+
+    const uint32_t runs = argc > 1 ? strtoul(argv[1], NULL, 0) : 200000;
+
+    static uint16_t buffer[SCREEN_WIDTH * SCREEN_HEIGHT];
+    gfx::Surface screen(buffer, SCREEN_WIDTH, SCREEN_HEIGHT);
+
+    bool   ok       = checkRegionCount();
+    size_t separate = 0;
+
+    printf("%-8s %12s %12s\n", "asset", "sprite ns", "region ns");
+
+    for (size_t p=0; p<PAIR_COUNT; ++p) {
+
+        const Pair &pair = PAIRS[p];
+        ok = check(pair) && ok;
+        separate += pair.bytes;
+
+        const uint16_t frames = pair.frames;
+        const int16_t  x      = (SCREEN_WIDTH  - pair.sprite.width)  / 2;
+        const int16_t  y      = (SCREEN_HEIGHT - pair.sprite.height) / 2;
+
+        double sprite = measure(runs, [&] {
+            for (uint16_t f=0; f<frames; ++f) gfx::drawSprite(screen, x, y, pair.sprite, pair.table ? pair.table[f] : f);
+            consume(buffer);
+        }) / frames;
+
+        double region = measure(runs, [&] {
+            for (uint16_t f=0; f<frames; ++f) gfx::drawRegion(screen, x, y, ATLAS, pair.region, f);
+            consume(buffer);
+        }) / frames;
+
+        printf("%-8s %12.1f %12.1f\n", pair.name, sprite, region);
+
+    }
+
+    size_t atlas = sizeof(ATLAS_DATA) + sizeof(ATLAS_FRAMES) + sizeof(ATLAS_REGIONS);
+    printf("flash: %zu bytes for the atlas and its tables (%ux%u), %zu for the separate arrays\n", atlas, ATLAS.width, ATLAS.height, separate);
+
+    return ok ? 0 : 1;
+
+}
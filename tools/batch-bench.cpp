@@ -0,0 +1,260 @@
+/**
+ * ----------------------------------------------------------------------------
+ * Handling images on the Gamebuino META
+ * © 2021 Stéphane Calderoni
+ * ----------------------------------------------------------------------------
+ * Benchmark: sorted draw list against immediate draws
+ * ----------------------------------------------------------------------------
+ * Usage: batch-bench [runs]
+ *
+ * Builds a scene in the order game code would issue it: a tile floor and
+ * wall (40 tiles over 4 frames), 4 torches sharing their frame and 6
+ * avatars over 2 frames, interleaved, none overlapping another of its
+ * layer. Reports the time taken to draw it with gfx::drawSprite as the
+ * draws come, then in the order the batch sorts them into, and through a
+ * gfx::Batch, flush included, with the difference to the immediate draws.
+ * That difference is split between the batch bookkeeping (queuing, sorting
+ * and walking the runs, timed on a 0x0 target where every draw returns
+ * after its clip test) and the drawing itself, which saves the lookup of
+ * the sprite and frame of every draw but the first of each run.
+ *
+ * The batch is also checked pixel by pixel against immediate draws issued
+ * layer by layer, in the order of the calls within each layer: on the scene,
+ * whose draws must be grouped into one run per layer, sprite and frame, on
+ * random scenes whose draws overlap, with the layers against each other (a
+ * sprite of an upper layer submitted first must still end up on top), and
+ * with overlapping draws of a layer.
+ * ----------------------------------------------------------------------------
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include "bench.h"
+#include "../gfx/batch.h"
+#include "../assets/rgb565.h"
+
+const int16_t SCREEN_WIDTH  = 80;
+const int16_t SCREEN_HEIGHT = 64;
+
+const gfx::Sprite AVATAR(SPRITE_DATA);
+const gfx::Sprite TILE(TILESET_DATA);
+const gfx::Sprite TORCH(TORCH_DATA);
+
+enum Layer : uint8_t { LAYER_TILES, LAYER_DECOR, LAYER_ACTORS };
+
+struct Item {
+    uint8_t            layer;
+    int16_t            x, y;
+    const gfx::Sprite *sprite;
+    uint16_t           frame;
+    uint8_t            flip;
+};
+
+const uint8_t MAX_ITEMS = 64;
+
+Item    scene[MAX_ITEMS];
+uint8_t items = 0;
+
+void add(uint8_t layer, int16_t x, int16_t y, const gfx::Sprite &sprite, uint16_t frame, uint8_t flip = gfx::FLIP_NONE) {
+    scene[items++] = { layer, x, y, &sprite, frame, flip };
+}
+
+// Tiles row by row, the actors and torches coming in between, as update
+// functions would issue them.
+void buildScene() {
+
+    for (int16_t j=0; j<8; ++j) {
+        for (int16_t i=0; i<5; ++i) add(LAYER_TILES, i * TILE.width, j * TILE.height, TILE, (j & 1) * 2 + (j >= 6));
+        if (j < 6) add(LAYER_ACTORS, 4 + 12 * j, 40, AVATAR, j & 1, j & 1 ? gfx::FLIP_X : gfx::FLIP_NONE);
+        if (j < 4) add(LAYER_DECOR, 6 + 20 * j, 6, TORCH, 1);
+    }
+
+}
+
+void drawImmediate(gfx::Surface target, const Item *items, uint8_t count) {
+    for (uint8_t i=0; i<count; ++i) {
+        const Item &it = items[i];
+        gfx::drawSprite(target, it.x, it.y, *it.sprite, it.frame, it.flip);
+    }
+}
+
+// Issued layer by layer, in the order of the calls within each layer: the
+// picture a batch must give.
+void drawLayers(gfx::Surface target, const Item *items, uint8_t count) {
+    for (uint8_t layer=LAYER_TILES; layer<=LAYER_ACTORS; ++layer) {
+        for (uint8_t i=0; i<count; ++i) {
+            const Item &it = items[i];
+            if (it.layer == layer) gfx::drawSprite(target, it.x, it.y, *it.sprite, it.frame, it.flip);
+        }
+    }
+}
+
+// The scene in the order of the batch: as none of its draws overlaps another
+// of its layer, by layer, sprite and frame, then in the order of the calls.
+void sortScene(Item *sorted) {
+    std::copy(scene, scene + items, sorted);
+    std::stable_sort(sorted, sorted + items, [](const Item &a, const Item &b) {
+        if (a.layer  != b.layer)  return a.layer < b.layer;
+        if (a.sprite != b.sprite) return (uintptr_t)a.sprite < (uintptr_t)b.sprite;
+        return a.frame < b.frame;
+    });
+}
+
+// Runs expected from the scene: one per layer, sprite and frame.
+uint8_t sceneRuns() {
+    Item sorted[MAX_ITEMS];
+    sortScene(sorted);
+    uint8_t runs = items > 0;
+    for (uint8_t i=1; i<items; ++i) {
+        const Item &a = sorted[i - 1], &b = sorted[i];
+        runs += a.layer != b.layer || a.sprite != b.sprite || a.frame != b.frame;
+    }
+    return runs;
+}
+
+template <uint8_t N>
+void drawBatched(gfx::Surface target, gfx::Batch<N> &batch, const Item *items, uint8_t count) {
+    for (uint8_t i=0; i<count; ++i) {
+        const Item &it = items[i];
+        batch.draw(it.layer, it.x, it.y, *it.sprite, it.frame, it.flip);
+    }
+    batch.flush(target);
+}
+
+int16_t random(int16_t low, int16_t high) {
+    return low + rand() % (high - low + 1);
+}
+
+// Random draws over the 3 layers, many of them overlapping.
+void randomScene(Item *items, uint8_t count) {
+    const gfx::Sprite *SPRITES[] = { &AVATAR, &TILE, &TORCH };
+    for (uint8_t i=0; i<count; ++i) {
+        const gfx::Sprite *sprite = SPRITES[rand() % 3];
+        items[i] = { (uint8_t)(rand() % 3), random(-8, SCREEN_WIDTH), random(-8, SCREEN_HEIGHT), sprite, (uint16_t)(rand() % sprite->frames), (uint8_t)(rand() % 4) };
+    }
+}
+
+bool check() {
+
+    static uint16_t expected[SCREEN_WIDTH * SCREEN_HEIGHT];
+    static uint16_t actual[SCREEN_WIDTH * SCREEN_HEIGHT];
+
+    gfx::Surface reference(expected, SCREEN_WIDTH, SCREEN_HEIGHT);
+    gfx::Surface target(actual, SCREEN_WIDTH, SCREEN_HEIGHT);
+
+    memset(expected, 0, sizeof(expected));
+    memset(actual, 0, sizeof(actual));
+
+    gfx::Batch<MAX_ITEMS> batch;
+
+    drawLayers(reference, scene, items);
+    drawBatched(target, batch, scene, items);
+
+    if (memcmp(expected, actual, sizeof(actual))) {
+        fprintf(stderr, "error: the batch differs from the draws issued layer by layer\n");
+        return false;
+    }
+
+    if (batch.draws() != items || batch.setups() != sceneRuns()) {
+        fprintf(stderr, "error: %u draws in %u runs, %u draws in %u runs expected\n", batch.draws(), batch.setups(), items, sceneRuns());
+        return false;
+    }
+
+    // overlapping draws: only those that do not overlap may be reordered
+    Item random[MAX_ITEMS];
+    srand(18);
+
+    for (uint16_t n=0; n<200; ++n) {
+
+        randomScene(random, MAX_ITEMS);
+        for (int k=0; k<SCREEN_WIDTH * SCREEN_HEIGHT; ++k) expected[k] = actual[k] = k;
+
+        drawLayers(reference, random, MAX_ITEMS);
+        drawBatched(target, batch, random, MAX_ITEMS);
+
+        if (memcmp(expected, actual, sizeof(actual))) {
+            fprintf(stderr, "error: random scene %u: the batch differs from the draws issued layer by layer\n", n);
+            return false;
+        }
+
+    }
+
+    // an upper layer submitted first, over the same pixels
+    gfx::Batch<4> overlap;
+    overlap.draw(LAYER_ACTORS, 0, 0, AVATAR, 0);
+    overlap.draw(LAYER_TILES, 0, 0, TILE, 0);
+    overlap.flush(target);
+
+    gfx::drawSprite(reference, 0, 0, TILE, 0);
+    gfx::drawSprite(reference, 0, 0, AVATAR, 0);
+
+    if (memcmp(expected, actual, sizeof(actual))) {
+        fprintf(stderr, "error: the layers are not drawn bottom up\n");
+        return false;
+    }
+
+    // overlapping draws of a layer, in the order of the calls, whatever
+    // the addresses of their sprites
+    gfx::Batch<4> calls;
+    calls.draw(LAYER_DECOR, 30, 20, TORCH, 2);
+    calls.draw(LAYER_DECOR, 30, 20, AVATAR, 1);
+    calls.draw(LAYER_DECOR, 30, 20, TILE, 3);
+    calls.draw(LAYER_DECOR, 30, 20, AVATAR, 0);
+    calls.flush(target);
+
+    gfx::drawSprite(reference, 30, 20, TORCH, 2);
+    gfx::drawSprite(reference, 30, 20, AVATAR, 1);
+    gfx::drawSprite(reference, 30, 20, TILE, 3);
+    gfx::drawSprite(reference, 30, 20, AVATAR, 0);
+
+    if (memcmp(expected, actual, sizeof(actual))) {
+        fprintf(stderr, "error: the draws of a layer are not drawn in the order of the calls\n");
+        return false;
+    }
+
+    // full batch
+    gfx::Batch<2> small;
+    if (!small.draw(0, 0, 0, TILE) || !small.draw(0, 0, 0, TILE) || small.draw(0, 0, 0, TILE) || small.pending() != 2) {
+        fprintf(stderr, "error: a full batch must refuse new draws\n");
+        return false;
+    }
+
+    return true;
+
+}
+
+int main(int argc, char **argv) {
+
+    const uint32_t runs = argc > 1 ? strtoul(argv[1], NULL, 0) : 100000;
+
+    buildScene();
+    bool ok = check();
+
+    static uint16_t buffer[SCREEN_WIDTH * SCREEN_HEIGHT];
+    gfx::Surface screen(buffer, SCREEN_WIDTH, SCREEN_HEIGHT);
+    gfx::Surface empty(buffer, 0, 0);
+    gfx::Batch<MAX_ITEMS> batch;
+
+    Item sorted[MAX_ITEMS];
+    sortScene(sorted);
+
+    double immediate = measure(runs, [&] { drawImmediate(screen, scene, items); consume(buffer); });
+    double reordered = measure(runs, [&] { drawImmediate(screen, sorted, items); consume(buffer); });
+    double batched   = measure(runs, [&] { drawBatched(screen, batch, scene, items); consume(buffer); });
+    double overhead  = measure(runs, [&] { drawBatched(empty, batch, scene, items); consume(buffer); });
+
+    double difference = batched - immediate;
+
+    printf("%u draws, %u runs once sorted\n\n", batch.draws(), batch.setups());
+    printf("%-32s %10s %10s\n", "", "ns", "vs immediate");
+    printf("%-32s %10.1f\n", "immediate, order of the calls", immediate);
+    printf("%-32s %10.1f %+10.1f\n", "immediate, order of the batch", reordered, reordered - immediate);
+    printf("%-32s %10.1f %+10.1f (%+.0f%%)\n", "batch, flush included", batched, difference, 100 * difference / immediate);
+    printf("%-32s %10.1f\n", "  queuing, sorting, runs", overhead);
+    printf("%-32s %10.1f %+10.1f\n", "  drawing", batched - overhead, batched - overhead - immediate);
+
+    return ok ? 0 : 1;
+
+}
@@ -0,0 +1,42 @@
+/**
+ * ----------------------------------------------------------------------------
+ * Handling images on the Gamebuino META
+ * © 2021 Stéphane Calderoni
+ * ----------------------------------------------------------------------------
+ * Host-side benchmark helpers
+ * ----------------------------------------------------------------------------
+ * Timings are wall-clock nanoseconds measured on the host: they only make
+ * sense relative to one another, to compare two code paths built with the
+ * same compiler options.
+ * ----------------------------------------------------------------------------
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+#include <chrono>
+
+inline uint64_t nanos() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()
+    ).count();
+}
+
+// Keeps the optimizer from discarding the work done on a buffer.
+inline void consume(const void *p) {
+    __asm__ __volatile__("" : : "g"(p) : "memory");
+}
+
+// Runs `body` `runs` times and returns the mean time of a run in nanoseconds.
+template <typename F>
+double measure(uint32_t runs, F body) {
+
+    body(); // warm-up
+
+    uint64_t start = nanos();
+    for (uint32_t i=0; i<runs; ++i) body();
+
+    return double(nanos() - start) / runs;
+
+}
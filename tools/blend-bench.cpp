@@ -0,0 +1,223 @@
+/**
+ * ----------------------------------------------------------------------------
+ * Handling images on the Gamebuino META
+ * © 2021 Stéphane Calderoni
+ * ----------------------------------------------------------------------------
+ * Benchmark: blended sprites against opaque ones
+ * ----------------------------------------------------------------------------
+ * Usage: blend-bench [runs]
+ *
+ * Checks the two-pixel operations of gfx/blend.h against the one-pixel ones
+ * on random words, the one-pixel ones against a per-channel computation on
+ * a sample of color pairs, and gfx::drawBlended against a per-pixel blit
+ * doing that computation, for every mode and frame, at clipped positions.
+ *
+ * Then reports, for the avatar and the torch, the time taken by an opaque
+ * draw (gfx::drawSprite), by the per-pixel blit and by gfx::drawBlended in
+ * each mode: the fastest of 15 interleaved rounds of `runs` draws of every
+ * frame, 20000 by default.
+ * ----------------------------------------------------------------------------
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bench.h"
+#include "../gfx/blend.h"
+#include "../assets/rgb565.h"
+
+const int16_t SCREEN_WIDTH  = 80;
+const int16_t SCREEN_HEIGHT = 64;
+
+const char *MODES[] = { "half", "add", "multiply" };
+
+// Reference: the channels unpacked, combined and packed again.
+uint16_t combine(uint16_t d, uint16_t s, uint8_t mode) {
+
+    int dc[3] = { d >> 11, (d >> 5) & 0x3f, d & 0x1f };
+    int sc[3] = { s >> 11, (s >> 5) & 0x3f, s & 0x1f };
+    int max[3] = { 0x1f, 0x3f, 0x1f };
+    int c[3];
+
+    for (int k=0; k<3; ++k) {
+        switch (mode) {
+            case gfx::BLEND_HALF:     c[k] = (dc[k] + sc[k]) / 2; break;
+            case gfx::BLEND_ADD:      c[k] = dc[k] + sc[k] > max[k] ? max[k] : dc[k] + sc[k]; break;
+            case gfx::BLEND_MULTIPLY: c[k] = dc[k] * (sc[k] + 1) / (max[k] + 1); break;
+        }
+    }
+
+    return c[0] << 11 | c[1] << 5 | c[2];
+
+}
+
+void drawPerPixel(gfx::Surface target, int16_t x, int16_t y, const gfx::Sprite &sprite, uint8_t mode, uint16_t frame) {
+
+    const uint16_t *pixel = sprite.frame(frame);
+
+    for (int16_t j=0; j<sprite.height; ++j) {
+        for (int16_t i=0; i<sprite.width; ++i, ++pixel) {
+
+            int16_t tx = x + i, ty = y + j;
+            if (tx < 0 || ty < 0 || tx >= target.width || ty >= target.height) continue;
+            if (*pixel == sprite.transparent) continue;
+
+            uint16_t &d = target.row(ty)[tx];
+            d = combine(d, *pixel, mode);
+
+        }
+    }
+
+}
+
+uint32_t xorshift() {
+    static uint32_t state = 0x9e3779b9;
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+}
+
+template <typename Op>
+bool checkPairs(const char *name) {
+
+    for (uint32_t n=0; n<4000000; ++n) {
+
+        uint32_t d = xorshift(), s = xorshift();
+        uint32_t expected = Op::one(d, s) | (uint32_t)Op::one(d >> 16, s >> 16) << 16;
+
+        if (Op::two(d, s) != expected) {
+            fprintf(stderr, "error: %s(0x%08x, 0x%08x) = 0x%08x instead of 0x%08x\n", name, d, s, Op::two(d, s), expected);
+            return false;
+        }
+
+    }
+
+    return true;
+
+}
+
+bool checkPixels() {
+
+    for (uint32_t d=0; d<0x10000; d+=3) {
+        for (uint32_t s=0; s<0x10000; s+=127) {
+
+            uint16_t expected[] = { combine(d, s, gfx::BLEND_HALF), combine(d, s, gfx::BLEND_ADD), combine(d, s, gfx::BLEND_MULTIPLY) };
+            uint16_t actual[]   = { gfx::blend(d, s), gfx::add(d, s), gfx::multiply(d, s) };
+
+            for (uint8_t m=0; m<3; ++m) {
+                if (expected[m] != actual[m]) {
+                    fprintf(stderr, "error: %s(0x%04x, 0x%04x) = 0x%04x instead of 0x%04x\n", MODES[m], d, s, actual[m], expected[m]);
+                    return false;
+                }
+            }
+
+        }
+    }
+
+    return true;
+
+}
+
+bool checkDraws(const char *name, const gfx::Sprite &sprite) {
+
+    static uint16_t expected[SCREEN_WIDTH * SCREEN_HEIGHT];
+    static uint16_t actual[SCREEN_WIDTH * SCREEN_HEIGHT];
+
+    gfx::Surface reference(expected, SCREEN_WIDTH, SCREEN_HEIGHT);
+    gfx::Surface target(actual, SCREEN_WIDTH, SCREEN_HEIGHT);
+
+    const int16_t X[] = { (int16_t)(1 - sprite.width), -3, -2, 0, 1, 30, 31, (int16_t)(SCREEN_WIDTH - 3), (int16_t)(SCREEN_WIDTH - 2) };
+    const int16_t Y[] = { (int16_t)(1 - sprite.height), -2, 0, 20, (int16_t)(SCREEN_HEIGHT - 2) };
+
+    for (uint8_t m=0; m<3; ++m)
+    for (uint16_t f=0; f<sprite.frames; ++f)
+    for (size_t i=0; i<sizeof(X)/sizeof(*X); ++i)
+    for (size_t j=0; j<sizeof(Y)/sizeof(*Y); ++j) {
+
+        for (int k=0; k<SCREEN_WIDTH * SCREEN_HEIGHT; ++k) expected[k] = actual[k] = k * 0x9e37;
+
+        drawPerPixel(reference, X[i], Y[j], sprite, m, f);
+        gfx::drawBlended(target, X[i], Y[j], sprite, m, f);
+
+        if (memcmp(expected, actual, sizeof(actual))) {
+            fprintf(stderr, "error: %s %s frame %u differs at (%d, %d)\n", name, MODES[m], f, X[i], Y[j]);
+            return false;
+        }
+
+    }
+
+    return true;
+
+}
+
+// Rounds of each measure: the draws being a few tens of ns, the timings of
+// a round drift with the clock of the host, and the fastest round of each
+// measure is kept, the rounds of all of them being interleaved.
+const uint8_t ROUNDS = 15;
+
+void run(const char *name, const gfx::Sprite &sprite, uint32_t runs, gfx::Surface screen) {
+
+    const int16_t x = (SCREEN_WIDTH  - sprite.width)  / 2;
+    const int16_t y = (SCREEN_HEIGHT - sprite.height) / 2;
+
+    double opaque = 1e30, perPixel[3] = { 1e30, 1e30, 1e30 }, blended[3] = { 1e30, 1e30, 1e30 };
+
+    for (uint8_t r=0; r<ROUNDS; ++r) {
+
+        double t = measure(runs, [&] {
+            for (uint16_t f=0; f<sprite.frames; ++f) gfx::drawSprite(screen, x, y, sprite, f);
+            consume(screen.buffer);
+        }) / sprite.frames;
+        opaque = t < opaque ? t : opaque;
+
+        for (uint8_t m=0; m<3; ++m) {
+
+            t = measure(runs, [&] {
+                for (uint16_t f=0; f<sprite.frames; ++f) drawPerPixel(screen, x, y, sprite, m, f);
+                consume(screen.buffer);
+            }) / sprite.frames;
+            perPixel[m] = t < perPixel[m] ? t : perPixel[m];
+
+            t = measure(runs, [&] {
+                for (uint16_t f=0; f<sprite.frames; ++f) gfx::drawBlended(screen, x, y, sprite, m, f);
+                consume(screen.buffer);
+            }) / sprite.frames;
+            blended[m] = t < blended[m] ? t : blended[m];
+
+        }
+
+    }
+
+    for (uint8_t m=0; m<3; ++m) {
+        printf("%-8s %-9s %10.1f %12.1f %10.1f %9.2fx\n", name, MODES[m], opaque, perPixel[m], blended[m], blended[m] / opaque);
+    }
+
+}
+
+int main(int argc, char **argv) {
+
+    const uint32_t runs = argc > 1 ? strtoul(argv[1], NULL, 0) : 20000;
+
+    const gfx::Sprite AVATAR(SPRITE_DATA);
+    const gfx::Sprite TORCH(TORCH_DATA);
+
+    bool ok = checkPairs<gfx::HalfOp>("half")
+           && checkPairs<gfx::AddOp>("add")
+           && checkPairs<gfx::MultiplyOp>("multiply")
+           && checkPixels()
+           && checkDraws("SPRITE", AVATAR)
+           && checkDraws("TORCH", TORCH);
+
+    static uint16_t buffer[SCREEN_WIDTH * SCREEN_HEIGHT];
+    for (int k=0; k<SCREEN_WIDTH * SCREEN_HEIGHT; ++k) buffer[k] = k * 0x9e37;
+    gfx::Surface screen(buffer, SCREEN_WIDTH, SCREEN_HEIGHT);
+
+    printf("%-8s %-9s %10s %12s %10s %10s\n", "asset", "mode", "opaque ns", "per-pixel ns", "packed ns", "/ opaque");
+
+    run("SPRITE", AVATAR, runs, screen);
+    run("TORCH",  TORCH,  runs, screen);
+
+    return ok ? 0 : 1;
+
+}
@@ -0,0 +1,150 @@
+/**
+ * ----------------------------------------------------------------------------
+ * Handling images on the Gamebuino META
+ * © 2021 Stéphane Calderoni
+ * ----------------------------------------------------------------------------
+ * Benchmark: BMP images loaded through the RGB565 sidecar cache
+ * ----------------------------------------------------------------------------
+ * Usage: bmp-cache-bench [runs]
+ *
+ * Copies the BMP files of artwork/ into a scratch directory standing for the
+ * SD card, then loads each of them with gfx::loadBMP: without cache, on a
+ * cold cache (the sidecar gets written), on a warm cache, and once more
+ * after the BMP timestamp changed. The 32-bit BMP is also loaded with its
+ * color masks moved after a 40-byte info header. Every load is compared pixel by pixel to
+ * the host-side decoding of the BMP, and the time and bytes read per load
+ * are reported.
+ * ----------------------------------------------------------------------------
+ */
+
+#include <math.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <utime.h>
+#include "bench.h"
+#include "bmp.h"
+#include "stdio-file.h"
+#include "../gfx/bmp.h"
+
+const char *IMAGES[] = { "gamebuino.bmp", "splash.bmp" };
+
+const char *STATUS[] = { "failed", "decoded", "cached" };
+
+bool writeFile(const std::string &to, const std::vector<uint8_t> &bytes) {
+
+    FILE *file = fopen(to.c_str(), "wb");
+    bool  ok   = file && fwrite(&bytes[0], 1, bytes.size(), file) == bytes.size();
+    if (file) fclose(file);
+    return ok;
+
+}
+
+bool copyFile(const std::string &from, const std::string &to) {
+    std::vector<uint8_t> bytes;
+    return readFile(from, bytes) && writeFile(to, bytes);
+}
+
+// Rewrites a BI_BITFIELDS BMP with a 40-byte BITMAPINFOHEADER, its color
+// masks following it at offset 54, as some encoders save them.
+bool copyWithInfoHeader(const std::string &from, const std::string &to) {
+
+    std::vector<uint8_t> bytes;
+    if (!readFile(from, bytes) || bytes.size() < 66 || bmp::le32(&bytes[30]) != 3) return false;
+
+    uint32_t offset = bmp::le32(&bytes[10]);
+    if (offset < 66 || offset > bytes.size()) return false;
+
+    std::vector<uint8_t> v3(bytes.begin(), bytes.begin() + 66);
+    v3.insert(v3.end(), bytes.begin() + offset, bytes.end());
+
+    gfx::bmpPutLE32(&v3[2],  v3.size());
+    gfx::bmpPutLE32(&v3[10], 66);
+    gfx::bmpPutLE32(&v3[14], 40);
+
+    return writeFile(to, v3);
+
+}
+
+// Loads `image`, checks the status and pixels, and reports the SD traffic.
+bool load(StdioFileSystem &sd, const char *image, const Bitmap &bitmap, bool cache, gfx::BmpLoad expected, const std::vector<uint16_t> &reference, uint32_t runs) {
+
+    std::vector<uint16_t> pixels(reference.size());
+    gfx::Surface target(&pixels[0], bitmap.width, bitmap.height);
+
+    sd.traffic = StdioTraffic();
+    gfx::BmpLoad status = gfx::loadBMP(sd, image, target, cache);
+    uint32_t     read   = sd.traffic.read;
+
+    if (status != expected || pixels != reference) {
+        fprintf(stderr, "error: %s was %s instead of %s, or its pixels differ\n", image, STATUS[status], STATUS[expected]);
+        return false;
+    }
+
+    std::string ns = "-";
+    if (runs) ns = std::to_string(lround(measure(runs, [&] { gfx::loadBMP(sd, image, target, cache); consume(&pixels[0]); })));
+
+    printf("  %-14s %-8s %10u %12s\n", cache ? "cache" : "no cache", STATUS[status], read, ns.c_str());
+    return true;
+
+}
+
+int main(int argc, char **argv) {
+
+    const uint32_t runs = argc > 1 ? strtoul(argv[1], NULL, 0) : 200;
+
+    char scratch[] = "/tmp/bmp-cache-XXXXXX";
+    if (!mkdtemp(scratch)) {
+        fprintf(stderr, "error: cannot create a scratch directory\n");
+        return 1;
+    }
+
+    StdioFileSystem sd(scratch);
+    bool ok = true;
+
+    for (size_t i=0; i<sizeof(IMAGES)/sizeof(*IMAGES) && ok; ++i) {
+
+        const char *image = IMAGES[i];
+        std::string path  = sd.root + "/" + image;
+
+        Bitmap      bitmap;
+        std::string error;
+        if (!copyFile(std::string("../artwork/") + image, path) || !loadBMP(path, bitmap, error)) {
+            fprintf(stderr, "error: cannot copy %s\n", image);
+            ok = false;
+            break;
+        }
+
+        std::vector<uint16_t> reference;
+        for (size_t p=0; p<bitmap.pixels.size(); ++p) reference.push_back(argbToRgb565(bitmap.pixels[p]));
+
+        printf("%s (%ux%u)\n", image, bitmap.width, bitmap.height);
+        printf("  %-14s %-8s %10s %12s\n", "load", "status", "bytes read", "ns per load");
+
+        ok = load(sd, image, bitmap, false, gfx::BMP_DECODED, reference, runs)
+          && load(sd, image, bitmap, true,  gfx::BMP_DECODED, reference, 0)     // writes the sidecar
+          && load(sd, image, bitmap, true,  gfx::BMP_CACHED,  reference, runs);
+
+        // a BMP with another timestamp invalidates its sidecar
+        struct utimbuf times = { 0, 0 };
+        ok = ok && !utime(path.c_str(), &times)
+          && load(sd, image, bitmap, true, gfx::BMP_DECODED, reference, 0)
+          && load(sd, image, bitmap, true, gfx::BMP_CACHED,  reference, 0);
+
+        char sidecar[gfx::BMP_MAX_PATH];
+        gfx::bmpCachePath(image, sidecar);
+        unlink((sd.root + "/" + sidecar).c_str());
+        unlink(path.c_str());
+
+        // the same image with its masks after a 40-byte header, if it has some
+        const char *v3 = "info-header.bmp";
+        if (copyWithInfoHeader(std::string("../artwork/") + image, sd.root + "/" + v3)) {
+            ok = ok && load(sd, v3, bitmap, false, gfx::BMP_DECODED, reference, 0);
+            unlink((sd.root + "/" + v3).c_str());
+        }
+
+    }
+
+    rmdir(scratch);
+    return ok ? 0 : 1;
+
+}
@@ -0,0 +1,119 @@
+/**
+ * ----------------------------------------------------------------------------
+ * Handling images on the Gamebuino META
+ * © 2021 Stéphane Calderoni
+ * ----------------------------------------------------------------------------
+ * Host-side BMP reader used by the asset tools
+ * ----------------------------------------------------------------------------
+ * Only what the SD card images need: uncompressed 24-bit and 32-bit images,
+ * with or without color masks (BI_RGB or BI_BITFIELDS), stored bottom-up or
+ * top-down. Pixels are decoded into the same Bitmap as the PNG reader.
+ * ----------------------------------------------------------------------------
+ */
+
+#pragma once
+
+#include "png.h"
+
+namespace bmp {
+
+    inline uint16_t le16(const uint8_t *p) {
+        return p[0] | p[1] << 8;
+    }
+
+    inline uint32_t le32(const uint8_t *p) {
+        return (uint32_t)p[0] | (uint32_t)p[1] << 8 | (uint32_t)p[2] << 16 | (uint32_t)p[3] << 24;
+    }
+
+    // Extracts the channel selected by `mask` and scales it to 8 bits.
+    inline uint8_t channel(uint32_t pixel, uint32_t mask) {
+
+        if (!mask) return 0xff;
+
+        uint8_t shift = 0;
+        while (!(mask & 1)) { mask >>= 1; ++shift; }
+
+        uint32_t value = (pixel >> shift) & mask;
+        return mask == 0xff ? value : value * 0xff / mask;
+
+    }
+
+}
+
+inline bool loadBMP(const std::string &path, Bitmap &bitmap, std::string &error) {
+
+    std::vector<uint8_t> bytes;
+    if (!readFile(path, bytes)) {
+        error = "cannot read " + path;
+        return false;
+    }
+
+    if (bytes.size() < 54 || bytes[0] != 'B' || bytes[1] != 'M') {
+        error = path + " is not a BMP file";
+        return false;
+    }
+
+    const uint8_t *p = &bytes[0];
+
+    uint32_t offset      = bmp::le32(p + 10);
+    uint32_t info        = bmp::le32(p + 14);
+    int32_t  width       = bmp::le32(p + 18);
+    int32_t  height      = bmp::le32(p + 22);
+    uint16_t bpp         = bmp::le16(p + 28);
+    uint32_t compression = bmp::le32(p + 30);
+
+    uint32_t masks[4] = { 0xff0000, 0xff00, 0xff, 0 }; // red, green, blue, alpha
+
+    // the masks end a header of 52 bytes or more, or follow a 40-byte one
+    if (compression == 3 && (info >= 52 || (info == 40 && offset >= 54 + 12))) {
+        for (uint8_t i=0; i<(info >= 56 ? 4 : 3); ++i) masks[i] = bmp::le32(p + 54 + 4*i);
+    } else if (compression != 0) {
+        error = path + ": compressed BMP files are not supported";
+        return false;
+    }
+
+    if ((bpp != 24 && bpp != 32) || width <= 0 || height == 0) {
+        error = path + ": only 24-bit and 32-bit BMP files are supported";
+        return false;
+    }
+
+    bool     bottomUp = height > 0;
+    uint32_t rows     = bottomUp ? height : -height;
+    uint32_t stride   = (width * (bpp / 8) + 3) & ~3u;
+
+    if (offset + stride * rows > bytes.size()) {
+        error = path + " is truncated";
+        return false;
+    }
+
+    bitmap.width  = width;
+    bitmap.height = rows;
+    bitmap.pixels.resize(width * rows);
+
+    for (uint32_t y=0; y<rows; ++y) {
+
+        const uint8_t *row = p + offset + (bottomUp ? rows - 1 - y : y) * stride;
+
+        for (int32_t x=0; x<width; ++x) {
+
+            uint32_t pixel;
+            if (bpp == 24) pixel = 0xff000000 | row[3*x + 2] << 16 | row[3*x + 1] << 8 | row[3*x];
+            else           pixel = bmp::le32(row + 4*x);
+
+            if (bpp == 24 || compression == 0) {
+                bitmap.pixels[x + y * width] = pixel | (bpp == 32 ? 0xff000000 : 0);
+            } else {
+                bitmap.pixels[x + y * width] =
+                    (uint32_t)bmp::channel(pixel, masks[3]) << 24 |
+                    (uint32_t)bmp::channel(pixel, masks[0]) << 16 |
+                    (uint32_t)bmp::channel(pixel, masks[1]) <<  8 |
+                    (uint32_t)bmp::channel(pixel, masks[2]);
+            }
+
+        }
+
+    }
+
+    return true;
+
+}
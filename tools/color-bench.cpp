@@ -0,0 +1,148 @@
+/**
+ * ----------------------------------------------------------------------------
+ * Handling images on the Gamebuino META
+ * © 2021 Stéphane Calderoni
+ * ----------------------------------------------------------------------------
+ * Benchmark: fixed-point color math against float channel arithmetic
+ * ----------------------------------------------------------------------------
+ * Usage: color-bench [runs]
+ *
+ * Compares every function of gfx/color.h with the float computation it
+ * stands for, written the way updatePalette() of example-07 does it: shade
+ * and tint for every RGB565 color and every factor k / 256, lerp and blend
+ * for a sample of color pairs. Then reports
+ * the time taken to shade, tint, lerp and blend a 256-color buffer both ways.
+ *
+ * On the host, float operations are done in hardware: the gap is much wider
+ * on the SAMD21, where each of them is a soft-float call.
+ * ----------------------------------------------------------------------------
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include "bench.h"
+#include "../gfx/color.h"
+
+// computed by the compiler
+constexpr uint16_t DARK  = 0x2104;
+constexpr uint16_t LIGHT = 0xfe60;
+constexpr uint16_t RAMP[] = { gfx::lerp(DARK, LIGHT, 0), gfx::lerp(DARK, LIGHT, 16), gfx::lerp(DARK, LIGHT, 32) };
+
+static_assert(RAMP[0] == DARK && RAMP[2] == LIGHT, "lerp ends");
+static_assert(gfx::fraction(.8f) == 205, "fraction");
+static_assert(gfx::shade(0xffff, 256) == 0xffff && gfx::shade(0xffff, 0) == 0, "shade bounds");
+static_assert(gfx::tint(0x0000, 256) == 0xffff && gfx::tint(0x1234, 0) == 0x1234, "tint bounds");
+static_assert(gfx::blend(0xffff, 0x0000) == 0x7bef, "blend");
+
+// References, one float computation per channel.
+
+uint16_t shadeFloat(uint16_t c, float f) {
+    uint8_t r = f * (c >> 11);
+    uint8_t g = f * ((c >> 5) & 0x3f);
+    uint8_t b = f * (c & 0x1f);
+    return (r << 11) | (g << 5) | b;
+}
+
+uint16_t tintFloat(uint16_t c, float f) {
+    uint8_t r = c >> 11, g = (c >> 5) & 0x3f, b = c & 0x1f;
+    r += (uint8_t)(f * (0x1f - r));
+    g += (uint8_t)(f * (0x3f - g));
+    b += (uint8_t)(f * (0x1f - b));
+    return (r << 11) | (g << 5) | b;
+}
+
+uint16_t mix(uint8_t a, uint8_t b, float f) {
+    return a * (1 - f) + b * f;
+}
+
+uint16_t lerpFloat(uint16_t a, uint16_t b, float f) {
+    uint8_t r = mix(a >> 11, b >> 11, f);
+    uint8_t g = mix((a >> 5) & 0x3f, (b >> 5) & 0x3f, f);
+    uint8_t c = mix(a & 0x1f, b & 0x1f, f);
+    return (r << 11) | (g << 5) | c;
+}
+
+bool fail(const char *what, uint16_t a, uint16_t b, uint16_t k, uint16_t expected, uint16_t actual) {
+    fprintf(stderr, "error: %s(0x%04x, 0x%04x, %u) = 0x%04x instead of 0x%04x\n", what, a, b, k, actual, expected);
+    return false;
+}
+
+bool check() {
+
+    for (uint32_t c=0; c<0x10000; ++c) {
+
+        // updatePalette() of example-07, applied once and twice
+        uint16_t once = shadeFloat(c, .8f);
+        if (gfx::shade(c, gfx::fraction(.8f)) != once) return fail("shade", c, 0, gfx::fraction(.8f), once, gfx::shade(c, gfx::fraction(.8f)));
+        if (gfx::shade(gfx::shade(c, 205), 205) != shadeFloat(once, .8f)) return fail("shade twice", c, 0, 205, shadeFloat(once, .8f), gfx::shade(gfx::shade(c, 205), 205));
+
+        for (uint16_t k=0; k<=256; ++k) {
+            uint16_t s = shadeFloat(c, k / 256.f);
+            uint16_t t = tintFloat(c, k / 256.f);
+            if (gfx::shade(c, k) != s) return fail("shade", c, 0, k, s, gfx::shade(c, k));
+            if (gfx::tint(c, k)  != t) return fail("tint",  c, 0, k, t, gfx::tint(c, k));
+        }
+
+    }
+
+    for (uint32_t a=0; a<0x10000; a+=7) {
+        for (uint32_t b=0; b<0x10000; b+=251) {
+
+            uint16_t m = lerpFloat(a, b, .5f);
+            if (gfx::blend(a, b) != m) return fail("blend", a, b, 0, m, gfx::blend(a, b));
+
+            for (uint8_t t=0; t<=32; ++t) {
+                uint16_t l = lerpFloat(a, b, t / 32.f);
+                if (gfx::lerp(a, b, t) != l) return fail("lerp", a, b, t, l, gfx::lerp(a, b, t));
+            }
+
+        }
+    }
+
+    return true;
+
+}
+
+const size_t COLORS = 256;
+
+int main(int argc, char **argv) {
+
+    const uint32_t runs = argc > 1 ? strtoul(argv[1], NULL, 0) : 100000;
+
+    bool ok = check();
+
+    static uint16_t colors[COLORS], other[COLORS], out[COLORS];
+    for (size_t i=0; i<COLORS; ++i) {
+        colors[i] = i * 0x9e37;
+        other[i]  = i * 0x7f4b + 0x1234;
+    }
+
+    // kept out of reach of constant folding
+    volatile float    vf = .8f;
+    volatile uint16_t vk = 205;
+    volatile uint8_t  vt = 12;
+    const float       f  = vf;
+    const uint16_t    k  = vk;
+    const uint8_t     t  = vt;
+
+    printf("%-8s %12s %12s %8s   (%zu colors)\n", "op", "float ns", "fixed ns", "speedup", COLORS);
+
+    double fs = measure(runs, [&] { for (size_t i=0; i<COLORS; ++i) out[i] = shadeFloat(colors[i], f); consume(out); });
+    double xs = measure(runs, [&] { for (size_t i=0; i<COLORS; ++i) out[i] = gfx::shade(colors[i], k); consume(out); });
+    printf("%-8s %12.1f %12.1f %7.2fx\n", "shade", fs, xs, fs / xs);
+
+    double ft = measure(runs, [&] { for (size_t i=0; i<COLORS; ++i) out[i] = tintFloat(colors[i], f); consume(out); });
+    double xt = measure(runs, [&] { for (size_t i=0; i<COLORS; ++i) out[i] = gfx::tint(colors[i], k); consume(out); });
+    printf("%-8s %12.1f %12.1f %7.2fx\n", "tint", ft, xt, ft / xt);
+
+    double fl = measure(runs, [&] { for (size_t i=0; i<COLORS; ++i) out[i] = lerpFloat(colors[i], other[i], t / 32.f); consume(out); });
+    double xl = measure(runs, [&] { for (size_t i=0; i<COLORS; ++i) out[i] = gfx::lerp(colors[i], other[i], t); consume(out); });
+    printf("%-8s %12.1f %12.1f %7.2fx\n", "lerp", fl, xl, fl / xl);
+
+    double fb = measure(runs, [&] { for (size_t i=0; i<COLORS; ++i) out[i] = lerpFloat(colors[i], other[i], .5f); consume(out); });
+    double xb = measure(runs, [&] { for (size_t i=0; i<COLORS; ++i) out[i] = gfx::blend(colors[i], other[i]); consume(out); });
+    printf("%-8s %12.1f %12.1f %7.2fx\n", "blend", fb, xb, fb / xb);
+
+    return ok ? 0 : 1;
+
+}
@@ -0,0 +1,846 @@
+/**
+ * ----------------------------------------------------------------------------
+ * Handling images on the Gamebuino META
+ * © 2021 Stéphane Calderoni
+ * ----------------------------------------------------------------------------
+ * Headless host stand-in for the Gamebuino-Meta library
+ * ----------------------------------------------------------------------------
+ * Implements the part of the library the sketches of this repository use, on
+ * top of real framebuffers, so that they can be built and profiled on Linux:
+ *
+ *   - Image from flash arrays (RGB565 and indexed), from BMP files and in RAM
+ *   - drawImage: plain, stretched or flipped (negative sizes), sub-rectangle
+ *   - setFrame, frame loop, transparent color keys, setPalette
+ *   - the three DISPLAY_MODE settings of config-gamebuino.h
+ *   - a 3x5 font for print / printf, display.init / nextFrame for BMP strips
+ *   - gb.tft, the 160x128 panel, for the sketches that write to it directly:
+ *     the frames dumped by the runner are then taken from it
+ *   - buttons driven by a fixed input script, SD files through stdio
+ *
+ * drawImage follows the generic path of the library, one coordinate
+ * computation, clipping test and color key test per pixel, so that its cost
+ * is a fair baseline for the optimized blitters of gfx/. Every draw updates
+ * the counters of `host::counters()`, which tools/host/runner.cpp reports
+ * per frame along with the time spent between two `gb.waitForUpdate()`.
+ *
+ * Time is simulated: millis() advances by one frame period per frame. Only
+ * micros() reads the real clock, for the timings of gfx/profiler.h.
+ *
+ * SerialUSB writes into the file given to the runner with -S.
+ * ----------------------------------------------------------------------------
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <math.h>
+#include <vector>
+#include "../bmp.h"
+#include "../stdio-file.h"
+
+#define DISPLAY_MODE_RGB565         0
+#define DISPLAY_MODE_INDEX          1
+#define DISPLAY_MODE_INDEX_HALFRES  2
+
+#ifndef DISPLAY_MODE
+#include "../../config-gamebuino.h"
+#endif
+
+#ifndef DISPLAY_MODE
+#define DISPLAY_MODE DISPLAY_MODE_RGB565
+#endif
+
+#ifndef PI
+#define PI 3.1415926535897932384626433832795
+#endif
+
+// ----------------------------------------------------------------------------
+// Colors
+// ----------------------------------------------------------------------------
+
+enum class ColorMode : uint8_t {
+    rgb565,
+    index
+};
+
+enum class Color : uint16_t {
+    black      = 0x0000,
+    darkblue   = 0x194a,
+    purple     = 0x792a,
+    green      = 0x042a,
+    brown      = 0xaa86,
+    darkgray   = 0x5aa9,
+    gray       = 0xc618,
+    white      = 0xffff,
+    red        = 0xf809,
+    orange     = 0xfd00,
+    yellow     = 0xff64,
+    lightgreen = 0x0727,
+    lightblue  = 0x2d7f,
+    blue       = 0x83b3,
+    pink       = 0xfbb5,
+    beige      = 0xfe75
+};
+
+#define BLACK      Color::black
+#define DARKBLUE   Color::darkblue
+#define PURPLE     Color::purple
+#define GREEN      Color::green
+#define BROWN      Color::brown
+#define DARKGRAY   Color::darkgray
+#define GRAY       Color::gray
+#define WHITE      Color::white
+#define RED        Color::red
+#define ORANGE     Color::orange
+#define YELLOW     Color::yellow
+#define LIGHTGREEN Color::lightgreen
+#define LIGHTBLUE  Color::lightblue
+#define BLUE       Color::blue
+#define PINK       Color::pink
+#define BEIGE      Color::beige
+
+namespace host {
+
+    const uint32_t RAM_SIZE = 32768;
+
+    const Color DEFAULT_PALETTE[16] = {
+        BLACK, DARKBLUE, PURPLE, GREEN, BROWN, DARKGRAY, GRAY, WHITE,
+        RED, ORANGE, YELLOW, LIGHTGREEN, LIGHTBLUE, BLUE, PINK, BEIGE
+    };
+
+    // 3x5 glyphs of the characters 0x20 to 0x5f, one bit per pixel, rows
+    // from the most significant bits down
+    const uint16_t FONT[64] = {
+        0x0000, 0x2482, 0x5a00, 0x5f7d, 0x3c9e, 0x52a5, 0x2aab, 0x2400,
+        0x1491, 0x4494, 0x0aa8, 0x05d0, 0x0014, 0x01c0, 0x0002, 0x12a4,
+        0x7b6f, 0x2c97, 0x73e7, 0x72cf, 0x5bc9, 0x79cf, 0x79ef, 0x7252,
+        0x7bef, 0x7bcf, 0x0410, 0x0414, 0x1511, 0x0e38, 0x4454, 0x72c2,
+        0x2b63, 0x2bed, 0x6bae, 0x3923, 0x6b6e, 0x79a7, 0x79a4, 0x396b,
+        0x5bed, 0x7497, 0x126a, 0x5bad, 0x4927, 0x5fed, 0x6b6d, 0x2b6a,
+        0x6ba4, 0x2b73, 0x6bad, 0x388e, 0x7492, 0x5b6b, 0x5b52, 0x5bfd,
+        0x5aad, 0x5a92, 0x72a7, 0x6926, 0x4889, 0x324b, 0x2a00, 0x0007
+    };
+
+    // Work done by the drawing calls since the last reset.
+    struct Counters {
+
+        uint32_t draws;       // drawImage calls
+        uint32_t pixels;      // pixels written to a target
+        uint32_t sourceBytes; // bytes of image data read
+
+        Counters() : draws(0), pixels(0), sourceBytes(0) {}
+
+    };
+
+    inline Counters &counters() {
+        static Counters c;
+        return c;
+    }
+
+    inline uint32_t &frameCount() {
+        static uint32_t count = 0;
+        return count;
+    }
+
+    // Bytes held by the Image buffers allocated in RAM.
+    inline uint32_t &heap() {
+        static uint32_t bytes = 0;
+        return bytes;
+    }
+
+    inline uint64_t nanos() {
+        struct timespec t;
+        clock_gettime(CLOCK_MONOTONIC, &t);
+        return (uint64_t)t.tv_sec * 1000000000u + t.tv_nsec;
+    }
+
+    inline void writePPMPixel(FILE *file, uint16_t c) {
+        uint8_t r = c >> 11, g = (c >> 5) & 0x3f, b = c & 0x1f;
+        uint8_t rgb[3] = { (uint8_t)(r << 3 | r >> 2), (uint8_t)(g << 2 | g >> 4), (uint8_t)(b << 3 | b >> 2) };
+        fwrite(rgb, 1, 3, file);
+    }
+
+    // Directory standing for the root of the SD card.
+    inline StdioFileSystem &sd() {
+        static StdioFileSystem fs("../artwork");
+        return fs;
+    }
+
+    inline uint16_t indexOf(const Color *palette, uint16_t color) {
+
+        uint8_t  best     = 0;
+        uint32_t distance = ~0u;
+
+        for (uint8_t i=0; i<16; ++i) {
+
+            uint16_t c = (uint16_t)palette[i];
+            if (c == color) return i;
+
+            int dr = (c >> 11) - (color >> 11);
+            int dg = ((c >> 5) & 0x3f) - ((color >> 5) & 0x3f);
+            int db = (c & 0x1f) - (color & 0x1f);
+            uint32_t d = 4*dr*dr + dg*dg + 4*db*db;
+            if (d < distance) { distance = d; best = i; }
+
+        }
+
+        return best;
+
+    }
+
+}
+
+// pixels copied by the gfx/ helpers that bypass drawImage
+#define GFX_COUNT_PIXELS(n) (host::counters().pixels += (n))
+
+// run-time checks of the gfx/ helpers, off on the console
+#ifndef GFX_DEBUG
+#define GFX_DEBUG 1
+#endif
+
+// ----------------------------------------------------------------------------
+// Images
+// ----------------------------------------------------------------------------
+
+class Image {
+
+    public:
+
+        uint16_t *_buffer;   // RGB565 words, or packed 4-bit indices
+        ColorMode colorMode;
+        uint16_t  frames, frame;
+        uint8_t   frameLoop;
+        uint16_t  transparentColor;
+        bool      useTransparent;
+        const Color *colorIndex; // palette of indexed images and targets
+
+        Image(const uint16_t *data)
+        : colorMode(ColorMode::rgb565), frame(0), colorIndex(host::DEFAULT_PALETTE), _owned(false), _loopCounter(0), _lastFrameCount(~0u) {
+            _w = data[0];
+            _h = data[1];
+            frames = data[2];
+            frameLoop = data[3];
+            transparentColor = data[4];
+            useTransparent = true;
+            _buffer = (uint16_t*)(data + 6);
+        }
+
+        Image(const uint8_t *data)
+        : colorMode(ColorMode::index), frame(0), colorIndex(host::DEFAULT_PALETTE), _owned(false), _loopCounter(0), _lastFrameCount(~0u) {
+            _w = data[0];
+            _h = data[1];
+            frames = data[2] | data[3] << 8;
+            frameLoop = data[4];
+            transparentColor = data[5];
+            useTransparent = transparentColor < 16;
+            _buffer = (uint16_t*)(data + 7);
+        }
+
+        Image(uint16_t w, uint16_t h, ColorMode mode = ColorMode::rgb565, uint16_t frames = 1, uint8_t loop = 1)
+        : colorMode(mode), frames(frames), frame(0), frameLoop(loop), transparentColor(0), useTransparent(false)
+        , colorIndex(host::DEFAULT_PALETTE), _owned(false), _loopCounter(0), _lastFrameCount(~0u) {
+            allocate(w, h);
+        }
+
+        // BMP file read from the SD card, converted to RGB565.
+        Image(const char *path)
+        : colorMode(ColorMode::rgb565), frames(1), frame(0), frameLoop(0), transparentColor(0), useTransparent(false)
+        , colorIndex(host::DEFAULT_PALETTE), _owned(false), _loopCounter(0), _lastFrameCount(~0u) {
+
+            Bitmap      bitmap;
+            std::string error;
+            if (!loadBMP(host::sd().root + "/" + path, bitmap, error)) {
+                fprintf(stderr, "warning: %s\n", error.c_str());
+            }
+
+            allocate(bitmap.width, bitmap.height);
+            for (size_t i=0; i<bitmap.pixels.size(); ++i) _buffer[i] = argbToRgb565(bitmap.pixels[i]);
+
+        }
+
+        ~Image() {
+            if (_owned) {
+                host::heap() -= bufferSize();
+                free(_buffer);
+            }
+        }
+
+        Image(const Image &) = delete;
+        Image &operator=(const Image &) = delete;
+
+        uint16_t width()  const { return _w; }
+        uint16_t height() const { return _h; }
+
+        uint32_t bufferSize() const {
+            return frames * frameSize();
+        }
+
+        // as named by the library
+        uint16_t getBufferSize() const {
+            return bufferSize();
+        }
+
+        void setFrame(uint16_t f) {
+            frame = f < frames ? f : 0;
+        }
+
+        void setPalette(const Color *palette) {
+            colorIndex = palette;
+        }
+
+        void setTransparentColor(Color color) {
+            transparentColor = (uint16_t)color;
+            useTransparent   = true;
+        }
+
+        void clear() {
+            memset(frameBuffer(frame), 0, frameSize());
+        }
+
+        // Raw pixel of the current frame: an RGB565 color or a palette index.
+        uint16_t get(uint16_t x, uint16_t y) const {
+            if (colorMode == ColorMode::rgb565) return ((const uint16_t*)frameBuffer(frame))[x + y * _w];
+            uint8_t byte = ((const uint8_t*)frameBuffer(frame))[x / 2 + y * stride()];
+            return x & 1 ? byte & 0xf : byte >> 4;
+        }
+
+        void set(uint16_t x, uint16_t y, uint16_t value) {
+            if (colorMode == ColorMode::rgb565) {
+                ((uint16_t*)frameBuffer(frame))[x + y * _w] = value;
+            } else {
+                uint8_t &byte = ((uint8_t*)frameBuffer(frame))[x / 2 + y * stride()];
+                byte = x & 1 ? (byte & 0xf0) | value : (byte & 0x0f) | value << 4;
+            }
+        }
+
+        // RGB565 color of a pixel, through the palette of indexed images.
+        uint16_t rgb565(uint16_t x, uint16_t y) const {
+            uint16_t value = get(x, y);
+            return colorMode == ColorMode::rgb565 ? value : (uint16_t)colorIndex[value];
+        }
+
+        // Writes a color given in the color mode of `source`.
+        void plot(int16_t x, int16_t y, uint16_t value, const Image &source) {
+
+            // indexed images carry no palette: the one of the target applies
+            if (colorMode != source.colorMode) {
+                value = colorMode == ColorMode::rgb565 ? (uint16_t)colorIndex[value] : host::indexOf(colorIndex, value);
+            }
+
+            set(x, y, value);
+            ++host::counters().pixels;
+
+        }
+
+        void drawImage(int16_t x, int16_t y, Image &img) {
+            draw(x, y, img, 0, 0, img._w, img._h, img._w, img._h);
+        }
+
+        void drawImage(int16_t x, int16_t y, Image &img, int16_t w2, int16_t h2) {
+            draw(x, y, img, 0, 0, img._w, img._h, w2, h2);
+        }
+
+        void drawImage(int16_t x, int16_t y, Image &img, int16_t x2, int16_t y2, int16_t w2, int16_t h2) {
+            draw(x, y, img, x2, y2, w2, h2, w2, h2);
+        }
+
+        template <typename T>
+        void drawImage(int16_t x, int16_t y, const T *data) {
+            Image img(data);
+            drawImage(x, y, img);
+        }
+
+    protected:
+
+        uint16_t _w, _h;
+        bool     _owned;
+        uint8_t  _loopCounter;
+        uint32_t _lastFrameCount;
+
+        uint16_t stride() const {
+            return colorMode == ColorMode::rgb565 ? 2 * _w : (_w + 1) / 2;
+        }
+
+        uint32_t frameSize() const {
+            return stride() * _h;
+        }
+
+        const uint8_t *frameBuffer(uint16_t f) const {
+            return (const uint8_t*)_buffer + f * frameSize();
+        }
+
+        uint8_t *frameBuffer(uint16_t f) {
+            return (uint8_t*)_buffer + f * frameSize();
+        }
+
+        void allocate(uint16_t w, uint16_t h) {
+            _w       = w;
+            _h       = h;
+            _owned   = true;
+            _buffer  = (uint16_t*)calloc(bufferSize() ? bufferSize() : 1, 1);
+            host::heap() += bufferSize();
+        }
+
+        // Frame loop: the image moves on every `frameLoop` rendered frames.
+        void animate() {
+
+            if (!frameLoop || frames < 2 || _lastFrameCount == host::frameCount()) return;
+
+            _lastFrameCount = host::frameCount();
+            if (++_loopCounter >= frameLoop) {
+                _loopCounter = 0;
+                frame = (frame + 1) % frames;
+            }
+
+        }
+
+        // Draws the (sx, sy, sw, sh) part of the current frame of `img` over a
+        // |dw| x |dh| area, mirrored along the axes whose size is negative.
+        void draw(int16_t x, int16_t y, Image &img, int16_t sx, int16_t sy, int16_t sw, int16_t sh, int16_t dw, int16_t dh) {
+
+            host::Counters &counters = host::counters();
+            ++counters.draws;
+
+            img.animate();
+
+            bool     flipX = dw < 0, flipY = dh < 0;
+            uint16_t aw    = flipX ? -dw : dw;
+            uint16_t ah    = flipY ? -dh : dh;
+            uint32_t reads = 0;
+
+            for (uint16_t j=0; j<ah; ++j) {
+                for (uint16_t i=0; i<aw; ++i) {
+
+                    int16_t tx = x + i;
+                    int16_t ty = y + j;
+                    if (tx < 0 || ty < 0 || tx >= _w || ty >= _h) continue;
+
+                    int16_t u = sx + (flipX ? aw - 1 - i : i) * sw / aw;
+                    int16_t v = sy + (flipY ? ah - 1 - j : j) * sh / ah;
+                    if (u < 0 || v < 0 || u >= img._w || v >= img._h) continue;
+
+                    uint16_t value = img.get(u, v);
+                    ++reads;
+
+                    if (img.useTransparent && value == img.transparentColor) continue;
+
+                    plot(tx, ty, value, img);
+
+                }
+            }
+
+            counters.sourceBytes += img.colorMode == ColorMode::rgb565 ? 2 * reads : (reads + 1) / 2;
+
+        }
+
+};
+
+// ----------------------------------------------------------------------------
+// Display
+// ----------------------------------------------------------------------------
+
+class Display : public Image {
+
+    public:
+
+        Display()
+        : Image(0, 0), _fontSize(1), _textColor(WHITE), _video(0) {}
+
+        void begin() {
+
+            free(_buffer);
+            host::heap() -= bufferSize();
+
+            colorMode = DISPLAY_MODE == DISPLAY_MODE_RGB565 ? ColorMode::rgb565 : ColorMode::index;
+            // 160x128 in DISPLAY_MODE_INDEX, 80x64 in the two other modes
+            allocate(DISPLAY_MODE == DISPLAY_MODE_INDEX ? 160 : 80, DISPLAY_MODE == DISPLAY_MODE_INDEX ? 128 : 64);
+
+        }
+
+        void setFontSize(uint8_t size) { _fontSize = size; }
+        void setColor(Color color)     { _textColor = color; }
+
+        void print(int16_t x, int16_t y, const char *text) {
+
+            for (int16_t cx = x; *text; ++text) {
+
+                uint8_t c = *text;
+                if (c == '\n') { cx = x; y += 6 * _fontSize; continue; }
+                if (c >= 'a' && c <= 'z') c -= 0x20;
+                uint16_t glyph = c >= 0x20 && c < 0x60 ? host::FONT[c - 0x20] : 0;
+
+                for (uint8_t j=0; j<5*_fontSize; ++j) {
+                    for (uint8_t i=0; i<3*_fontSize; ++i) {
+                        if (!(glyph >> (14 - (j / _fontSize) * 3 - i / _fontSize) & 1)) continue;
+                        int16_t px = cx + i, py = y + j;
+                        if (px >= 0 && py >= 0 && px < _w && py < _h) plot(px, py, (uint16_t)_textColor, _rgb565);
+                    }
+                }
+
+                cx += 4 * _fontSize;
+
+            }
+
+        }
+
+        void printf(int16_t x, int16_t y, const char *format, ...) __attribute__((format(printf, 4, 5))) {
+
+            char text[128];
+            va_list args;
+            va_start(args, format);
+            vsnprintf(text, sizeof(text), format, args);
+            va_end(args);
+
+            print(x, y, text);
+
+        }
+
+        // Plays a BMP strip of display-sized frames stacked vertically.
+        void init(const char *path) {
+
+            std::string error;
+            if (!loadBMP(host::sd().root + "/" + path, _strip, error)) {
+                fprintf(stderr, "warning: %s\n", error.c_str());
+                _strip = Bitmap();
+            }
+
+            _video = 0;
+            nextFrame();
+
+        }
+
+        void nextFrame() {
+
+            uint32_t frameHeight = _strip.width ? _strip.width * 4 / 5 : 0;
+            if (!frameHeight || _strip.height < frameHeight) return;
+
+            uint32_t top = (_video++ % (_strip.height / frameHeight)) * frameHeight;
+
+            for (uint16_t y=0; y<_h && y<frameHeight; ++y) {
+                for (uint16_t x=0; x<_w && x<_strip.width; ++x) {
+                    plot(x, y, argbToRgb565(_strip.at(x, top + y)), _rgb565);
+                }
+            }
+
+            host::counters().sourceBytes += 4 * frameHeight * _strip.width;
+
+        }
+
+        // The RGB565 picture seen on the screen.
+        void writePPM(FILE *file) const {
+
+            fprintf(file, "P6\n%u %u\n255\n", _w, _h);
+
+            for (uint16_t y=0; y<_h; ++y) {
+                for (uint16_t x=0; x<_w; ++x) host::writePPMPixel(file, rgb565(x, y));
+            }
+
+        }
+
+    private:
+
+        // 1x1 RGB565 source handing colors given as RGB565 values to plot()
+        struct Rgb565 : Image {
+            Rgb565() : Image(0, 0) {}
+        } _rgb565;
+
+        uint8_t  _fontSize;
+        Color    _textColor;
+        Bitmap   _strip;
+        uint32_t _video;
+
+};
+
+// ----------------------------------------------------------------------------
+// Buttons, driven by a fixed script repeated every 128 frames
+// ----------------------------------------------------------------------------
+
+enum class Button : uint8_t {
+    down, left, right, up, a, b, menu, home
+};
+
+#define BUTTON_DOWN  Button::down
+#define BUTTON_LEFT  Button::left
+#define BUTTON_RIGHT Button::right
+#define BUTTON_UP    Button::up
+#define BUTTON_A     Button::a
+#define BUTTON_B     Button::b
+#define BUTTON_MENU  Button::menu
+#define BUTTON_HOME  Button::home
+
+class Buttons {
+
+    public:
+
+        Buttons() { memset(_held, 0, sizeof(_held)); }
+
+        // RIGHT held during frames 8-47, LEFT during 64-103, A pressed at
+        // frames 20 and 80: the avatar of the examples walks both ways and
+        // jumps once in each direction.
+        static uint8_t script(uint32_t frame) {
+
+            uint32_t t     = frame % 128;
+            uint8_t  state = 0;
+
+            if (t >=  8 && t <  48) state |= 1 << (uint8_t)Button::right;
+            if (t >= 64 && t < 104) state |= 1 << (uint8_t)Button::left;
+            if (t == 20 || t == 80) state |= 1 << (uint8_t)Button::a;
+
+            return state;
+
+        }
+
+        void update(uint32_t frame) {
+
+            uint8_t state = script(frame);
+
+            for (uint8_t b=0; b<8; ++b) {
+                if (state >> b & 1) _held[b] = _held[b] < 0xffff ? _held[b] + 1 : 0xffff;
+                else                _held[b] = _held[b] ? 0xffff : 0; // 0xffff: just released
+            }
+
+        }
+
+        bool pressed(Button b)  { return held(b) == 1; }
+        bool released(Button b) { return _held[(uint8_t)b] == 0xffff; }
+
+        uint16_t timeHeld(Button b) { return held(b); }
+
+        bool held(Button b, uint16_t time) { return held(b) == time + 1; }
+
+        bool repeat(Button b, uint16_t period) {
+            uint16_t t = held(b);
+            return t && (period <= 1 || (t - 1) % period == 0);
+        }
+
+    private:
+
+        uint16_t _held[8]; // frames held, 0xffff the frame of release
+
+        uint16_t held(Button b) {
+            uint16_t t = _held[(uint8_t)b];
+            return t == 0xffff ? 0 : t;
+        }
+
+};
+
+// ----------------------------------------------------------------------------
+// SD card and console
+// ----------------------------------------------------------------------------
+
+typedef StdioFile File;
+
+#define SD host::sd()
+
+// USB serial port: the lines printed by a sketch go to the file given to the
+// runner with -S, and nowhere otherwise.
+class SerialPort {
+
+    public:
+
+        FILE *file;
+
+        SerialPort() : file(NULL) {}
+
+        void begin(uint32_t) {}
+
+        explicit operator bool() const { return true; }
+
+        size_t print(const char *text) {
+            if (file) fputs(text, file);
+            return strlen(text);
+        }
+
+        size_t println(const char *text = "") {
+            return print(text) + print("\n");
+        }
+
+};
+
+extern SerialPort SerialUSB;
+
+// ----------------------------------------------------------------------------
+// Screen
+// ----------------------------------------------------------------------------
+
+// SPI bus shared with the screen: nothing to set up on the host.
+struct SPISettings {};
+
+struct SPIClass {
+    void beginTransaction(SPISettings) {}
+    void endTransaction() {}
+};
+
+extern SPIClass SPI;
+
+const SPISettings tftSPISettings;
+
+// 160x128 panel of the console, written directly by the sketches that
+// render at full resolution without gb.display (gfx/strip.h). Like the real
+// one, it takes the RGB565 words of sendBuffer with their bytes swapped, and
+// fills the window of setAddrWindow row by row.
+class Tft {
+
+    public:
+
+        static const int16_t WIDTH  = 160;
+        static const int16_t HEIGHT = 128;
+
+        Tft() : _x0(0), _y0(0), _x1(WIDTH - 1), _y1(HEIGHT - 1), _x(0), _y(0), _used(false) {
+            memset(_pixels, 0, sizeof(_pixels));
+        }
+
+        void setAddrWindow(int16_t x0, int16_t y0, int16_t x1, int16_t y1) {
+            _x0 = _x = x0;
+            _y0 = _y = y0;
+            _x1 = x1;
+            _y1 = y1;
+        }
+
+        void commandMode() {}
+        void dataMode()    {}
+        void idleMode()    {}
+
+        void sendBuffer(uint16_t *buffer, uint16_t n) {
+
+            for (uint16_t i=0; i<n; ++i) {
+
+                if (_x >= 0 && _y >= 0 && _x < WIDTH && _y < HEIGHT) _pixels[_y * WIDTH + _x] = buffer[i] << 8 | buffer[i] >> 8;
+
+                if (++_x > _x1) {
+                    _x = _x0;
+                    if (++_y > _y1) _y = _y0;
+                }
+
+            }
+
+            _used = true;
+
+        }
+
+        // Whether the sketch has written to the panel: the picture to dump.
+        bool used() const {
+            return _used;
+        }
+
+        void writePPM(FILE *file) const {
+
+            fprintf(file, "P6\n%u %u\n255\n", WIDTH, HEIGHT);
+
+            for (int16_t y=0; y<HEIGHT; ++y) {
+                for (int16_t x=0; x<WIDTH; ++x) host::writePPMPixel(file, _pixels[y * WIDTH + x]);
+            }
+
+        }
+
+    private:
+
+        uint16_t _pixels[WIDTH * HEIGHT];
+        int16_t  _x0, _y0, _x1, _y1;
+        int16_t  _x, _y;
+        bool     _used;
+
+};
+
+// Tft::sendBuffer copies the pixels at once: no DMA transfer to wait for.
+inline void wait_for_transfers_done() {}
+
+struct FrameStats {
+
+    uint64_t       nanos;
+    host::Counters counters;
+
+};
+
+class Gamebuino {
+
+    public:
+
+        Display  display;
+        Tft      tft;
+        Buttons  buttons;
+        uint32_t &frameCount;
+
+        // set by the runner
+        const char *dumpDirectory;
+        std::vector<FrameStats> stats;
+
+        Gamebuino()
+        : frameCount(host::frameCount()), dumpDirectory(NULL), _frameRate(25), _running(false), _start(0) {}
+
+        void begin() {
+            display.begin();
+        }
+
+        void setFrameRate(uint8_t fps) {
+            _frameRate = fps;
+        }
+
+        uint8_t getFrameRate() const {
+            return _frameRate;
+        }
+
+        uint32_t getFreeRam() const {
+            return host::RAM_SIZE > host::heap() ? host::RAM_SIZE - host::heap() : 0;
+        }
+
+        // Ends the frame being rendered, if any, and starts the next one.
+        void waitForUpdate() {
+            endFrame();
+            ++frameCount;
+            buttons.update(frameCount);
+            host::counters() = host::Counters();
+            _running = true;
+            _start   = nanos();
+        }
+
+        void endFrame() {
+
+            if (!_running) return;
+
+            FrameStats frame;
+            frame.nanos    = nanos() - _start;
+            frame.counters = host::counters();
+            stats.push_back(frame);
+            _running = false;
+
+            if (dumpDirectory) {
+                char path[512];
+                snprintf(path, sizeof(path), "%s/frame-%04u.ppm", dumpDirectory, (unsigned)stats.size());
+                FILE *file = fopen(path, "wb");
+                if (file) {
+                    if (tft.used()) tft.writePPM(file);
+                    else            display.writePPM(file);
+                    fclose(file);
+                }
+            }
+
+        }
+
+        uint32_t millis() const {
+            return frameCount * 1000 / _frameRate;
+        }
+
+    private:
+
+        uint8_t  _frameRate;
+        bool     _running;
+        uint64_t _start;
+
+        static uint64_t nanos() {
+            return host::nanos();
+        }
+
+};
+
+extern Gamebuino gb;
+
+inline uint32_t millis() { return gb.millis(); }
+inline uint32_t micros() { return host::nanos() / 1000; }
+
+inline long random(long max)           { return max > 0 ? rand() % max : 0; }
+inline long random(long min, long max) { return min + random(max - min); }
@@ -0,0 +1,107 @@
+/**
+ * ----------------------------------------------------------------------------
+ * Handling images on the Gamebuino META
+ * © 2021 Stéphane Calderoni
+ * ----------------------------------------------------------------------------
+ * Headless runner for the sketches, built on the host stand-in library
+ * ----------------------------------------------------------------------------
+ * Usage: <sketch> [-n frames] [-o directory] [-s sd root] [-S serial file] [-q | -t]
+ *
+ * The sketch is selected at build time with -DSKETCH='"path/to/sketch.h"'.
+ * Its setup() is called once, then loop() for the given number of frames
+ * (64 by default). Each frame is reported with the time spent rendering it
+ * and the counters of the drawing calls, and dumped as a PPM picture into
+ * the output directory when one is given. What the sketch prints on SerialUSB
+ * is written into the serial file, if any. -q only prints the totals, and -t
+ * prints them as a single line of numbers for tools/mode-estimate:
+ *
+ *   frames, ns per frame, worst ns, draws, pixels, source bytes per frame
+ * ----------------------------------------------------------------------------
+ */
+
+#include <Gamebuino-Meta.h>
+
+#ifndef SKETCH
+#error "SKETCH must name the sketch to run"
+#endif
+
+#include SKETCH
+
+Gamebuino  gb;
+SerialPort SerialUSB;
+SPIClass   SPI;
+
+int main(int argc, char **argv) {
+
+    uint32_t    frames = 64;
+    bool        quiet  = false;
+    bool        terse  = false;
+    const char *serial = NULL;
+
+    for (int arg=1; arg<argc; ++arg) {
+
+        bool value = arg + 1 < argc;
+
+        if      (!strcmp(argv[arg], "-n") && value) frames = strtoul(argv[++arg], NULL, 0);
+        else if (!strcmp(argv[arg], "-o") && value) gb.dumpDirectory = argv[++arg];
+        else if (!strcmp(argv[arg], "-s") && value) host::sd().root = argv[++arg];
+        else if (!strcmp(argv[arg], "-S") && value) serial = argv[++arg];
+        else if (!strcmp(argv[arg], "-q"))          quiet = true;
+        else if (!strcmp(argv[arg], "-t"))          quiet = terse = true;
+        else {
+            fprintf(stderr, "usage: %s [-n frames] [-o directory] [-s sd root] [-S serial file] [-q | -t]\n", argv[0]);
+            return 2;
+        }
+
+    }
+
+    if (serial && !(SerialUSB.file = fopen(serial, "w"))) {
+        fprintf(stderr, "error: cannot write %s\n", serial);
+        return 1;
+    }
+
+    setup();
+    for (uint32_t f=0; f<frames; ++f) loop();
+    gb.endFrame();
+
+    if (SerialUSB.file) fclose(SerialUSB.file);
+
+    if (!quiet) printf("%6s %10s %8s %8s %10s\n", "frame", "ns", "draws", "pixels", "src bytes");
+
+    uint64_t nanos = 0, worst = 0;
+    uint64_t draws = 0, pixels = 0, bytes = 0;
+
+    for (size_t f=0; f<gb.stats.size(); ++f) {
+
+        const FrameStats &s = gb.stats[f];
+
+        if (!quiet) printf("%6zu %10llu %8u %8u %10u\n", f + 1, (unsigned long long)s.nanos, s.counters.draws, s.counters.pixels, s.counters.sourceBytes);
+
+        nanos  += s.nanos;
+        worst   = s.nanos > worst ? s.nanos : worst;
+        draws  += s.counters.draws;
+        pixels += s.counters.pixels;
+        bytes  += s.counters.sourceBytes;
+
+    }
+
+    size_t n = gb.stats.size() ? gb.stats.size() : 1;
+
+    if (terse) {
+        printf(
+            "%zu %.0f %llu %.1f %.0f %.0f\n",
+            gb.stats.size(), double(nanos) / n, (unsigned long long)worst,
+            double(draws) / n, double(pixels) / n, double(bytes) / n
+        );
+        return 0;
+    }
+
+    printf(
+        "%s: %zu frames, %.0f ns per frame (worst %llu), %.1f draws, %.0f pixels, %.0f source bytes per frame\n",
+        SKETCH, gb.stats.size(), double(nanos) / n, (unsigned long long)worst,
+        double(draws) / n, double(pixels) / n, double(bytes) / n
+    );
+
+    return 0;
+
+}
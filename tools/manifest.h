@@ -0,0 +1,491 @@
+/**
+ * ----------------------------------------------------------------------------
+ * Handling images on the Gamebuino META
+ * © 2021 Stéphane Calderoni
+ * ----------------------------------------------------------------------------
+ * Host-side asset manifest (artwork/assets.cfg) and frame slicing
+ * ----------------------------------------------------------------------------
+ */
+
+#pragma once
+
+#include <stdlib.h>
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include "png.h"
+
+// ----------------------------------------------------------------------------
+// Manifest entries
+// ----------------------------------------------------------------------------
+
+struct AssetSpec {
+
+    std::string name;
+    std::string source;
+    std::string options; // options as written in the manifest
+    uint8_t     columns, rows;
+    uint16_t    loop;
+    bool        rgb565, indexed, rle, dedup, spans, mirror, atlas, modes;
+
+    AssetSpec() : columns(1), rows(1), loop(0), rgb565(false), indexed(false), rle(false), dedup(false), spans(false), mirror(false), atlas(false), modes(false) {}
+
+    // Options that change the generated arrays, part of the source hash.
+    std::string params() const {
+        return "loop=" + std::to_string(loop) + (dedup ? " dedup" : "");
+    }
+
+    bool has(const std::string &option) const {
+        return (" " + options + " ").find(" " + option + " ") != std::string::npos;
+    }
+
+};
+
+struct Manifest {
+
+    std::string directory; // where the source files live
+    std::string palette;
+    uint16_t    transparent;
+    std::vector<AssetSpec> assets;
+
+    Manifest() : transparent(0xf81f) {}
+
+    std::string path(const std::string &file) const {
+        return directory.empty() ? file : directory + "/" + file;
+    }
+
+};
+
+// ----------------------------------------------------------------------------
+// Manifest parsing
+// ----------------------------------------------------------------------------
+
+inline bool parseGrid(const std::string &file, uint8_t &columns, uint8_t &rows) {
+
+    size_t dash = file.rfind('-');
+    size_t dot  = file.rfind('.');
+    if (dash == std::string::npos || dot == std::string::npos || dot < dash) return false;
+
+    unsigned c, r;
+    char     tail;
+    if (sscanf(file.substr(dash + 1, dot - dash - 1).c_str(), "%ux%u%c", &c, &r, &tail) != 2) return false;
+    if (!c || !r || c > 0xff || r > 0xff) return false;
+
+    columns = c;
+    rows    = r;
+    return true;
+
+}
+
+inline bool loadManifest(const std::string &path, Manifest &manifest, std::string &error) {
+
+    std::ifstream in(path.c_str());
+    if (!in) {
+        error = "cannot read " + path;
+        return false;
+    }
+
+    size_t slash = path.rfind('/');
+    manifest.directory = slash == std::string::npos ? "" : path.substr(0, slash);
+
+    std::string line;
+    for (int number=1; std::getline(in, line); ++number) {
+
+        size_t hash = line.find('#');
+        if (hash != std::string::npos) line.erase(hash);
+
+        std::istringstream words(line);
+        std::string key, value;
+        if (!(words >> key)) continue;
+
+        std::ostringstream where;
+        where << path << ":" << number << ": ";
+
+        if (!(words >> value)) {
+            error = where.str() + "missing value for " + key;
+            return false;
+        }
+
+        if (key == "palette") {
+
+            manifest.palette = value;
+
+        } else if (key == "transparent") {
+
+            manifest.transparent = strtoul(value.c_str(), NULL, 0);
+
+        } else {
+
+            AssetSpec asset;
+            asset.name   = key;
+            asset.source = value;
+
+            if (!parseGrid(value, asset.columns, asset.rows)) {
+                error = where.str() + value + " is not named <name>-<columns>x<rows>.png";
+                return false;
+            }
+
+            std::string option;
+            while (words >> option) {
+
+                if      (option == "rgb565")             asset.rgb565  = true;
+                else if (option == "indexed")            asset.indexed = true;
+                else if (option == "rle")                asset.rle     = true;
+                else if (option == "dedup")              asset.dedup   = true;
+                else if (option == "spans")              asset.spans   = true;
+                else if (option == "mirror")             asset.mirror  = true;
+                else if (option == "atlas")              asset.atlas   = true;
+                else if (option == "modes")              asset.modes   = asset.rgb565 = asset.indexed = true;
+                else if (option.compare(0, 5, "loop=") == 0) asset.loop = strtoul(option.c_str() + 5, NULL, 0);
+                else {
+                    error = where.str() + "unknown option " + option;
+                    return false;
+                }
+
+                asset.options += (asset.options.empty() ? "" : " ") + option;
+
+            }
+
+            if (!asset.rgb565 && !asset.indexed && !asset.rle && !asset.atlas) asset.rgb565 = true;
+
+            if (asset.dedup && asset.loop) {
+                error = where.str() + "dedup cannot be combined with loop, the console would play the stored frames";
+                return false;
+            }
+
+            manifest.assets.push_back(asset);
+
+        }
+
+    }
+
+    return true;
+
+}
+
+// ----------------------------------------------------------------------------
+// Sheet slicing: frames are read left to right, top to bottom
+// ----------------------------------------------------------------------------
+
+struct Frames {
+
+    uint16_t width, height, count;
+    std::vector<uint16_t> pixels; // count * width * height RGB565 values
+
+    Frames() : width(0), height(0), count(0) {}
+
+    uint32_t size() const {
+        return width * height;
+    }
+
+    const uint16_t *frame(uint16_t n) const {
+        return &pixels[n * size()];
+    }
+
+};
+
+inline bool sliceFrames(const Bitmap &sheet, const AssetSpec &asset, uint16_t transparent, Frames &frames, std::string &error) {
+
+    if (sheet.width % asset.columns || sheet.height % asset.rows) {
+        error = asset.source + " cannot be split into a " + std::to_string(asset.columns) + "x" + std::to_string(asset.rows) + " grid";
+        return false;
+    }
+
+    frames.width  = sheet.width  / asset.columns;
+    frames.height = sheet.height / asset.rows;
+    frames.count  = asset.columns * asset.rows;
+    frames.pixels.clear();
+    frames.pixels.reserve(frames.count * frames.size());
+
+    for (uint8_t r=0; r<asset.rows; ++r) {
+        for (uint8_t c=0; c<asset.columns; ++c) {
+            for (uint16_t y=0; y<frames.height; ++y) {
+                for (uint16_t x=0; x<frames.width; ++x) {
+
+                    uint32_t argb = sheet.at(c * frames.width + x, r * frames.height + y);
+                    frames.pixels.push_back((argb >> 24) < 0x80 ? transparent : argbToRgb565(argb));
+
+                }
+            }
+        }
+    }
+
+    return true;
+
+}
+
+// Keeps the first occurrence of every frame. `table` maps each frame of the
+// sheet to its position among the stored ones.
+inline void dedupFrames(const Frames &frames, Frames &unique, std::vector<uint16_t> &table) {
+
+    unique.width  = frames.width;
+    unique.height = frames.height;
+    unique.count  = 0;
+    unique.pixels.clear();
+    table.clear();
+
+    for (uint16_t f=0; f<frames.count; ++f) {
+
+        uint16_t u = 0;
+        while (u < unique.count && !std::equal(frames.frame(f), frames.frame(f) + frames.size(), unique.frame(u))) ++u;
+
+        if (u == unique.count) {
+            unique.pixels.insert(unique.pixels.end(), frames.frame(f), frames.frame(f) + frames.size());
+            ++unique.count;
+        }
+
+        table.push_back(u);
+
+    }
+
+}
+
+// Horizontally mirrored copy of every frame.
+inline void mirrorFrames(const Frames &frames, Frames &mirrored) {
+
+    mirrored = frames;
+
+    for (uint32_t row=0; row<(uint32_t)frames.count * frames.height; ++row) {
+        uint16_t *pixel = &mirrored.pixels[row * frames.width];
+        std::reverse(pixel, pixel + frames.width);
+    }
+
+}
+
+// Every frame enlarged `factor` times, each pixel becoming a factor x factor
+// block.
+inline void scaleFrames(const Frames &frames, uint8_t factor, Frames &scaled) {
+
+    scaled.width  = frames.width  * factor;
+    scaled.height = frames.height * factor;
+    scaled.count  = frames.count;
+    scaled.pixels.clear();
+    scaled.pixels.reserve(scaled.count * scaled.size());
+
+    for (uint32_t row=0; row<(uint32_t)frames.count * frames.height; ++row) {
+        const uint16_t *pixel = &frames.pixels[row * frames.width];
+        for (uint8_t j=0; j<factor; ++j) {
+            for (uint16_t x=0; x<frames.width; ++x) scaled.pixels.insert(scaled.pixels.end(), factor, pixel[x]);
+        }
+    }
+
+}
+
+// ----------------------------------------------------------------------------
+// Atlas packing: the frames of several assets in a single image
+// ----------------------------------------------------------------------------
+
+struct AtlasLayout {
+
+    struct Place {
+        uint16_t x, y;
+    };
+
+    struct Region {
+        std::string name;
+        uint16_t    width, height, frames, loop;
+        uint16_t    first; // entry of its first frame in `frames`
+    };
+
+    uint16_t width, height;
+    std::vector<uint16_t> pixels; // width * height RGB565 values
+    std::vector<Place>    places; // one per stored frame
+    std::vector<uint16_t> frames; // stored frame of each frame of each region
+    std::vector<Region>   regions;
+
+    AtlasLayout() : width(0), height(0) {}
+
+};
+
+// Identical frames, even of different assets, are stored once. The stored
+// frames are laid out on shelves, tallest first, trying every atlas width
+// from the widest frame up to all frames side by side, and keeping the one
+// that wastes the least area.
+inline void packAtlas(const std::vector<const AssetSpec*> &assets, const std::vector<Frames> &sheets, uint16_t transparent, AtlasLayout &atlas) {
+
+    struct Stored {
+        const Frames *sheet;
+        uint16_t      frame;
+    };
+
+    std::vector<Stored> stored;
+    atlas = AtlasLayout();
+
+    for (size_t a=0; a<sheets.size(); ++a) {
+
+        const Frames &sheet = sheets[a];
+        AtlasLayout::Region region = { assets[a]->name, sheet.width, sheet.height, sheet.count, assets[a]->loop, (uint16_t)atlas.frames.size() };
+        atlas.regions.push_back(region);
+
+        for (uint16_t f=0; f<sheet.count; ++f) {
+
+            uint16_t s = 0;
+            while (s < stored.size() && !(
+                stored[s].sheet->width  == sheet.width &&
+                stored[s].sheet->height == sheet.height &&
+                std::equal(sheet.frame(f), sheet.frame(f) + sheet.size(), stored[s].sheet->frame(stored[s].frame))
+            )) ++s;
+
+            if (s == stored.size()) stored.push_back({ &sheet, f });
+            atlas.frames.push_back(s);
+
+        }
+
+    }
+
+    std::vector<uint16_t> order(stored.size());
+    uint16_t widest = 0, total = 0;
+
+    for (uint16_t s=0; s<stored.size(); ++s) {
+        order[s] = s;
+        widest   = std::max(widest, stored[s].sheet->width);
+        total   += stored[s].sheet->width;
+    }
+
+    std::stable_sort(order.begin(), order.end(), [&](uint16_t a, uint16_t b) {
+        const Frames &fa = *stored[a].sheet, &fb = *stored[b].sheet;
+        return fa.height != fb.height ? fa.height > fb.height : fa.width > fb.width;
+    });
+
+    std::vector<AtlasLayout::Place> places(stored.size()), best;
+    uint32_t bestArea = ~0u;
+
+    for (uint16_t w=widest; w<=total; ++w) {
+
+        uint16_t x = 0, y = 0, shelf = 0;
+
+        for (uint16_t i=0; i<order.size(); ++i) {
+
+            const Frames &sheet = *stored[order[i]].sheet;
+            if (x + sheet.width > w) {
+                y     += shelf;
+                x      = 0;
+                shelf  = 0;
+            }
+
+            places[order[i]] = { x, y };
+            x    += sheet.width;
+            shelf = std::max(shelf, sheet.height);
+
+        }
+
+        uint32_t area = (uint32_t)w * (y + shelf);
+        if (area < bestArea) {
+            bestArea     = area;
+            best         = places;
+            atlas.width  = w;
+            atlas.height = y + shelf;
+        }
+
+    }
+
+    atlas.places = best;
+    atlas.pixels.assign(atlas.width * atlas.height, transparent);
+
+    for (uint16_t s=0; s<stored.size(); ++s) {
+
+        const Frames   &sheet = *stored[s].sheet;
+        const uint16_t *pixel = sheet.frame(stored[s].frame);
+
+        for (uint16_t y=0; y<sheet.height; ++y, pixel+=sheet.width) {
+            std::copy(pixel, pixel + sheet.width, &atlas.pixels[(atlas.places[s].y + y) * atlas.width + atlas.places[s].x]);
+        }
+
+    }
+
+}
+
+// ----------------------------------------------------------------------------
+// Palette handling for the indexed variants
+// ----------------------------------------------------------------------------
+
+inline bool loadPalette(const Manifest &manifest, std::vector<uint16_t> &palette, std::string &error) {
+
+    Bitmap bitmap;
+    if (!loadPNG(manifest.path(manifest.palette), bitmap, error)) return false;
+
+    palette.clear();
+    for (size_t i=0; i<bitmap.pixels.size() && palette.size()<16; ++i) {
+        palette.push_back(argbToRgb565(bitmap.pixels[i]));
+    }
+
+    if (palette.size() != 16) {
+        error = manifest.palette + " must hold 16 colors";
+        return false;
+    }
+
+    return true;
+
+}
+
+inline int paletteIndex(const std::vector<uint16_t> &palette, uint16_t color) {
+
+    for (size_t i=0; i<palette.size(); ++i) {
+        if (palette[i] == color) return i;
+    }
+
+    return -1;
+
+}
+
+// Entry of the palette closest to `color`, the squared distance being taken
+// on the channels expanded to 8 bits. The `skip` entry, the transparent one,
+// is never picked.
+inline int nearestIndex(const std::vector<uint16_t> &palette, uint16_t color, int skip) {
+
+    int      best     = -1;
+    uint32_t distance = 0;
+
+    for (size_t i=0; i<palette.size(); ++i) {
+
+        if ((int)i == skip) continue;
+
+        int dr = ((color >> 11) - (palette[i] >> 11)) * 255 / 31;
+        int dg = ((color >> 5 & 0x3f) - (palette[i] >> 5 & 0x3f)) * 255 / 63;
+        int db = ((color & 0x1f) - (palette[i] & 0x1f)) * 255 / 31;
+        uint32_t d = dr * dr + dg * dg + db * db;
+
+        if (best < 0 || d < distance) {
+            best     = i;
+            distance = d;
+        }
+
+    }
+
+    return best;
+
+}
+
+// Colors of the frames missing from the palette.
+inline uint32_t missingColors(const Frames &frames, const std::vector<uint16_t> &palette) {
+
+    std::vector<uint16_t> colors(frames.pixels);
+    std::sort(colors.begin(), colors.end());
+    colors.erase(std::unique(colors.begin(), colors.end()), colors.end());
+
+    uint32_t missing = 0;
+    for (size_t i=0; i<colors.size(); ++i) missing += paletteIndex(palette, colors[i]) < 0;
+
+    return missing;
+
+}
+
+// ----------------------------------------------------------------------------
+// FNV-1a hashing of the sources, used to skip assets that did not change
+// ----------------------------------------------------------------------------
+
+inline uint32_t fnv1a(const void *data, size_t size, uint32_t hash = 0x811c9dc5) {
+
+    const uint8_t *p = (const uint8_t*)data;
+    while (size--) {
+        hash ^= *p++;
+        hash *= 0x01000193;
+    }
+
+    return hash;
+
+}
+
+inline uint32_t fnv1a(const std::string &text, uint32_t hash = 0x811c9dc5) {
+    return fnv1a(text.data(), text.size(), hash);
+}
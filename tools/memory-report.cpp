@@ -0,0 +1,159 @@
+/**
+ * ----------------------------------------------------------------------------
+ * Handling images on the Gamebuino META
+ * © 2021 Stéphane Calderoni
+ * ----------------------------------------------------------------------------
+ * Report: flash and RAM budget of the assets in each display mode
+ * ----------------------------------------------------------------------------
+ * Usage: memory-report
+ *
+ * Lists every array of the generated headers with its flash footprint,
+ * through the X-macros that end them and a gfx::MemoryLedger per header, so
+ * the report reads exactly as a sketch would print its own ledger. Follows
+ * the RAM of each display mode, one ledger each, as a sketch built for that
+ * mode would hold it: the framebuffer allocated by gb.begin() and the BMP
+ * of example-17 loaded from the SD card. Then the budget of each mode: the
+ * flash of the variant assets/display.h selects for it, the RAM of its
+ * framebuffer and of the BMP, and what both leave of the 32 KB of RAM.
+ *
+ * The ledgers are checked along the way: the RAM total of each mode must
+ * match the bytes the host library has allocated for its Images, the peak
+ * must outlive a released Image, and the entries beyond the capacity of a
+ * ledger must be dropped.
+ * ----------------------------------------------------------------------------
+ */
+
+#include <Gamebuino-Meta.h>
+#include "../gfx/memory.h"
+#include "../gfx/atlas.h"
+#include "../gfx/validate.h"
+
+namespace rgb565 {
+    #include "../assets/rgb565.h"
+}
+
+namespace halfres {
+    #include "../assets/indexed.h"
+}
+
+namespace fullres {
+    #include "../assets/fullres.h"
+}
+
+namespace rle {
+    #include "../assets/rle.h"
+}
+
+namespace atlas {
+    #include "../assets/atlas.h"
+}
+
+typedef gfx::MemoryLedger<16> Ledger;
+
+void print(const char *title, const Ledger &ledger) {
+
+    char text[24];
+
+    printf("%s\n", title);
+    for (uint8_t i=0; ledger.line(i, text, sizeof(text)); ++i) printf("  %s\n", text);
+
+}
+
+// The Images of the ledger must be the only ones alive.
+bool checkHeap(const char *mode, const Ledger &images) {
+
+    if (images.total(gfx::MEMORY_RAM) != host::heap()) {
+        fprintf(stderr, "error: %s: the ledger counts %u bytes of RAM, the Images hold %u\n", mode, (unsigned)images.total(gfx::MEMORY_RAM), (unsigned)host::heap());
+        return false;
+    }
+
+    return true;
+
+}
+
+bool check() {
+
+    Ledger scoped;
+    uint32_t held;
+
+    {
+        Image buffer(32, 32);
+        scoped.image("buffer", buffer);
+        held = scoped.total(gfx::MEMORY_RAM);
+        scoped.release(&buffer);
+    }
+
+    if (held != 32 * 32 * 2 || scoped.total(gfx::MEMORY_RAM) != 0 || scoped.peak() != held || scoped.count() != 0) {
+        fprintf(stderr, "error: releasing an Image (%u bytes held, %u after, peak %u)\n", (unsigned)held, (unsigned)scoped.total(gfx::MEMORY_RAM), (unsigned)scoped.peak());
+        return false;
+    }
+
+    gfx::MemoryLedger<2> small;
+    small.flash("SPRITE_DATA", rgb565::SPRITE_DATA);
+    small.flash("TILESET_DATA", rgb565::TILESET_DATA);
+
+    if (small.flash("TORCH_DATA", rgb565::TORCH_DATA) || small.dropped() != 1 || small.count() != 2) {
+        fprintf(stderr, "error: a full ledger must drop the entry and count it\n");
+        return false;
+    }
+
+    return true;
+
+}
+
+int main() {
+
+    Ledger headers[5];
+
+    #define IN_RGB565(NAME)  headers[0].flash(#NAME, rgb565::NAME);
+    #define IN_HALFRES(NAME) headers[1].flash(#NAME, halfres::NAME);
+    #define IN_FULLRES(NAME) headers[2].flash(#NAME, fullres::NAME);
+    #define IN_RLE(NAME)     headers[3].flash(#NAME, rle::NAME);
+    #define IN_ATLAS(NAME)   headers[4].flash(#NAME, atlas::NAME);
+
+    RGB565_ASSETS(IN_RGB565)
+    INDEXED_ASSETS(IN_HALFRES)
+    FULLRES_ASSETS(IN_FULLRES)
+    RLE_ASSETS(IN_RLE)
+    ATLAS_ASSETS(IN_ATLAS)
+
+    const char *FILES[] = { "rgb565.h", "indexed.h", "fullres.h", "rle.h", "atlas.h" };
+
+    for (uint8_t h=0; h<5; ++h) print(FILES[h], headers[h]);
+
+    // framebuffers of the display modes, as allocated by gb.begin()
+    struct { const char *mode; const Ledger &assets; uint16_t width, height; ColorMode colorMode; uint32_t screen, bmp; } MODES[] = {
+        { "RGB565",        headers[0], 80,  64,  ColorMode::rgb565, 0, 0 },
+        { "INDEX",         headers[2], 160, 128, ColorMode::index,  0, 0 },
+        { "INDEX_HALFRES", headers[1], 80,  64,  ColorMode::index,  0, 0 }
+    };
+
+    bool ok = check();
+
+    // a sketch runs in one mode only, so each mode holds its own RAM
+    for (auto &m : MODES) {
+
+        Image screen(m.width, m.height, m.colorMode);
+        Image bmp("gamebuino.bmp");
+
+        Ledger images;
+        images.image("display", screen);
+        images.image("gamebuino.bmp", bmp);
+
+        print(m.mode, images);
+        ok = checkHeap(m.mode, images) && ok;
+
+        m.screen = screen.bufferSize();
+        m.bmp    = bmp.bufferSize();
+
+    }
+
+    printf("%-14s %7s %7s %7s %7s\n", "budget", "flash", "screen", "bmp", "free");
+    for (auto &m : MODES) {
+        uint32_t flash = m.assets.total(gfx::MEMORY_FLASH), ram = m.screen + m.bmp;
+        printf("%-14s %7u %7u %7u %7d\n", m.mode, (unsigned)flash, (unsigned)m.screen, (unsigned)m.bmp, (int)(host::RAM_SIZE - ram));
+    }
+
+    return ok ? 0 : 1;
+
+}
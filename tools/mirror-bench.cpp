@@ -0,0 +1,151 @@
+/**
+ * ----------------------------------------------------------------------------
+ * Handling images on the Gamebuino META
+ * © 2021 Stéphane Calderoni
+ * ----------------------------------------------------------------------------
+ * Benchmark: mirrored sprites against unmirrored ones
+ * ----------------------------------------------------------------------------
+ * Usage: mirror-bench [runs]
+ *
+ * Reports the time taken to draw the avatar unmirrored, mirrored along each
+ * axis and along both, through the generic drawImage scaling path (one
+ * coordinate computation per pixel), gfx::drawSprite and gfx::drawAsset,
+ * then unmirrored from the pre-mirrored SPRITE_MIRROR array. Each mirrored
+ * draw is also checked pixel by pixel against the reference, at clipped
+ * positions, and SPRITE_MIRROR against the FLIP_X draws of SPRITE_DATA.
+ * ----------------------------------------------------------------------------
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bench.h"
+#include "../assets/descriptors.h"
+
+const int16_t SCREEN_WIDTH  = 80;
+const int16_t SCREEN_HEIGHT = 64;
+
+const gfx::Sprite AVATAR(SPRITE_DATA);
+const gfx::Sprite MIRROR(SPRITE_MIRROR);
+
+// Reference: what drawImage does with a negative size, mapping every target
+// pixel back to the source with a multiplication and a division.
+void drawScaled(gfx::Surface target, int16_t x, int16_t y, const gfx::Sprite &sprite, uint16_t frame, int16_t dw, int16_t dh) {
+
+    const uint16_t *pixels = sprite.frame(frame);
+    bool     flipX = dw < 0, flipY = dh < 0;
+    uint16_t aw    = flipX ? -dw : dw;
+    uint16_t ah    = flipY ? -dh : dh;
+
+    for (uint16_t j=0; j<ah; ++j) {
+        for (uint16_t i=0; i<aw; ++i) {
+
+            int16_t tx = x + i, ty = y + j;
+            if (tx < 0 || ty < 0 || tx >= target.width || ty >= target.height) continue;
+
+            int16_t  u = (flipX ? aw - 1 - i : i) * sprite.width  / aw;
+            int16_t  v = (flipY ? ah - 1 - j : j) * sprite.height / ah;
+            uint16_t c = pixels[v * sprite.width + u];
+            if (c != sprite.transparent) target.row(ty)[tx] = c;
+
+        }
+    }
+
+}
+
+void drawReference(gfx::Surface target, int16_t x, int16_t y, uint16_t frame, uint8_t flip) {
+    drawScaled(target, x, y, AVATAR, frame, flip & gfx::FLIP_X ? -AVATAR.width : AVATAR.width, flip & gfx::FLIP_Y ? -AVATAR.height : AVATAR.height);
+}
+
+const char *FLIPS[] = { "none", "FLIP_X", "FLIP_Y", "FLIP_XY" };
+
+bool check() {
+
+    static uint16_t expected[SCREEN_WIDTH * SCREEN_HEIGHT];
+    static uint16_t sprite[SCREEN_WIDTH * SCREEN_HEIGHT];
+    static uint16_t asset[SCREEN_WIDTH * SCREEN_HEIGHT];
+
+    gfx::Surface reference(expected, SCREEN_WIDTH, SCREEN_HEIGHT);
+    gfx::Surface bySprite(sprite, SCREEN_WIDTH, SCREEN_HEIGHT);
+    gfx::Surface byAsset(asset, SCREEN_WIDTH, SCREEN_HEIGHT);
+
+    const int16_t X[] = { -7, -3, 0, 36, SCREEN_WIDTH - 5, SCREEN_WIDTH - 1 };
+    const int16_t Y[] = { -7, -2, 0, 28, SCREEN_HEIGHT - 3 };
+
+    for (uint16_t f=0; f<AVATAR.frames; ++f) {
+        for (uint8_t flip=0; flip<4; ++flip) {
+            for (size_t i=0; i<sizeof(X)/sizeof(*X); ++i) {
+                for (size_t j=0; j<sizeof(Y)/sizeof(*Y); ++j) {
+
+                    for (int k=0; k<SCREEN_WIDTH * SCREEN_HEIGHT; ++k) expected[k] = sprite[k] = asset[k] = k;
+
+                    drawReference(reference, X[i], Y[j], f, flip);
+                    gfx::drawSprite(bySprite, X[i], Y[j], AVATAR, f, flip);
+                    gfx::drawAsset<SPRITE_ASSET>(byAsset, X[i], Y[j], f, flip);
+
+                    if (memcmp(expected, sprite, sizeof(expected)) || memcmp(expected, asset, sizeof(expected))) {
+                        fprintf(stderr, "error: frame %u %s differs at (%d, %d)\n", f, FLIPS[flip], X[i], Y[j]);
+                        return false;
+                    }
+
+                    if (flip == gfx::FLIP_X) {
+                        gfx::drawSprite(bySprite, X[i], Y[j], MIRROR, f);
+                        if (memcmp(expected, sprite, sizeof(expected))) {
+                            fprintf(stderr, "error: SPRITE_MIRROR frame %u differs at (%d, %d)\n", f, X[i], Y[j]);
+                            return false;
+                        }
+                    }
+
+                }
+            }
+        }
+    }
+
+    return true;
+
+}
+
+int main(int argc, char **argv) {
+
+    const uint32_t runs = argc > 1 ? strtoul(argv[1], NULL, 0) : 200000;
+
+    static uint16_t buffer[SCREEN_WIDTH * SCREEN_HEIGHT];
+    gfx::Surface screen(buffer, SCREEN_WIDTH, SCREEN_HEIGHT);
+
+    bool ok = check();
+
+    const uint16_t frames = AVATAR.frames;
+
+    printf("%-8s %12s %12s %12s\n", "flip", "drawImage", "drawSprite", "drawAsset");
+
+    for (uint8_t flip=0; flip<4; ++flip) {
+
+        double scaled = measure(runs, [&] {
+            for (uint16_t f=0; f<frames; ++f) drawReference(screen, 36, 28, f, flip);
+            consume(buffer);
+        }) / frames;
+
+        double sprite = measure(runs, [&] {
+            for (uint16_t f=0; f<frames; ++f) gfx::drawSprite(screen, 36, 28, AVATAR, f, flip);
+            consume(buffer);
+        }) / frames;
+
+        double asset = measure(runs, [&] {
+            for (uint16_t f=0; f<frames; ++f) gfx::drawAsset<SPRITE_ASSET>(screen, 36, 28, f, flip);
+            consume(buffer);
+        }) / frames;
+
+        printf("%-8s %12.1f %12.1f %12.1f\n", FLIPS[flip], scaled, sprite, asset);
+
+    }
+
+    double mirror = measure(runs, [&] {
+        for (uint16_t f=0; f<frames; ++f) gfx::drawSprite(screen, 36, 28, MIRROR, f);
+        consume(buffer);
+    }) / frames;
+
+    printf("%-8s %12s %12.1f %12s   (SPRITE_MIRROR, %zu bytes of flash)\n", "baked", "", mirror, "", sizeof(SPRITE_MIRROR));
+
+    return ok ? 0 : 1;
+
+}
@@ -0,0 +1,183 @@
+/**
+ * ----------------------------------------------------------------------------
+ * Handling images on the Gamebuino META
+ * © 2021 Stéphane Calderoni
+ * ----------------------------------------------------------------------------
+ * Estimate: rendering cost of each display mode, from a single scene
+ * ----------------------------------------------------------------------------
+ * Usage: mode-estimate <build directory> [frames] [runs]
+ *
+ * Gives an idea of what changes between the display modes, on the host. It
+ * is an estimate from one scene, not a benchmark of the examples:
+ *
+ * - the framebuffer: its size, the time taken to clear it, and the time of
+ *   a model of its push, i.e. of turning it into the 160x128 RGB565 words
+ *   the screen takes, a line at a time (through the palette in the indexed
+ *   modes, each pixel doubled in the 80x64 ones), each line then copied
+ *   into memory. The model leaves the SPI transfer out: the push column is
+ *   not a measurement of gb.updateDisplay() on the console. The screen
+ *   receives 40 KB per frame in every mode.
+ *
+ * - a single scene, example-28, built for each mode (<build directory>/
+ *   <MODE>/example-28, see `make mode-estimate`), each build drawing against
+ *   the asset variant and the screen size of its mode, for the same number
+ *   of frames, 256 by default: time, pixels written and bytes of asset data
+ *   read per frame, with their ratio to the RGB565 mode.
+ *
+ * Examples 01 to 16 include a given asset header and draw on an 80x64
+ * canvas whatever the mode, so their builds per mode would only time the
+ * conversions of the host library between the color modes, not the modes
+ * themselves: they are left out, and a single scene is all this measures.
+ * ----------------------------------------------------------------------------
+ */
+
+#include <Gamebuino-Meta.h>
+#include <string>
+#include "bench.h"
+
+const char *MODES[] = { "RGB565", "INDEX", "INDEX_HALFRES" };
+const int   NB_MODES = sizeof(MODES) / sizeof(*MODES);
+
+const char *SCENE = "example-28";
+
+const uint16_t SCREEN_WIDTH  = 160;
+const uint16_t SCREEN_HEIGHT = 128;
+
+struct Totals {
+
+    double nanos, draws, pixels, bytes;
+
+    Totals() : nanos(0), draws(0), pixels(0), bytes(0) {}
+
+};
+
+bool run(const std::string &binary, unsigned frames, Totals &totals) {
+
+    std::string command = binary + " -t -n " + std::to_string(frames);
+
+    FILE *pipe = popen(command.c_str(), "r");
+    if (!pipe) return false;
+
+    unsigned           n;
+    unsigned long long worst;
+    int fields = fscanf(pipe, "%u %lf %llu %lf %lf %lf", &n, &totals.nanos, &worst, &totals.draws, &totals.pixels, &totals.bytes);
+
+    return pclose(pipe) == 0 && fields == 6;
+
+}
+
+uint16_t line[SCREEN_WIDTH];
+uint16_t screen[SCREEN_WIDTH * SCREEN_HEIGHT];
+
+// Stands for the transfer of a line to the screen.
+void send(uint16_t y) {
+    memcpy(screen + y * SCREEN_WIDTH, line, sizeof(line));
+}
+
+// Model of the push: turns the framebuffer into lines of the screen, as the
+// library does before sending them, the transfer itself left out.
+void push(const Image &display) {
+
+    const uint8_t scale = SCREEN_WIDTH / display.width();
+
+    for (uint16_t y=0; y<display.height(); ++y) {
+
+        if (display.colorMode == ColorMode::rgb565) {
+            const uint16_t *src = display._buffer + y * display.width();
+            for (uint16_t x=0; x<display.width(); ++x) {
+                for (uint8_t s=0; s<scale; ++s) line[x * scale + s] = src[x];
+            }
+        } else {
+            const uint8_t *src = (const uint8_t*)display._buffer + y * ((display.width() + 1) / 2);
+            for (uint16_t x=0; x<display.width(); ++x) {
+                uint8_t  index = x & 1 ? src[x / 2] & 0xf : src[x / 2] >> 4;
+                uint16_t color = (uint16_t)display.colorIndex[index];
+                for (uint8_t s=0; s<scale; ++s) line[x * scale + s] = color;
+            }
+        }
+
+        for (uint8_t s=0; s<scale; ++s) send(y * scale + s);
+
+    }
+
+}
+
+void framebuffers(uint32_t runs) {
+
+    // as allocated by gb.begin() in each mode
+    Image rgb565(80, 64);
+    Image index(160, 128, ColorMode::index);
+    Image halfres(80, 64, ColorMode::index);
+
+    Image *DISPLAYS[NB_MODES] = { &rgb565, &index, &halfres };
+
+    printf("\nframebuffer, %u runs, host timings, push modeled without the transfer\n\n%-14s %8s %8s %10s %14s %8s\n", (unsigned)runs, "mode", "size", "bytes", "clear ns", "push model ns", "sent");
+
+    for (int m=0; m<NB_MODES; ++m) {
+
+        Image &display = *DISPLAYS[m];
+
+        double clear = measure(runs, [&] { display.clear(); consume(display._buffer); });
+        double sent  = measure(runs, [&] { push(display); consume(screen); });
+
+        char size[16];
+        snprintf(size, sizeof(size), "%ux%u", display.width(), display.height());
+
+        printf("%-14s %8s %8u %10.0f %14.0f %8u\n", MODES[m], size, (unsigned)display.bufferSize(), clear, sent, (unsigned)sizeof(screen));
+
+    }
+
+}
+
+void table(const char *title, const Totals *results, double Totals::*measure) {
+
+    printf("%-26s", title);
+
+    double reference = results[0].*measure;
+    for (int m=0; m<NB_MODES; ++m) {
+        double value = results[m].*measure;
+        if (m) printf(" %13.0f %5.2fx", value, reference ? value / reference : 0.);
+        else   printf(" %13.0f", value);
+    }
+
+    printf("\n");
+
+}
+
+int main(int argc, char **argv) {
+
+    if (argc < 2 || argc > 4) {
+        fprintf(stderr, "usage: %s <build directory> [frames] [runs]\n", argv[0]);
+        return 2;
+    }
+
+    std::string build  = argv[1];
+    unsigned    frames = argc > 2 ? strtoul(argv[2], NULL, 0) : 256;
+    uint32_t    runs   = argc > 3 ? strtoul(argv[3], NULL, 0) : 2000;
+
+    framebuffers(runs);
+
+    Totals results[NB_MODES];
+
+    for (int m=0; m<NB_MODES; ++m) {
+
+        std::string binary = build + "/" + MODES[m] + "/" + SCENE;
+
+        if (!run(binary, frames, results[m])) {
+            fprintf(stderr, "error: cannot run %s\n", binary.c_str());
+            return 1;
+        }
+
+    }
+
+    printf("\n%s alone, %u frames, host timings\n\n%-26s", SCENE, frames, "per frame");
+    for (int m=0; m<NB_MODES; ++m) printf(" %13s%s", MODES[m], m ? "  ratio" : "");
+    printf("\n");
+
+    table("time (ns)",         results, &Totals::nanos);
+    table("pixels written",    results, &Totals::pixels);
+    table("asset bytes read",  results, &Totals::bytes);
+
+    return 0;
+
+}
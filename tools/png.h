@@ -0,0 +1,262 @@
+/**
+ * ----------------------------------------------------------------------------
+ * Handling images on the Gamebuino META
+ * © 2021 Stéphane Calderoni
+ * ----------------------------------------------------------------------------
+ * Host-side PNG reader used by the asset tools
+ * ----------------------------------------------------------------------------
+ * Only what the artwork needs: non-interlaced images, 8-bit RGB / RGBA, and
+ * palette-based images at 1, 2, 4 or 8 bits per pixel. Inflating is left to
+ * zlib, so the tools must be linked with -lz.
+ * ----------------------------------------------------------------------------
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include <zlib.h>
+
+// ----------------------------------------------------------------------------
+// Decoded image: one 0xAARRGGBB word per pixel, rows top-down
+// ----------------------------------------------------------------------------
+
+struct Bitmap {
+
+    uint32_t width, height;
+    std::vector<uint32_t> pixels;
+
+    Bitmap() : width(0), height(0) {}
+
+    uint32_t at(uint32_t x, uint32_t y) const {
+        return pixels[x + y * width];
+    }
+
+};
+
+// ----------------------------------------------------------------------------
+// Color conversion helpers
+// ----------------------------------------------------------------------------
+
+inline uint16_t argbToRgb565(uint32_t argb) {
+
+    uint8_t r = (argb >> 16) & 0xff;
+    uint8_t g = (argb >>  8) & 0xff;
+    uint8_t b =  argb        & 0xff;
+
+    return ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3);
+
+}
+
+inline bool readFile(const std::string &path, std::vector<uint8_t> &bytes) {
+
+    FILE *file = fopen(path.c_str(), "rb");
+    if (!file) return false;
+
+    bytes.clear();
+    uint8_t chunk[4096];
+    size_t n;
+    while ((n = fread(chunk, 1, sizeof(chunk), file)) > 0) {
+        bytes.insert(bytes.end(), chunk, chunk + n);
+    }
+
+    fclose(file);
+    return true;
+
+}
+
+// ----------------------------------------------------------------------------
+// PNG decoding
+// ----------------------------------------------------------------------------
+
+namespace png {
+
+    inline uint32_t be32(const uint8_t *p) {
+        return (uint32_t)p[0] << 24 | (uint32_t)p[1] << 16 | (uint32_t)p[2] << 8 | p[3];
+    }
+
+    inline uint8_t paeth(uint8_t a, uint8_t b, uint8_t c) {
+
+        int p  = a + b - c;
+        int pa = p > a ? p - a : a - p;
+        int pb = p > b ? p - b : b - p;
+        int pc = p > c ? p - c : c - p;
+
+        if (pa <= pb && pa <= pc) return a;
+        return pb <= pc ? b : c;
+
+    }
+
+    inline bool unfilter(std::vector<uint8_t> &raw, uint32_t stride, uint32_t height, uint8_t bpp) {
+
+        std::vector<uint8_t> previous(stride, 0);
+
+        for (uint32_t y=0; y<height; ++y) {
+
+            uint8_t *line   = &raw[y * (stride + 1)];
+            uint8_t  filter = line[0];
+            uint8_t *row    = line + 1;
+
+            for (uint32_t i=0; i<stride; ++i) {
+
+                uint8_t a = i >= bpp ? row[i - bpp] : 0;
+                uint8_t b = previous[i];
+                uint8_t c = i >= bpp ? previous[i - bpp] : 0;
+
+                switch (filter) {
+                    case 0:                               break;
+                    case 1: row[i] += a;                  break;
+                    case 2: row[i] += b;                  break;
+                    case 3: row[i] += (a + b) >> 1;       break;
+                    case 4: row[i] += paeth(a, b, c);     break;
+                    default: return false;
+                }
+
+            }
+
+            memcpy(&previous[0], row, stride);
+
+        }
+
+        return true;
+
+    }
+
+}
+
+inline bool loadPNG(const std::string &path, Bitmap &bitmap, std::string &error) {
+
+    static const uint8_t SIGNATURE[] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n' };
+
+    std::vector<uint8_t> file;
+    if (!readFile(path, file)) {
+        error = "cannot read " + path;
+        return false;
+    }
+
+    if (file.size() < 8 || memcmp(&file[0], SIGNATURE, 8)) {
+        error = path + " is not a PNG file";
+        return false;
+    }
+
+    uint32_t width = 0, height = 0;
+    uint8_t  depth = 0, type = 0, interlace = 0;
+    std::vector<uint32_t> palette;
+    std::vector<uint8_t>  idat;
+
+    size_t offset = 8;
+    while (offset + 12 <= file.size()) {
+
+        uint32_t       length = png::be32(&file[offset]);
+        const uint8_t *tag    = &file[offset + 4];
+        const uint8_t *data   = &file[offset + 8];
+
+        if (offset + 12 + length > file.size()) break;
+
+        if (!memcmp(tag, "IHDR", 4)) {
+
+            width     = png::be32(data);
+            height    = png::be32(data + 4);
+            depth     = data[8];
+            type      = data[9];
+            interlace = data[12];
+
+        } else if (!memcmp(tag, "PLTE", 4)) {
+
+            for (uint32_t i=0; i+2<length; i+=3) {
+                palette.push_back(0xff000000 | data[i] << 16 | data[i+1] << 8 | data[i+2]);
+            }
+
+        } else if (!memcmp(tag, "tRNS", 4) && type == 3) {
+
+            for (uint32_t i=0; i<length && i<palette.size(); ++i) {
+                palette[i] = (palette[i] & 0x00ffffff) | (uint32_t)data[i] << 24;
+            }
+
+        } else if (!memcmp(tag, "IDAT", 4)) {
+
+            idat.insert(idat.end(), data, data + length);
+
+        } else if (!memcmp(tag, "IEND", 4)) {
+
+            break;
+
+        }
+
+        offset += 12 + length;
+
+    }
+
+    if (interlace) {
+        error = path + ": interlaced PNG files are not supported";
+        return false;
+    }
+
+    uint8_t channels;
+    switch (type) {
+        case 2:  channels = 3; break;
+        case 3:  channels = 1; break;
+        case 6:  channels = 4; break;
+        default:
+            error = path + ": unsupported PNG color type";
+            return false;
+    }
+
+    if ((type != 3 && depth != 8) || (type == 3 && palette.empty())) {
+        error = path + ": unsupported PNG bit depth";
+        return false;
+    }
+
+    uint32_t bits   = depth * channels;
+    uint32_t stride = (width * bits + 7) / 8;
+    uint8_t  bpp    = bits < 8 ? 1 : bits / 8;
+
+    std::vector<uint8_t> raw((stride + 1) * height);
+    uLongf size = raw.size();
+    if (uncompress(&raw[0], &size, &idat[0], idat.size()) != Z_OK || size != raw.size()) {
+        error = path + ": corrupted image data";
+        return false;
+    }
+
+    if (!png::unfilter(raw, stride, height, bpp)) {
+        error = path + ": invalid scanline filter";
+        return false;
+    }
+
+    bitmap.width  = width;
+    bitmap.height = height;
+    bitmap.pixels.resize(width * height);
+
+    for (uint32_t y=0; y<height; ++y) {
+
+        const uint8_t *row = &raw[y * (stride + 1) + 1];
+
+        for (uint32_t x=0; x<width; ++x) {
+
+            uint32_t argb;
+
+            if (type == 3) {
+
+                uint32_t bit   = x * depth;
+                uint8_t  index = (row[bit >> 3] >> (8 - depth - (bit & 7))) & ((1 << depth) - 1);
+                argb = index < palette.size() ? palette[index] : 0;
+
+            } else {
+
+                const uint8_t *p = row + x * channels;
+                argb = (channels == 4 ? (uint32_t)p[3] << 24 : 0xff000000) | p[0] << 16 | p[1] << 8 | p[2];
+
+            }
+
+            bitmap.pixels[x + y * width] = argb;
+
+        }
+
+    }
+
+    return true;
+
+}
@@ -0,0 +1,244 @@
+/**
+ * ----------------------------------------------------------------------------
+ * Handling images on the Gamebuino META
+ * © 2021 Stéphane Calderoni
+ * ----------------------------------------------------------------------------
+ * Benchmark: cost and accuracy of the frame time profiler
+ * ----------------------------------------------------------------------------
+ * Usage: profiler-bench [runs]
+ *
+ * Plays 100 frames of 6 phases against a simulated clock, starting just
+ * before it wraps around, and checks every timing kept by a gfx::Profiler
+ * against the durations it was given: the ring of the last 32 frames, the
+ * rolling averages, the worst frame, a phase entered twice in a frame, the
+ * saturation of a phase, the CSV rows and the bars of the overlay.
+ *
+ * Reports the memory taken by the profiler and the cost of a timed phase
+ * and of the start of a frame, on the host.
+ * ----------------------------------------------------------------------------
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "bench.h"
+#include "../gfx/profiler.h"
+
+const uint8_t PHASES = 6;
+const uint8_t FRAMES = 32;
+const uint8_t TOTAL  = 100;
+
+const char *NAMES[PHASES] = { "input", "avatar", "game", "tiles", "torch", "draw" };
+
+typedef gfx::Profiler<PHASES, FRAMES> FrameProfiler;
+
+uint32_t now;
+
+uint32_t simulated() {
+    return now;
+}
+
+// durations given to the phases, the last one twice in a frame
+uint32_t duration(uint32_t frame, uint8_t phase) {
+    return (frame * 7 + phase * 13) % 50 + 1;
+}
+
+uint32_t busy[TOTAL], times[TOTAL][PHASES];
+
+bool play(FrameProfiler &profiler) {
+
+    now = 0xffffffff - 2000; // the clock wraps around during the run
+
+    for (uint32_t f=0; f<TOTAL; ++f) {
+
+        profiler.frame();
+        uint32_t start = now;
+
+        for (uint8_t p=0; p<PHASES; ++p) {
+            now += 3; // work between the phases
+            FrameProfiler::Scope scope(profiler, p);
+            now += duration(f, p);
+            times[f][p] = duration(f, p);
+        }
+
+        {
+            FrameProfiler::Scope again(profiler, PHASES - 1);
+            now += 5;
+            times[f][PHASES - 1] += 5;
+        }
+
+        busy[f] = now - start;
+        now    += 1000; // waiting for the next frame
+
+    }
+
+    profiler.frame();
+
+    if (profiler.recorded() != TOTAL || profiler.frames() != FRAMES) {
+        fprintf(stderr, "error: %u frames recorded, %u in the ring\n", (unsigned)profiler.recorded(), profiler.frames());
+        return false;
+    }
+
+    uint32_t sums[PHASES] = { 0 }, total = 0, worst = 0;
+
+    for (uint8_t i=0; i<FRAMES; ++i) {
+
+        uint32_t f = TOTAL - FRAMES + i;
+
+        for (uint8_t p=0; p<PHASES; ++p) {
+            if (profiler.time(i, p) != times[f][p]) {
+                fprintf(stderr, "error: frame %u, phase %u: %u us, %u expected\n", (unsigned)f, p, profiler.time(i, p), (unsigned)times[f][p]);
+                return false;
+            }
+            sums[p] += times[f][p];
+        }
+
+        if (profiler.frameTime(i) != busy[f]) {
+            fprintf(stderr, "error: frame %u: %u us, %u expected\n", (unsigned)f, (unsigned)profiler.frameTime(i), (unsigned)busy[f]);
+            return false;
+        }
+
+        total += busy[f];
+        worst  = busy[f] > worst ? busy[f] : worst;
+
+    }
+
+    for (uint8_t p=0; p<PHASES; ++p) {
+        if (profiler.average(p) != sums[p] / FRAMES) {
+            fprintf(stderr, "error: phase %u: average of %u us, %u expected\n", p, (unsigned)profiler.average(p), (unsigned)(sums[p] / FRAMES));
+            return false;
+        }
+    }
+
+    if (profiler.averageFrame() != total / FRAMES || profiler.worst() != worst) {
+        fprintf(stderr, "error: frame average %u (%u), worst %u (%u)\n", (unsigned)profiler.averageFrame(), (unsigned)(total / FRAMES), (unsigned)profiler.worst(), (unsigned)worst);
+        return false;
+    }
+
+    return true;
+
+}
+
+bool checkCsv(const FrameProfiler &profiler) {
+
+    char text[64], expected[64];
+
+    if (!profiler.csv(0, text, sizeof(text)) || strcmp(text, "frame,input,avatar,game,tiles,torch,draw,total")) {
+        fprintf(stderr, "error: CSV header \"%s\"\n", text);
+        return false;
+    }
+
+    uint8_t i = 1;
+    for (; profiler.csv(i, text, sizeof(text)); ++i) {
+
+        uint32_t f = TOTAL - FRAMES + i - 1;
+        int n = snprintf(expected, sizeof(expected), "%u", (unsigned)f + 1);
+        for (uint8_t p=0; p<PHASES; ++p) n += snprintf(expected + n, sizeof(expected) - n, ",%u", (unsigned)times[f][p]);
+        snprintf(expected + n, sizeof(expected) - n, ",%u", (unsigned)busy[f]);
+
+        if (strcmp(text, expected)) {
+            fprintf(stderr, "error: CSV row \"%s\", \"%s\" expected\n", text, expected);
+            return false;
+        }
+
+    }
+
+    // a short buffer truncates the line
+    char small[8];
+    if (i != FRAMES + 1 || !profiler.csv(1, small, sizeof(small)) || strlen(small) != sizeof(small) - 1) {
+        fprintf(stderr, "error: %u CSV rows, or truncated row \"%s\"\n", i - 1, small);
+        return false;
+    }
+
+    return true;
+
+}
+
+bool checkSaturation() {
+
+    const char *ONE[] = { "one" };
+    gfx::Profiler<1, 4> profiler(ONE, simulated);
+
+    now = 0;
+    profiler.frame();
+    profiler.begin(0);
+    now += 100000;
+    profiler.end(0);
+    profiler.frame();
+
+    if (profiler.time(0, 0) != 0xffff || profiler.frameTime(0) != 100000) {
+        fprintf(stderr, "error: a phase of 100 ms is kept as %u us, the frame as %u\n", profiler.time(0, 0), (unsigned)profiler.frameTime(0));
+        return false;
+    }
+
+    return true;
+
+}
+
+// Display stand-in for the overlay: a framebuffer, without text.
+struct Screen {
+
+    uint16_t _buffer[80 * 64];
+    uint16_t width()  const { return 80; }
+    uint16_t height() const { return 64; }
+
+    void printf(int16_t, int16_t, const char *, ...) {}
+
+};
+
+bool checkOverlay(const FrameProfiler &profiler) {
+
+    Screen screen;
+    memset(screen._buffer, 0x55, sizeof(screen._buffer));
+
+    const uint32_t budget = 500;
+    gfx::drawProfile<gfx::Surface>(screen, profiler, budget, 8);
+
+    const int16_t bar = 80 - gfx::PROFILE_TEXT - 1;
+
+    for (uint8_t line=0; line<PHASES + 2; ++line) {
+
+        const uint16_t *row = screen._buffer + (8 + line * gfx::PROFILE_LINE) * 80;
+
+        int16_t w = 0;
+        while (gfx::PROFILE_TEXT + w < 80 && row[gfx::PROFILE_TEXT + w]) ++w;
+
+        uint32_t time  = line < PHASES ? profiler.average(line) : line == PHASES ? profiler.averageFrame() : profiler.worst();
+        uint32_t scale = line < PHASES ? profiler.averageFrame() : budget;
+        int16_t  width = time < scale ? time * bar / scale : bar;
+
+        if (w != width) {
+            fprintf(stderr, "error: overlay line %u: bar of %d pixels, %d expected\n", line, w, width);
+            return false;
+        }
+
+    }
+
+    // the picture above and below the overlay is left alone
+    if (screen._buffer[7 * 80] != 0x5555 || screen._buffer[(8 + (PHASES + 2) * gfx::PROFILE_LINE) * 80] != 0x5555) {
+        fprintf(stderr, "error: the overlay draws out of its lines\n");
+        return false;
+    }
+
+    return true;
+
+}
+
+int main(int argc, char **argv) {
+
+    const uint32_t runs = argc > 1 ? strtoul(argv[1], NULL, 0) : 1000000;
+
+    static FrameProfiler profiler(NAMES, simulated);
+
+    bool ok = play(profiler) && checkCsv(profiler) && checkSaturation() && checkOverlay(profiler);
+
+    printf("profiler of %u phases over %u frames: %u bytes\n", PHASES, FRAMES, (unsigned)sizeof(FrameProfiler));
+
+    now = 0;
+    double phase = measure(runs, [&] { ++now; FrameProfiler::Scope scope(profiler, 2); ++now; });
+    double frame = measure(runs, [&] { ++now; profiler.frame(); });
+
+    printf("timed phase: %.1f ns\nframe(): %.1f ns\n", phase, frame);
+
+    return ok ? 0 : 1;
+
+}
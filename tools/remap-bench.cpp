@@ -0,0 +1,197 @@
+/**
+ * ----------------------------------------------------------------------------
+ * Handling images on the Gamebuino META
+ * © 2021 Stéphane Calderoni
+ * ----------------------------------------------------------------------------
+ * Benchmark: per-draw remap tables against palette rewrites
+ * ----------------------------------------------------------------------------
+ * Usage: remap-bench [runs]
+ *
+ * Draws the indexed avatar in six tints, like example-07:
+ *
+ *   - onto an RGB565 target, first by passing a rewritten palette to
+ *     setPalette before each drawImage, then with gfx::drawRemapped and one
+ *     color table per tint;
+ *   - onto an indexed target, first by drawing copies of the image baked with
+ *     the remapped indices (the only way drawImage has, since the palette of
+ *     an indexed display applies to the whole screen), then with
+ *     gfx::drawRemapped and one index table per tint.
+ *
+ * The outputs of both ways are compared pixel by pixel, at clipped positions.
+ * ----------------------------------------------------------------------------
+ */
+
+#include <Gamebuino-Meta.h>
+#include "bench.h"
+#include "../assets/indexed.h"
+#include "../gfx/remap.h"
+
+const int16_t SCREEN_WIDTH  = 80;
+const int16_t SCREEN_HEIGHT = 64;
+const uint8_t NB_TINTS      = 6;
+
+const int16_t  AVATAR_WIDTH  = SPRITE_DATA[0];
+const int16_t  AVATAR_HEIGHT = SPRITE_DATA[1];
+const uint16_t AVATAR_FRAMES = SPRITE_DATA[2] | SPRITE_DATA[3] << 8;
+const uint8_t  AVATAR_KEY    = SPRITE_DATA[5];
+const size_t   AVATAR_SIZE   = 7 + AVATAR_FRAMES * AVATAR_HEIGHT * ((AVATAR_WIDTH + 1) / 2);
+
+const Color TINTS[NB_TINTS] = { PINK, LIGHTBLUE, LIGHTGREEN, YELLOW, ORANGE, RED };
+
+// indices taking the place of 0xb, 0xc and 0xd in each tint (never the
+// transparent index 0xe, which would make the baked copies drop them)
+const uint8_t SHADES[NB_TINTS][3] = {
+    { 0x2, 0x3, 0x4 }, { 0x1, 0x2, 0xf }, { 0x4, 0x5, 0x6 },
+    { 0x8, 0x9, 0xa }, { 0x9, 0x8, 0x7 }, { 0x3, 0x2, 0x1 }
+};
+
+Color   colors[NB_TINTS][16];
+uint8_t remaps[NB_TINTS][16];
+uint8_t baked[NB_TINTS][AVATAR_SIZE];
+
+void makeTint(Color *table, Color color) {
+
+    uint16_t c = (uint16_t)color;
+
+    uint8_t r1 = .8f * (c >> 11);
+    uint8_t g1 = .8f * ((c >> 5) & 0x3f);
+    uint8_t b1 = .8f * (c & 0x1f);
+
+    uint8_t r2 = .8f * r1;
+    uint8_t g2 = .8f * g1;
+    uint8_t b2 = .8f * b1;
+
+    memcpy(table, PALETTE, 16*sizeof(Color));
+
+    table[0xb] = (Color)((r2 << 11) | (g2 << 5) | b2);
+    table[0xc] = (Color)((r1 << 11) | (g1 << 5) | b1);
+    table[0xd] = color;
+
+}
+
+// Copy of SPRITE_DATA whose opaque pixels are remapped.
+void bake(uint8_t *copy, const uint8_t *remap) {
+
+    memcpy(copy, SPRITE_DATA, AVATAR_SIZE);
+
+    for (size_t k=7; k<AVATAR_SIZE; ++k) {
+        uint8_t hi = copy[k] >> 4, lo = copy[k] & 0xf;
+        if (hi != AVATAR_KEY) hi = remap[hi];
+        if (lo != AVATAR_KEY) lo = remap[lo];
+        copy[k] = hi << 4 | lo;
+    }
+
+}
+
+void setup() {
+
+    for (uint8_t t=0; t<NB_TINTS; ++t) {
+        makeTint(colors[t], TINTS[t]);
+        gfx::identityRemap(remaps[t]);
+        for (uint8_t s=0; s<3; ++s) remaps[t][0xb + s] = SHADES[t][s];
+        bake(baked[t], remaps[t]);
+    }
+
+}
+
+int16_t tintX(uint8_t t) {
+    return (t + 1) * SCREEN_WIDTH / (NB_TINTS + 1) - AVATAR_WIDTH / 2;
+}
+
+const int16_t Y = (SCREEN_HEIGHT - AVATAR_HEIGHT) / 2;
+
+// Palette rewrites: what example-07 does.
+void drawPalettes(Image &target, Image &avatar) {
+    for (uint8_t t=0; t<NB_TINTS; ++t) {
+        target.setPalette(colors[t]);
+        target.drawImage(tintX(t), Y, avatar);
+    }
+}
+
+void drawBaked(Image &target, Image *copies) {
+    for (uint8_t t=0; t<NB_TINTS; ++t) target.drawImage(tintX(t), Y, copies[t]);
+}
+
+template <typename Target, typename Table>
+void drawTables(Target target, Table tables, uint16_t frame) {
+    for (uint8_t t=0; t<NB_TINTS; ++t) gfx::drawRemapped(target, tintX(t), Y, SPRITE_DATA, tables[t], frame);
+}
+
+bool check() {
+
+    Image reference(SCREEN_WIDTH, SCREEN_HEIGHT), actual(SCREEN_WIDTH, SCREEN_HEIGHT);
+    Image reference4(SCREEN_WIDTH, SCREEN_HEIGHT, ColorMode::index), actual4(SCREEN_WIDTH, SCREEN_HEIGHT, ColorMode::index);
+
+    gfx::Surface        surface(actual);
+    gfx::IndexedSurface surface4(actual4);
+
+    const int16_t X[] = { (int16_t)(1 - AVATAR_WIDTH), -3, 0, 1, 30, 31, (int16_t)(SCREEN_WIDTH - 3), (int16_t)(SCREEN_WIDTH - 1) };
+    const int16_t Y[] = { (int16_t)(1 - AVATAR_HEIGHT), -2, 0, 20, (int16_t)(SCREEN_HEIGHT - 2) };
+
+    for (uint16_t f=0; f<AVATAR_FRAMES; ++f) {
+        for (uint8_t t=0; t<NB_TINTS; ++t) {
+
+            Image avatar(SPRITE_DATA), copy(baked[t]);
+            avatar.setFrame(f);
+            copy.setFrame(f);
+
+            for (size_t i=0; i<sizeof(X)/sizeof(*X); ++i) {
+                for (size_t j=0; j<sizeof(Y)/sizeof(*Y); ++j) {
+
+                    for (int16_t k=0; k<SCREEN_WIDTH * SCREEN_HEIGHT; ++k) {
+                        uint16_t c = k * 7;
+                        reference._buffer[k] = actual._buffer[k] = c;
+                        if (k < SCREEN_WIDTH * SCREEN_HEIGHT / 4) reference4._buffer[k] = actual4._buffer[k] = c;
+                    }
+
+                    reference.setPalette(colors[t]);
+                    reference.drawImage(X[i], Y[j], avatar);
+                    gfx::drawRemapped(surface, X[i], Y[j], SPRITE_DATA, colors[t], f);
+
+                    reference4.drawImage(X[i], Y[j], copy);
+                    gfx::drawRemapped(surface4, X[i], Y[j], SPRITE_DATA, remaps[t], f);
+
+                    if (memcmp(reference._buffer, actual._buffer, 2 * SCREEN_WIDTH * SCREEN_HEIGHT)) {
+                        fprintf(stderr, "error: rgb565 tint %u frame %u differs at (%d, %d)\n", t, f, X[i], Y[j]);
+                        return false;
+                    }
+
+                    if (memcmp(reference4._buffer, actual4._buffer, SCREEN_WIDTH * SCREEN_HEIGHT / 2)) {
+                        fprintf(stderr, "error: indexed tint %u frame %u differs at (%d, %d)\n", t, f, X[i], Y[j]);
+                        return false;
+                    }
+
+                }
+            }
+
+        }
+    }
+
+    return true;
+
+}
+
+int main(int argc, char **argv) {
+
+    const uint32_t runs = argc > 1 ? strtoul(argv[1], NULL, 0) : 100000;
+
+    setup();
+    bool ok = check();
+
+    Image screen(SCREEN_WIDTH, SCREEN_HEIGHT), screen4(SCREEN_WIDTH, SCREEN_HEIGHT, ColorMode::index);
+    Image avatar(SPRITE_DATA);
+    Image copies[NB_TINTS] = { {baked[0]}, {baked[1]}, {baked[2]}, {baked[3]}, {baked[4]}, {baked[5]} };
+
+    printf("%-8s %14s %14s %8s\n", "target", "drawImage ns", "remapped ns", "speedup");
+
+    double palettes = measure(runs, [&] { drawPalettes(screen, avatar); consume(screen._buffer); });
+    double tables   = measure(runs, [&] { drawTables(gfx::Surface(screen), colors, 0); consume(screen._buffer); });
+    printf("%-8s %14.1f %14.1f %7.2fx   (palette rewrites)\n", "rgb565", palettes, tables, palettes / tables);
+
+    double copied   = measure(runs, [&] { drawBaked(screen4, copies); consume(screen4._buffer); });
+    double indices  = measure(runs, [&] { drawTables(gfx::IndexedSurface(screen4), remaps, 0); consume(screen4._buffer); });
+    printf("%-8s %14.1f %14.1f %7.2fx   (baked copies, %zu bytes each)\n", "indexed", copied, indices, copied / indices, AVATAR_SIZE);
+
+    return ok ? 0 : 1;
+
+}
@@ -0,0 +1,152 @@
+/**
+ * ----------------------------------------------------------------------------
+ * Handling images on the Gamebuino META
+ * © 2021 Stéphane Calderoni
+ * ----------------------------------------------------------------------------
+ * Benchmark: run-length encoded assets against the raw RGB565 arrays
+ * ----------------------------------------------------------------------------
+ * Usage: rle-bench [runs]
+ *
+ * For each asset of assets/rle.h, reports the flash footprint of both arrays
+ * and the time taken to draw one frame, first with a per-pixel color key
+ * test on the raw array (what drawImage does), then with gfx::drawRLE.
+ * Every frame is also drawn both ways at clipped positions and the results
+ * are compared pixel by pixel; so is the frame after the last one, drawn as
+ * the first.
+ * ----------------------------------------------------------------------------
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include "bench.h"
+#include "../gfx/rle.h"
+#include "../assets/rgb565.h"
+#include "../assets/rle.h"
+
+const int16_t SCREEN_WIDTH  = 80;
+const int16_t SCREEN_HEIGHT = 64;
+
+// Reference: the raw array drawn with a color key test on every pixel.
+void drawRaw(gfx::Surface target, int16_t x, int16_t y, const uint16_t *data, uint16_t frame) {
+
+    const int16_t   w     = data[0];
+    const int16_t   h     = data[1];
+    const uint16_t  key   = data[4];
+    const uint16_t *pixel = data + 6 + frame * w * h;
+
+    for (int16_t j=0; j<h; ++j) {
+        for (int16_t i=0; i<w; ++i, ++pixel) {
+
+            int16_t tx = x + i, ty = y + j;
+            if (tx < 0 || ty < 0 || tx >= target.width || ty >= target.height) continue;
+            if (*pixel != key) target.row(ty)[tx] = *pixel;
+
+        }
+    }
+
+}
+
+struct Asset {
+
+    const char     *name;
+    const uint16_t *raw;
+    size_t          rawSize;
+    const uint8_t  *table; // frame indirection of a deduplicated raw array
+    const uint16_t *rle;
+    size_t          rleSize;
+
+};
+
+const Asset ASSETS[] = {
+    { "SPRITE",  SPRITE_DATA,  sizeof(SPRITE_DATA) + sizeof(SPRITE_FRAMES), SPRITE_FRAMES, SPRITE_RLE,  sizeof(SPRITE_RLE)  },
+    { "TILESET", TILESET_DATA, sizeof(TILESET_DATA),                        NULL,          TILESET_RLE, sizeof(TILESET_RLE) },
+    { "TORCH",   TORCH_DATA,   sizeof(TORCH_DATA),                          NULL,          TORCH_RLE,   sizeof(TORCH_RLE)   }
+};
+
+// Both arrays are addressed with the frame numbers of the artwork sheet.
+uint16_t rawFrame(const Asset &asset, uint16_t frame) {
+    return asset.table ? asset.table[frame] : frame;
+}
+
+uint16_t frameCount(const Asset &asset) {
+    return asset.rle[2];
+}
+
+bool check(const Asset &asset) {
+
+    static uint16_t expected[SCREEN_WIDTH * SCREEN_HEIGHT];
+    static uint16_t actual[SCREEN_WIDTH * SCREEN_HEIGHT];
+
+    const int16_t w = asset.raw[0], h = asset.raw[1];
+    const int16_t left = 1 - w, top = 1 - h;
+    const int16_t X[] = { left, -3, 0, 30, SCREEN_WIDTH - 3, SCREEN_WIDTH - 1 };
+    const int16_t Y[] = { top, -2, 0, 20, SCREEN_HEIGHT - 2 };
+
+    for (uint16_t f=0; f<=frameCount(asset); ++f) {
+        for (size_t i=0; i<sizeof(X)/sizeof(*X); ++i) {
+            for (size_t j=0; j<sizeof(Y)/sizeof(*Y); ++j) {
+
+                for (int k=0; k<SCREEN_WIDTH * SCREEN_HEIGHT; ++k) expected[k] = actual[k] = k;
+
+                drawRaw(gfx::Surface(expected, SCREEN_WIDTH, SCREEN_HEIGHT), X[i], Y[j], asset.raw, rawFrame(asset, f < frameCount(asset) ? f : 0));
+                gfx::drawRLE(gfx::Surface(actual, SCREEN_WIDTH, SCREEN_HEIGHT), X[i], Y[j], asset.rle, f);
+
+                if (memcmp(expected, actual, sizeof(actual))) {
+                    fprintf(stderr, "error: %s frame %u differs at (%d, %d)\n", asset.name, f, X[i], Y[j]);
+                    return false;
+                }
+
+            }
+        }
+    }
+
+    return true;
+
+}
+
+int main(int argc, char **argv) {
+
+    const uint32_t runs = argc > 1 ? strtoul(argv[1], NULL, 0) : 20000;
+
+    static uint16_t buffer[SCREEN_WIDTH * SCREEN_HEIGHT];
+    gfx::Surface screen(buffer, SCREEN_WIDTH, SCREEN_HEIGHT);
+
+    printf("%-8s %10s %10s %7s %12s %12s\n", "asset", "raw bytes", "rle bytes", "saved", "raw ns/frm", "rle ns/frm");
+
+    size_t rawTotal = 0, rleTotal = 0;
+    bool ok = true;
+
+    for (size_t a=0; a<sizeof(ASSETS)/sizeof(*ASSETS); ++a) {
+
+        const Asset   &asset  = ASSETS[a];
+        const uint16_t frames = frameCount(asset);
+
+        ok = check(asset) && ok;
+
+        double raw = measure(runs, [&] {
+            for (uint16_t f=0; f<frames; ++f) drawRaw(screen, 36, 28, asset.raw, rawFrame(asset, f));
+            consume(buffer);
+        }) / frames;
+
+        double rle = measure(runs, [&] {
+            for (uint16_t f=0; f<frames; ++f) gfx::drawRLE(screen, 36, 28, asset.rle, f);
+            consume(buffer);
+        }) / frames;
+
+        printf(
+            "%-8s %10zu %10zu %6.1f%% %12.1f %12.1f\n",
+            asset.name, asset.rawSize, asset.rleSize,
+            100. * (1. - double(asset.rleSize) / asset.rawSize),
+            raw, rle
+        );
+
+        rawTotal += asset.rawSize;
+        rleTotal += asset.rleSize;
+
+    }
+
+    printf("%-8s %10zu %10zu %6.1f%%\n", "total", rawTotal, rleTotal, 100. * (1. - double(rleTotal) / rawTotal));
+
+    return ok ? 0 : 1;
+
+}
@@ -0,0 +1,161 @@
+/**
+ * ----------------------------------------------------------------------------
+ * Handling images on the Gamebuino META
+ * © 2021 Stéphane Calderoni
+ * ----------------------------------------------------------------------------
+ * Benchmark: integer-factor scaling against the generic stretching path
+ * ----------------------------------------------------------------------------
+ * Usage: scale-bench [runs]
+ *
+ * Reports the time taken to draw the avatar zoomed 2x, 3x and 4x, as the
+ * examples 02 to 09 do, first through the generic path mapping every target
+ * pixel back to the source (what drawImage does), then through the integer
+ * kernel of gfx::drawScaled, for the RGB565 variant onto an RGB565 target
+ * and for the indexed one onto a 4-bits target. Every factor is also drawn
+ * both ways, mirrored or not and at clipped positions, and the results are
+ * compared pixel by pixel, non-integer ratios included.
+ * ----------------------------------------------------------------------------
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <Gamebuino-Meta.h>
+#include "bench.h"
+#include "../gfx/scale.h"
+#include "../gfx/validate.h"
+
+// both variants define the same names
+namespace rgb565 {
+#include "../assets/rgb565.h"
+}
+
+namespace indexed {
+#include "../assets/indexed.h"
+}
+
+const int16_t SCREEN_WIDTH  = 80;
+const int16_t SCREEN_HEIGHT = 64;
+const int16_t SCREEN_STRIDE = SCREEN_WIDTH / 2;
+
+const gfx::Sprite AVATAR(rgb565::SPRITE_DATA);
+
+const int16_t W[] = { 8, 16, 24, 32, -24, 12, 20, -13, 40 };
+const int16_t H[] = { 8, 16, 24, 32, -24, 12, 8 };
+const int16_t X[] = { -30, -5, 0, 7, 28, SCREEN_WIDTH - 9, SCREEN_WIDTH - 1 };
+const int16_t Y[] = { -30, -4, 0, 20, SCREEN_HEIGHT - 5 };
+
+bool check() {
+
+    static uint16_t expected[SCREEN_WIDTH * SCREEN_HEIGHT];
+    static uint16_t actual[SCREEN_WIDTH * SCREEN_HEIGHT];
+
+    gfx::Surface reference(expected, SCREEN_WIDTH, SCREEN_HEIGHT);
+    gfx::Surface target(actual, SCREEN_WIDTH, SCREEN_HEIGHT);
+
+    for (uint16_t f=0; f<AVATAR.frames; ++f)
+    for (size_t w=0; w<sizeof(W)/sizeof(*W); ++w)
+    for (size_t h=0; h<sizeof(H)/sizeof(*H); ++h)
+    for (size_t i=0; i<sizeof(X)/sizeof(*X); ++i)
+    for (size_t j=0; j<sizeof(Y)/sizeof(*Y); ++j) {
+
+        for (int k=0; k<SCREEN_WIDTH * SCREEN_HEIGHT; ++k) expected[k] = actual[k] = k;
+
+        gfx::drawStretched(reference, X[i], Y[j], AVATAR, W[w], H[h], f);
+        gfx::drawScaled(target, X[i], Y[j], AVATAR, W[w], H[h], f);
+
+        if (memcmp(expected, actual, sizeof(actual))) {
+            fprintf(stderr, "error: frame %u stretched to %dx%d differs at (%d, %d)\n", f, W[w], H[h], X[i], Y[j]);
+            return false;
+        }
+
+    }
+
+    return true;
+
+}
+
+// The same for the indexed variant, onto a 4-bits framebuffer.
+bool checkIndexed() {
+
+    static uint8_t expected[SCREEN_STRIDE * SCREEN_HEIGHT];
+    static uint8_t actual[SCREEN_STRIDE * SCREEN_HEIGHT];
+
+    gfx::IndexedSurface reference(expected, SCREEN_WIDTH, SCREEN_HEIGHT);
+    gfx::IndexedSurface target(actual, SCREEN_WIDTH, SCREEN_HEIGHT);
+
+    for (uint16_t f=0; f<AVATAR.frames; ++f)
+    for (size_t w=0; w<sizeof(W)/sizeof(*W); ++w)
+    for (size_t h=0; h<sizeof(H)/sizeof(*H); ++h)
+    for (size_t i=0; i<sizeof(X)/sizeof(*X); ++i)
+    for (size_t j=0; j<sizeof(Y)/sizeof(*Y); ++j) {
+
+        for (int k=0; k<SCREEN_STRIDE * SCREEN_HEIGHT; ++k) expected[k] = actual[k] = k;
+
+        gfx::drawStretched(reference, X[i], Y[j], indexed::SPRITE_DATA, W[w], H[h], f);
+        gfx::drawScaled(target, X[i], Y[j], indexed::SPRITE_DATA, W[w], H[h], f);
+
+        if (memcmp(expected, actual, sizeof(actual))) {
+            fprintf(stderr, "error: indexed frame %u stretched to %dx%d differs at (%d, %d)\n", f, W[w], H[h], X[i], Y[j]);
+            return false;
+        }
+
+    }
+
+    return true;
+
+}
+
+int main(int argc, char **argv) {
+
+    const uint32_t runs = argc > 1 ? strtoul(argv[1], NULL, 0) : 50000;
+
+    static uint16_t buffer[SCREEN_WIDTH * SCREEN_HEIGHT];
+    static uint8_t  buffer4[SCREEN_STRIDE * SCREEN_HEIGHT];
+    gfx::Surface        screen(buffer, SCREEN_WIDTH, SCREEN_HEIGHT);
+    gfx::IndexedSurface screen4(buffer4, SCREEN_WIDTH, SCREEN_HEIGHT);
+
+    bool ok = check() && checkIndexed();
+
+    printf("%-8s %-8s %-9s %12s %12s %8s\n", "variant", "factor", "size", "generic ns", "integer ns", "speedup");
+
+    const int16_t FACTORS[] = { 2, 3, 4, -3 };
+
+    for (size_t i=0; i<sizeof(FACTORS)/sizeof(*FACTORS); ++i) {
+
+        int16_t w = FACTORS[i] * AVATAR.width;
+        int16_t h = FACTORS[i] * AVATAR.height;
+        int16_t x = (SCREEN_WIDTH  - abs(w)) / 2;
+        int16_t y = (SCREEN_HEIGHT - abs(h)) / 2;
+
+        double generic = measure(runs, [&] {
+            for (uint16_t f=0; f<AVATAR.frames; ++f) gfx::drawStretched(screen, x, y, AVATAR, w, h, f);
+            consume(buffer);
+        }) / AVATAR.frames;
+
+        double integer = measure(runs, [&] {
+            for (uint16_t f=0; f<AVATAR.frames; ++f) gfx::drawScaled(screen, x, y, AVATAR, w, h, f);
+            consume(buffer);
+        }) / AVATAR.frames;
+
+        double generic4 = measure(runs, [&] {
+            for (uint16_t f=0; f<AVATAR.frames; ++f) gfx::drawStretched(screen4, x, y, indexed::SPRITE_DATA, w, h, f);
+            consume(buffer4);
+        }) / AVATAR.frames;
+
+        double integer4 = measure(runs, [&] {
+            for (uint16_t f=0; f<AVATAR.frames; ++f) gfx::drawScaled(screen4, x, y, indexed::SPRITE_DATA, w, h, f);
+            consume(buffer4);
+        }) / AVATAR.frames;
+
+        char factor[8], size[16];
+        snprintf(factor, sizeof(factor), "%dx", FACTORS[i]);
+        snprintf(size, sizeof(size), "%dx%d", w, h);
+        printf("%-8s %-8s %-9s %12.1f %12.1f %7.2fx\n", "rgb565",  factor, size, generic,  integer,  generic  / integer);
+        printf("%-8s %-8s %-9s %12.1f %12.1f %7.2fx\n", "indexed", factor, size, generic4, integer4, generic4 / integer4);
+
+    }
+
+    return ok ? 0 : 1;
+
+}
@@ -0,0 +1,177 @@
+/**
+ * ----------------------------------------------------------------------------
+ * Handling images on the Gamebuino META
+ * © 2021 Stéphane Calderoni
+ * ----------------------------------------------------------------------------
+ * Benchmark: opaque span tables against the per-pixel color key test
+ * ----------------------------------------------------------------------------
+ * Usage: spans-bench [runs]
+ *
+ * For each asset of assets/rgb565.h and assets/indexed.h that comes with a
+ * span table, reports the time taken to draw one sprite, first with a color
+ * key test on every pixel (what drawImage does), then with gfx::drawSpans.
+ * Every frame is also drawn both ways at clipped positions and the results
+ * are compared pixel by pixel, as well as a frame past the last one, which
+ * must draw the first.
+ * ----------------------------------------------------------------------------
+ */
+
+#include <Gamebuino-Meta.h>
+#include "bench.h"
+#include "../gfx/spans.h"
+#include "../gfx/validate.h"
+
+// both variants define the same names
+namespace rgb565 {
+#include "../assets/rgb565.h"
+}
+
+namespace indexed {
+#include "../assets/indexed.h"
+}
+
+const int16_t SCREEN_WIDTH  = 80;
+const int16_t SCREEN_HEIGHT = 64;
+const int16_t SCREEN_STRIDE = SCREEN_WIDTH / 2;
+
+// References: a clipping and color key test on every pixel.
+void drawKeyed(gfx::Surface target, int16_t x, int16_t y, const uint16_t *data, uint16_t frame) {
+
+    const int16_t   w     = data[0];
+    const int16_t   h     = data[1];
+    const uint16_t  key   = data[4];
+    const uint16_t *pixel = data + 6 + frame * w * h;
+
+    for (int16_t j=0; j<h; ++j) {
+        for (int16_t i=0; i<w; ++i, ++pixel) {
+
+            int16_t tx = x + i, ty = y + j;
+            if (tx < 0 || ty < 0 || tx >= target.width || ty >= target.height) continue;
+            if (*pixel != key) target.row(ty)[tx] = *pixel;
+
+        }
+    }
+
+}
+
+void drawKeyed(gfx::IndexedSurface target, int16_t x, int16_t y, const uint8_t *data, uint16_t frame) {
+
+    const int16_t  w      = data[0];
+    const int16_t  h      = data[1];
+    const uint8_t  key    = data[5];
+    const int16_t  stride = (w + 1) / 2;
+    const uint8_t *pixels = data + 7 + frame * h * stride;
+
+    for (int16_t j=0; j<h; ++j, pixels+=stride) {
+        for (int16_t i=0; i<w; ++i) {
+
+            int16_t tx = x + i, ty = y + j;
+            if (tx < 0 || ty < 0 || tx >= target.width || ty >= target.height) continue;
+
+            uint8_t index = gfx::getNibble(pixels, i);
+            if (index != key) gfx::setNibble(target.row(ty), tx, index);
+
+        }
+    }
+
+}
+
+template <typename Pixel, typename Target>
+struct Asset {
+
+    const char    *name;
+    const Pixel   *data;
+    const uint8_t *spans;
+    uint16_t       frames;
+
+};
+
+typedef Asset<uint16_t, gfx::Surface>        Rgb565Asset;
+typedef Asset<uint8_t,  gfx::IndexedSurface> IndexedAsset;
+
+const Rgb565Asset RGB565_ASSETS[] = {
+    { "SPRITE", rgb565::SPRITE_DATA, rgb565::SPRITE_SPANS, rgb565::SPRITE_DATA[2] },
+    { "TORCH",  rgb565::TORCH_DATA,  rgb565::TORCH_SPANS,  rgb565::TORCH_DATA[2]  }
+};
+
+const IndexedAsset INDEXED_ASSETS[] = {
+    { "SPRITE", indexed::SPRITE_DATA, indexed::SPRITE_SPANS, (uint16_t)(indexed::SPRITE_DATA[2] | indexed::SPRITE_DATA[3] << 8) }
+};
+
+template <typename Pixel, typename Target>
+bool check(const char *mode, const Asset<Pixel, Target> &asset, Pixel *expected, Pixel *actual, size_t size, Target reference, Target target) {
+
+    const int16_t w = asset.data[0], h = asset.data[1];
+    const int16_t X[] = { (int16_t)(1 - w), -3, 0, 1, 30, 31, (int16_t)(SCREEN_WIDTH - 3), (int16_t)(SCREEN_WIDTH - 1) };
+    const int16_t Y[] = { (int16_t)(1 - h), -2, 0, 20, (int16_t)(SCREEN_HEIGHT - 2) };
+
+    for (uint16_t f=0; f<=asset.frames; ++f) {
+        for (size_t i=0; i<sizeof(X)/sizeof(*X); ++i) {
+            for (size_t j=0; j<sizeof(Y)/sizeof(*Y); ++j) {
+
+                for (size_t k=0; k<size; ++k) expected[k] = actual[k] = k * 7;
+
+                drawKeyed(reference, X[i], Y[j], asset.data, f < asset.frames ? f : 0);
+                gfx::drawSpans(target, X[i], Y[j], asset.data, asset.spans, f);
+
+                if (memcmp(expected, actual, size * sizeof(Pixel))) {
+                    fprintf(stderr, "error: %s %s frame %u differs at (%d, %d)\n", mode, asset.name, f, X[i], Y[j]);
+                    return false;
+                }
+
+            }
+        }
+    }
+
+    return true;
+
+}
+
+template <typename Pixel, typename Target>
+bool run(const char *mode, const Asset<Pixel, Target> &asset, uint32_t runs, Pixel *buffer, size_t size, Pixel *copy, Target screen, Target other) {
+
+    bool ok = check(mode, asset, buffer, copy, size, screen, other);
+
+    double keyed = measure(runs, [&] {
+        for (uint16_t f=0; f<asset.frames; ++f) drawKeyed(screen, 36, 28, asset.data, f);
+        consume(buffer);
+    }) / asset.frames;
+
+    double spans = measure(runs, [&] {
+        for (uint16_t f=0; f<asset.frames; ++f) gfx::drawSpans(screen, 36, 28, asset.data, asset.spans, f);
+        consume(buffer);
+    }) / asset.frames;
+
+    printf("%-8s %-8s %12.1f %12.1f %7.2fx\n", mode, asset.name, keyed, spans, keyed / spans);
+    return ok;
+
+}
+
+int main(int argc, char **argv) {
+
+    const uint32_t runs = argc > 1 ? strtoul(argv[1], NULL, 0) : 200000;
+
+    static uint16_t screen16[SCREEN_WIDTH * SCREEN_HEIGHT], other16[SCREEN_WIDTH * SCREEN_HEIGHT];
+    static uint8_t  screen4[SCREEN_STRIDE * SCREEN_HEIGHT],  other4[SCREEN_STRIDE * SCREEN_HEIGHT];
+
+    printf("%-8s %-8s %12s %12s %8s\n", "mode", "asset", "keyed ns", "spans ns", "speedup");
+
+    bool ok = true;
+
+    for (size_t a=0; a<sizeof(RGB565_ASSETS)/sizeof(*RGB565_ASSETS); ++a) {
+        ok = run(
+            "rgb565", RGB565_ASSETS[a], runs, screen16, SCREEN_WIDTH * SCREEN_HEIGHT, other16,
+            gfx::Surface(screen16, SCREEN_WIDTH, SCREEN_HEIGHT), gfx::Surface(other16, SCREEN_WIDTH, SCREEN_HEIGHT)
+        ) && ok;
+    }
+
+    for (size_t a=0; a<sizeof(INDEXED_ASSETS)/sizeof(*INDEXED_ASSETS); ++a) {
+        ok = run(
+            "indexed", INDEXED_ASSETS[a], runs, screen4, SCREEN_STRIDE * SCREEN_HEIGHT, other4,
+            gfx::IndexedSurface(screen4, SCREEN_WIDTH, SCREEN_HEIGHT), gfx::IndexedSurface(other4, SCREEN_WIDTH, SCREEN_HEIGHT)
+        ) && ok;
+    }
+
+    return ok ? 0 : 1;
+
+}
@@ -0,0 +1,129 @@
+/**
+ * ----------------------------------------------------------------------------
+ * Handling images on the Gamebuino META
+ * © 2021 Stéphane Calderoni
+ * ----------------------------------------------------------------------------
+ * Benchmark: runtime-sized sprites against compile-time asset descriptors
+ * ----------------------------------------------------------------------------
+ * Usage: sprite-bench [runs]
+ *
+ * Draws a scene made of small sprites only: the 8x8 avatar, the 16x8 tiles
+ * and the 8x16 torch, scattered over the screen, mirrored along either axis,
+ * both or none, and a few of them clipped by its edges. The scene is drawn three ways: with a
+ * clipping and color key test on every pixel (what drawImage does), with
+ * gfx::drawSprite, whose size is read from the array at runtime, and with
+ * gfx::drawAsset over the descriptors of assets/descriptors.h. The three
+ * results are compared pixel by pixel.
+ * ----------------------------------------------------------------------------
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bench.h"
+#include "../assets/descriptors.h"
+
+const int16_t SCREEN_WIDTH  = 80;
+const int16_t SCREEN_HEIGHT = 64;
+
+const uint16_t SPRITES = 96;
+
+struct Placement {
+
+    uint8_t  asset; // 0: avatar, 1: tile, 2: torch
+    int16_t  x, y;
+    uint16_t frame;
+    uint8_t  flip;
+
+};
+
+const gfx::Sprite SPRITES_BY_ASSET[] = { gfx::Sprite(SPRITE_DATA), gfx::Sprite(TILESET_DATA), gfx::Sprite(TORCH_DATA) };
+
+// Reference: a clipping and color key test on every pixel.
+void drawPerPixel(gfx::Surface target, int16_t x, int16_t y, const gfx::Sprite &sprite, uint16_t frame, uint8_t flip) {
+
+    const uint16_t *pixels = sprite.frame(frame);
+
+    for (int16_t j=0; j<sprite.height; ++j) {
+        for (int16_t i=0; i<sprite.width; ++i) {
+
+            int16_t tx = x + i, ty = y + j;
+            if (tx < 0 || ty < 0 || tx >= target.width || ty >= target.height) continue;
+
+            int16_t u = flip & gfx::FLIP_X ? sprite.width  - 1 - i : i;
+            int16_t v = flip & gfx::FLIP_Y ? sprite.height - 1 - j : j;
+
+            uint16_t c = pixels[v * sprite.width + u];
+            if (c != sprite.transparent) target.row(ty)[tx] = c;
+
+        }
+    }
+
+}
+
+void drawRuntime(gfx::Surface target, const Placement &p) {
+    gfx::drawSprite(target, p.x, p.y, SPRITES_BY_ASSET[p.asset], p.frame, p.flip);
+}
+
+void drawTyped(gfx::Surface target, const Placement &p) {
+    switch (p.asset) {
+        case 0:  gfx::drawAsset<SPRITE_ASSET>(target, p.x, p.y, p.frame, p.flip);  break;
+        case 1:  gfx::drawAsset<TILESET_ASSET>(target, p.x, p.y, p.frame, p.flip); break;
+        default: gfx::drawAsset<TORCH_ASSET>(target, p.x, p.y, p.frame, p.flip);   break;
+    }
+}
+
+void drawReference(gfx::Surface target, const Placement &p) {
+    drawPerPixel(target, p.x, p.y, SPRITES_BY_ASSET[p.asset], p.frame, p.flip);
+}
+
+template <typename Draw>
+void drawScene(gfx::Surface target, const Placement *scene, Draw draw) {
+    for (uint16_t i=0; i<SPRITES; ++i) draw(target, scene[i]);
+}
+
+int main(int argc, char **argv) {
+
+    const uint32_t runs = argc > 1 ? strtoul(argv[1], NULL, 0) : 20000;
+
+    static Placement scene[SPRITES];
+    srand(1);
+
+    for (uint16_t i=0; i<SPRITES; ++i) {
+        const gfx::Sprite &sprite = SPRITES_BY_ASSET[i % 3];
+        scene[i].asset = i % 3;
+        scene[i].x     = rand() % (SCREEN_WIDTH  + sprite.width)  - sprite.width / 2;
+        scene[i].y     = rand() % (SCREEN_HEIGHT + sprite.height) - sprite.height / 2;
+        scene[i].frame = rand() % sprite.frames;
+        scene[i].flip  = i & 3;
+    }
+
+    static uint16_t expected[SCREEN_WIDTH * SCREEN_HEIGHT];
+    static uint16_t runtime[SCREEN_WIDTH * SCREEN_HEIGHT];
+    static uint16_t typed[SCREEN_WIDTH * SCREEN_HEIGHT];
+
+    gfx::Surface reference(expected, SCREEN_WIDTH, SCREEN_HEIGHT);
+    gfx::Surface before(runtime, SCREEN_WIDTH, SCREEN_HEIGHT);
+    gfx::Surface after(typed, SCREEN_WIDTH, SCREEN_HEIGHT);
+
+    drawScene(reference, scene, drawReference);
+    drawScene(before, scene, drawRuntime);
+    drawScene(after, scene, drawTyped);
+
+    bool ok = true;
+    if (memcmp(expected, runtime, sizeof(expected))) { fprintf(stderr, "error: gfx::drawSprite differs from the reference\n"); ok = false; }
+    if (memcmp(expected, typed, sizeof(expected)))   { fprintf(stderr, "error: gfx::drawAsset differs from the reference\n");  ok = false; }
+
+    double perPixel = measure(runs, [&] { drawScene(reference, scene, drawReference); consume(expected); });
+    double sized    = measure(runs, [&] { drawScene(before, scene, drawRuntime);      consume(runtime);  });
+    double unrolled = measure(runs, [&] { drawScene(after, scene, drawTyped);         consume(typed);    });
+
+    printf("%u sprites per scene\n", SPRITES);
+    printf("%-32s %10s %8s\n", "scene", "ns", "speedup");
+    printf("%-32s %10.1f %7.2fx\n", "per-pixel tests (drawImage)", perPixel, 1.);
+    printf("%-32s %10.1f %7.2fx\n", "gfx::drawSprite (runtime size)", sized, perPixel / sized);
+    printf("%-32s %10.1f %7.2fx\n", "gfx::drawAsset (typed)", unrolled, perPixel / unrolled);
+
+    return ok ? 0 : 1;
+
+}
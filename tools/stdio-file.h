@@ -0,0 +1,142 @@
+/**
+ * ----------------------------------------------------------------------------
+ * Handling images on the Gamebuino META
+ * © 2021 Stéphane Calderoni
+ * ----------------------------------------------------------------------------
+ * Host-side stand-in for the SdFat files of the console
+ * ----------------------------------------------------------------------------
+ * Only the calls made by the gfx/ streaming code are provided, so that it can
+ * be run unchanged on the host against files of the local file system. Bytes
+ * read and written are counted to measure the SD traffic a load would cause.
+ * ----------------------------------------------------------------------------
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+#include <fcntl.h>
+#include <string>
+#include <time.h>
+#include <sys/stat.h>
+
+struct StdioTraffic {
+
+    uint32_t read, written;
+
+    StdioTraffic() : read(0), written(0) {}
+
+};
+
+struct StdioFile {
+
+    FILE         *file;
+    StdioTraffic *traffic;
+
+    StdioFile() : file(NULL), traffic(NULL) {}
+    ~StdioFile() { close(); }
+
+    StdioFile(StdioFile &&other) : file(other.file), traffic(other.traffic) {
+        other.file = NULL;
+    }
+
+    StdioFile &operator=(StdioFile &&other) {
+        if (this != &other) {
+            close();
+            file       = other.file;
+            traffic    = other.traffic;
+            other.file = NULL;
+        }
+        return *this;
+    }
+
+    StdioFile(const StdioFile &) = delete;
+    StdioFile &operator=(const StdioFile &) = delete;
+
+    bool open(const char *path, const char *mode = "rb") {
+        close();
+        file = fopen(path, mode);
+        return file;
+    }
+
+    void close() {
+        if (file) fclose(file);
+        file = NULL;
+    }
+
+    operator bool() const {
+        return file;
+    }
+
+    // -1 on a file that failed to open, as SdFat does
+    int read(void *buffer, size_t size) {
+        if (!file) return -1;
+        size_t n = fread(buffer, 1, size, file);
+        if (traffic) traffic->read += n;
+        return n;
+    }
+
+    size_t write(const void *buffer, size_t size) {
+        size_t n = fwrite(buffer, 1, size, file);
+        if (traffic) traffic->written += n;
+        return n;
+    }
+
+    bool seekSet(uint32_t position) {
+        return file && !fseek(file, position, SEEK_SET);
+    }
+
+    uint32_t fileSize() {
+        struct stat info;
+        return fstat(fileno(file), &info) ? 0 : info.st_size;
+    }
+
+    // Modification time in the FAT date and time formats, which span 1980
+    // to 2107: earlier and later times are clamped to the first and last
+    // instants of that range.
+    bool getModifyDateTime(uint16_t *date, uint16_t *time) {
+
+        struct stat info;
+        struct tm   local;
+        if (fstat(fileno(file), &info) || !localtime_r(&info.st_mtime, &local)) return false;
+
+        if (local.tm_year < 80) {
+            local.tm_year = 80;
+            local.tm_mon  = 0;
+            local.tm_mday = 1;
+            local.tm_hour = local.tm_min = local.tm_sec = 0;
+        } else if (local.tm_year > 207) {
+            local.tm_year = 207;
+            local.tm_mon  = 11;
+            local.tm_mday = 31;
+            local.tm_hour = 23;
+            local.tm_min  = 59;
+            local.tm_sec  = 59;
+        }
+
+        *date = (local.tm_year - 80) << 9 | (local.tm_mon + 1) << 5 | local.tm_mday;
+        *time = local.tm_hour << 11 | local.tm_min << 5 | local.tm_sec / 2;
+        return true;
+
+    }
+
+};
+
+// Opens files with the O_* flags of SdFat, relative to a root directory.
+struct StdioFileSystem {
+
+    std::string  root;
+    StdioTraffic traffic;
+
+    StdioFileSystem(const std::string &root = ".") : root(root) {}
+
+    StdioFile open(const char *path, int flags = O_RDONLY) {
+
+        StdioFile file;
+        file.open((root + "/" + path).c_str(), flags & O_WRONLY ? ((flags & O_TRUNC) ? "wb" : "ab") : "rb");
+        file.traffic = &traffic;
+        return file;
+
+    }
+
+};
@@ -0,0 +1,199 @@
+/**
+ * ----------------------------------------------------------------------------
+ * Handling images on the Gamebuino META
+ * © 2021 Stéphane Calderoni
+ * ----------------------------------------------------------------------------
+ * Benchmark: full resolution RGB565 scenes composed a band of lines at a time
+ * ----------------------------------------------------------------------------
+ * Usage: strip-bench [runs]
+ *
+ * Draws random 160x128 scenes: a background color, a scrolled tilemap that
+ * leaves part of the screen uncovered, sprites mirrored along either axis,
+ * both or none, some of them clipped by the edges, and a few rectangles on
+ * top. Each scene is drawn once into a full framebuffer, as the reference,
+ * then recorded by gfx::StripRenderers of several band heights, dividing
+ * 128 lines or not, whose bands are copied to a panel as they are flushed.
+ * Every panel must match the reference pixel for pixel.
+ *
+ * Reports the RAM taken by the renderer against the 40 KB of a framebuffer,
+ * and the time of a frame both ways, on the host.
+ * ----------------------------------------------------------------------------
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bench.h"
+#include "../assets/rgb565.h"
+#include "../gfx/strip.h"
+
+const int16_t SCREEN_WIDTH  = 160;
+const int16_t SCREEN_HEIGHT = 128;
+
+const uint8_t MAP_COLUMNS = 12;
+const uint8_t MAP_ROWS    = 20;
+
+const uint8_t SPRITES = 40;
+const uint8_t RECTS   = 4;
+const uint8_t SCENES  = 50;
+
+const gfx::Sprite AVATAR(SPRITE_DATA);
+const gfx::Sprite TORCH(TORCH_DATA);
+const gfx::Sprite TILE(TILESET_DATA);
+
+const gfx::Sprite *SPRITE_KINDS[] = { &AVATAR, &TORCH, &TILE };
+
+struct Scene {
+
+    uint16_t background;
+    int16_t  scrollX, scrollY;
+
+    struct { const gfx::Sprite *sprite; int16_t x, y; uint16_t frame; uint8_t flip; } sprites[SPRITES];
+    struct { int16_t x, y, w, h; uint16_t color; } rects[RECTS];
+
+};
+
+uint8_t      map[MAP_COLUMNS * MAP_ROWS];
+gfx::TileMap tilemap(TILESET_DATA, map, MAP_COLUMNS, MAP_ROWS);
+
+int16_t random(int16_t low, int16_t high) {
+    return low + rand() % (high - low + 1);
+}
+
+Scene randomScene() {
+
+    Scene s;
+
+    s.background = rand();
+    s.scrollX    = random(-40, tilemap.width()  - SCREEN_WIDTH  + 40);
+    s.scrollY    = random(-40, tilemap.height() - SCREEN_HEIGHT + 40);
+
+    for (auto &d : s.sprites) {
+        d.sprite = SPRITE_KINDS[rand() % 3];
+        d.x      = random(-d.sprite->width,  SCREEN_WIDTH);
+        d.y      = random(-d.sprite->height, SCREEN_HEIGHT);
+        d.frame  = rand() % d.sprite->frames;
+        d.flip   = rand() % 4;
+    }
+
+    for (auto &r : s.rects) {
+        r.x     = random(-20, SCREEN_WIDTH);
+        r.y     = random(-20, SCREEN_HEIGHT);
+        r.w     = random(1, 60);
+        r.h     = random(1, 60);
+        r.color = rand();
+    }
+
+    return s;
+
+}
+
+void drawFull(gfx::Surface screen, const Scene &s) {
+
+    gfx::fillRect(screen, 0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, s.background);
+    tilemap.draw(screen, s.scrollX, s.scrollY);
+
+    for (auto &d : s.sprites) gfx::drawSprite(screen, d.x, d.y, *d.sprite, d.frame, d.flip);
+    for (auto &r : s.rects)   gfx::fillRect(screen, r.x, r.y, r.w, r.h, r.color);
+
+}
+
+template <typename Strips>
+void record(Strips &strips, const Scene &s) {
+
+    strips.fill(s.background);
+    strips.tilemap(tilemap, s.scrollX, s.scrollY);
+
+    for (auto &d : s.sprites) strips.sprite(d.x, d.y, *d.sprite, d.frame, d.flip);
+    for (auto &r : s.rects)   strips.fill(r.x, r.y, r.w, r.h, r.color);
+
+}
+
+uint16_t reference[SCREEN_WIDTH * SCREEN_HEIGHT];
+uint16_t panel[SCREEN_WIDTH * SCREEN_HEIGHT];
+uint32_t flushed;
+
+// Stands for the screen: copies the band to its lines of the panel.
+void toPanel(uint16_t *pixels, int16_t top, int16_t lines) {
+    memcpy(panel + top * SCREEN_WIDTH, pixels, SCREEN_WIDTH * lines * sizeof(uint16_t));
+    flushed += lines;
+}
+
+template <uint8_t BAND>
+bool check(const Scene &s, uint8_t scene) {
+
+    static gfx::StripRenderer<SPRITES + RECTS + 2, BAND> strips;
+
+    memset(panel, 0, sizeof(panel));
+    flushed = 0;
+
+    record(strips, s);
+    strips.render(toPanel);
+
+    if (flushed != SCREEN_HEIGHT || strips.pending() || strips.dropped()) {
+        fprintf(stderr, "error: bands of %u lines: %u lines flushed, %u draws left, %u dropped\n", BAND, (unsigned)flushed, strips.pending(), strips.dropped());
+        return false;
+    }
+
+    for (int16_t i=0; i<SCREEN_WIDTH * SCREEN_HEIGHT; ++i) {
+        if (panel[i] != reference[i]) {
+            fprintf(stderr, "error: scene %u, bands of %u lines: pixel (%d, %d) is %04x, %04x expected\n", scene, BAND, i % SCREEN_WIDTH, i / SCREEN_WIDTH, panel[i], reference[i]);
+            return false;
+        }
+    }
+
+    return true;
+
+}
+
+bool checkFull() {
+
+    gfx::StripRenderer<2> strips;
+
+    bool added = strips.fill(0) && strips.fill(1);
+
+    if (!added || strips.fill(2) || strips.pending() != 2 || strips.dropped() != 1) {
+        fprintf(stderr, "error: a full renderer must drop the draw and count it\n");
+        return false;
+    }
+
+    return true;
+
+}
+
+int main(int argc, char **argv) {
+
+    const uint32_t runs = argc > 1 ? strtoul(argv[1], NULL, 0) : 2000;
+
+    srand(25);
+    for (auto &t : map) t = rand() % TILE.frames;
+
+    gfx::Surface screen(reference, SCREEN_WIDTH, SCREEN_HEIGHT);
+
+    bool ok = checkFull();
+
+    for (uint8_t n=0; n<SCENES && ok; ++n) {
+
+        Scene s = randomScene();
+        drawFull(screen, s);
+
+        ok = check<1>(s, n) && check<3>(s, n) && check<5>(s, n) && check<7>(s, n) && check<8>(s, n) && check<16>(s, n) && check<128>(s, n);
+
+    }
+
+    typedef gfx::StripRenderer<> Strips;
+
+    printf("%u scenes, bands of 1, 3, 5, 7, 8, 16 and 128 lines: %s\n", SCENES, ok ? "pixel exact" : "MISMATCH");
+    printf("renderer of %u draws in bands of 8 lines: %u bytes, framebuffer: %u bytes\n", 64, (unsigned)sizeof(Strips), (unsigned)sizeof(reference));
+
+    static Strips strips;
+    Scene s = randomScene();
+
+    double full  = measure(runs, [&] { drawFull(screen, s); consume(reference); });
+    double bands = measure(runs, [&] { record(strips, s); strips.render(toPanel); consume(panel); });
+
+    printf("full framebuffer: %.0f ns per frame\nbands of 8 lines: %.0f ns per frame (x%.2f)\n", full, bands, bands / full);
+
+    return ok ? 0 : 1;
+
+}
@@ -0,0 +1,166 @@
+/**
+ * ----------------------------------------------------------------------------
+ * Handling images on the Gamebuino META
+ * © 2021 Stéphane Calderoni
+ * ----------------------------------------------------------------------------
+ * Benchmark: gfx::TileMap against one keyed blit per tile
+ * ----------------------------------------------------------------------------
+ * Usage: tilemap-bench [runs]
+ *
+ * Reports the time taken to redraw the tilemap of the examples over the whole
+ * screen, first with a per-pixel color key test for each tile (what the
+ * drawImage loop of the examples does), then with gfx::TileMap. The map is
+ * also drawn both ways at scroll offsets reaching past every edge, over the
+ * opaque tileset and over the sprite sheet whose frames hold transparent
+ * pixels (through a map of its own, as it has only 3 frames), and the
+ * results are compared pixel by pixel, as are the numbers of pixels written.
+ * ----------------------------------------------------------------------------
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include "bench.h"
+
+// pixels written by gfx::TileMap, and the check of its map on construction
+uint32_t counted;
+#define GFX_COUNT_PIXELS(n) (counted += (n))
+#define GFX_DEBUG 1
+
+#include "../gfx/tilemap.h"
+#include "../assets/rgb565.h"
+
+const int16_t SCREEN_WIDTH  = 80;
+const int16_t SCREEN_HEIGHT = 64;
+
+const uint8_t TILES_WIDE = 5;
+const uint8_t TILES_HIGH = 8;
+
+const uint8_t TILEMAP[] = {
+    0, 0, 0, 0, 0,
+    2, 2, 2, 2, 2,
+    0, 0, 0, 0, 0,
+    2, 2, 2, 2, 2,
+    0, 0, 0, 0, 0,
+    2, 2, 2, 2, 2,
+    1, 1, 1, 1, 1,
+    3, 3, 3, 3, 3
+};
+
+// the frames of SPRITE_DATA as tiles
+const uint8_t SPRITE_MAP[] = {
+    0, 1, 2, 1, 0,
+    2, 0, 1, 0, 2,
+    1, 2, 0, 2, 1,
+    0, 1, 2, 1, 0,
+    2, 0, 1, 0, 2,
+    1, 2, 0, 2, 1,
+    0, 0, 0, 0, 0,
+    2, 2, 2, 2, 2
+};
+
+uint32_t written;
+
+// Reference: the tile drawn with a clipping and color key test on every pixel.
+void drawTile(gfx::Surface target, int16_t x, int16_t y, const uint16_t *data, uint16_t frame) {
+
+    const int16_t   w     = data[0];
+    const int16_t   h     = data[1];
+    const uint16_t  key   = data[4];
+    const uint16_t *pixel = data + 6 + frame * w * h;
+
+    for (int16_t j=0; j<h; ++j) {
+        for (int16_t i=0; i<w; ++i, ++pixel) {
+
+            int16_t tx = x + i, ty = y + j;
+            if (tx < 0 || ty < 0 || tx >= target.width || ty >= target.height) continue;
+            if (*pixel != key) target.row(ty)[tx] = *pixel, ++written;
+
+        }
+    }
+
+}
+
+void drawTiles(gfx::Surface target, const uint16_t *tileset, const uint8_t *map, int16_t scrollX, int16_t scrollY) {
+
+    for (uint8_t j=0; j<TILES_HIGH; ++j) {
+        for (uint8_t i=0; i<TILES_WIDE; ++i) {
+            drawTile(target, i * tileset[0] - scrollX, j * tileset[1] - scrollY, tileset, map[i + j * TILES_WIDE]);
+        }
+    }
+
+}
+
+bool check(const char *name, const uint16_t *tileset, const uint8_t *map) {
+
+    static uint16_t expected[SCREEN_WIDTH * SCREEN_HEIGHT];
+    static uint16_t actual[SCREEN_WIDTH * SCREEN_HEIGHT];
+
+    gfx::TileMap tilemap(tileset, map, TILES_WIDE, TILES_HIGH);
+
+    const int16_t X[] = { -SCREEN_WIDTH, -17, -1, 0, 3, 16, (int16_t)(tilemap.width() - 1), tilemap.width() };
+    const int16_t Y[] = { -SCREEN_HEIGHT, -9, -1, 0, 5, 8, (int16_t)(tilemap.height() - 1), tilemap.height() };
+
+    for (size_t i=0; i<sizeof(X)/sizeof(*X); ++i) {
+        for (size_t j=0; j<sizeof(Y)/sizeof(*Y); ++j) {
+
+            for (int k=0; k<SCREEN_WIDTH * SCREEN_HEIGHT; ++k) expected[k] = actual[k] = k;
+            written = counted = 0;
+
+            drawTiles(gfx::Surface(expected, SCREEN_WIDTH, SCREEN_HEIGHT), tileset, map, X[i], Y[j]);
+            tilemap.draw(gfx::Surface(actual, SCREEN_WIDTH, SCREEN_HEIGHT), X[i], Y[j]);
+
+            if (memcmp(expected, actual, sizeof(actual))) {
+                fprintf(stderr, "error: %s map differs at scroll (%d, %d)\n", name, X[i], Y[j]);
+                return false;
+            }
+
+            if (counted != written) {
+                fprintf(stderr, "error: %s map at scroll (%d, %d): %u pixels counted, %u written\n", name, X[i], Y[j], (unsigned)counted, (unsigned)written);
+                return false;
+            }
+
+        }
+    }
+
+    return true;
+
+}
+
+int main(int argc, char **argv) {
+
+    const uint32_t runs = argc > 1 ? strtoul(argv[1], NULL, 0) : 20000;
+
+    static uint16_t buffer[SCREEN_WIDTH * SCREEN_HEIGHT];
+    gfx::Surface screen(buffer, SCREEN_WIDTH, SCREEN_HEIGHT);
+
+    bool ok = check("TILESET", TILESET_DATA, TILEMAP);
+    ok = check("SPRITE", SPRITE_DATA, SPRITE_MAP) && ok;
+
+    gfx::TileMap tilemap(TILESET_DATA, TILEMAP, TILES_WIDE, TILES_HIGH);
+
+    double tiles = measure(runs, [&] {
+        drawTiles(screen, TILESET_DATA, TILEMAP, 0, 0);
+        consume(buffer);
+    });
+
+    double rows = measure(runs, [&] {
+        tilemap.draw(screen);
+        consume(buffer);
+    });
+
+    // lower bound: one memcpy of a whole screen
+    static uint16_t source[SCREEN_WIDTH * SCREEN_HEIGHT];
+    double copy = measure(runs, [&] {
+        memcpy(buffer, source, sizeof(buffer));
+        consume(buffer);
+    });
+
+    printf("%-28s %10s\n", "full screen redraw", "ns");
+    printf("%-28s %10.1f\n", "keyed blit per tile", tiles);
+    printf("%-28s %10.1f\n", "gfx::TileMap", rows);
+    printf("%-28s %10.1f\n", "memcpy of a full screen", copy);
+    printf("gfx::TileMap: x%.1f a full screen memcpy, %u spans of %u pixels\n", rows / copy, (unsigned)(SCREEN_HEIGHT * TILES_WIDE), (unsigned)TILESET_DATA[0]);
+
+    return ok ? 0 : 1;
+
+}
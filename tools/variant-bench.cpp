@@ -0,0 +1,137 @@
+/**
+ * ----------------------------------------------------------------------------
+ * Handling images on the Gamebuino META
+ * © 2021 Stéphane Calderoni
+ * ----------------------------------------------------------------------------
+ * Benchmark: flash footprint of the display mode variants
+ * ----------------------------------------------------------------------------
+ * Usage: variant-bench
+ *
+ * Reports the bytes of every asset emitted for all display modes in each of
+ * its variants, that is, the flash taken by the assets in each mode once
+ * assets/display.h has selected one of them.
+ *
+ * The variants are checked against each other: same frame count and loop,
+ * every pixel of the full resolution variant being the pixel of the
+ * half-resolution one at half its coordinates, and every index of the
+ * latter giving the RGB565 color through the palette. Only the colors
+ * missing from the palette may differ, and only in the assets which have
+ * some: their count is reported.
+ * ----------------------------------------------------------------------------
+ */
+
+#include <Gamebuino-Meta.h>
+#include "bench.h"
+#include "../gfx/validate.h"
+
+namespace rgb565 {
+    #include "../assets/rgb565.h"
+}
+
+namespace halfres {
+    #include "../assets/indexed.h"
+}
+
+namespace fullres {
+    #include "../assets/fullres.h"
+}
+
+struct Variants {
+
+    const char     *name;
+    const uint16_t *rgb565;
+    const uint8_t  *halfres, *fullres;
+    size_t          bytes[3];
+    bool            exact; // every color is in the palette
+
+};
+
+#define VARIANTS(NAME, exact) { #NAME, rgb565::NAME, halfres::NAME, fullres::NAME, { sizeof(rgb565::NAME), sizeof(halfres::NAME), sizeof(fullres::NAME) }, exact }
+
+const Variants ASSETS[] = {
+    VARIANTS(SPRITE_DATA,   true),
+    VARIANTS(SPRITE_MIRROR, true),
+    VARIANTS(TILESET_DATA,  true),
+    VARIANTS(TORCH_DATA,    false)
+};
+
+uint8_t pixel(const uint8_t *data, uint16_t frame, uint16_t x, uint16_t y) {
+    uint16_t stride = (data[0] + 1) / 2;
+    const uint8_t *row = data + 7 + (frame * data[1] + y) * stride;
+    return x & 1 ? row[x / 2] & 0xf : row[x / 2] >> 4;
+}
+
+bool check(const Variants &v, uint32_t &approximated) {
+
+    const uint16_t w = v.rgb565[0], h = v.rgb565[1], frames = v.rgb565[2];
+
+    if (v.halfres[0] != w || v.halfres[1] != h || v.fullres[0] != 2 * w || v.fullres[1] != 2 * h) {
+        fprintf(stderr, "error: %s: frame sizes do not match\n", v.name);
+        return false;
+    }
+
+    if ((v.halfres[2] | v.halfres[3] << 8) != frames || (v.fullres[2] | v.fullres[3] << 8) != frames
+        || v.halfres[4] != v.rgb565[3] || v.fullres[4] != v.rgb565[3]) {
+        fprintf(stderr, "error: %s: frame count or frame loop differ\n", v.name);
+        return false;
+    }
+
+    const uint8_t key = v.halfres[5];
+    approximated = 0;
+
+    for (uint16_t f=0; f<frames; ++f) {
+        for (uint16_t y=0; y<2*h; ++y) {
+            for (uint16_t x=0; x<2*w; ++x) {
+
+                if (pixel(v.fullres, f, x, y) != pixel(v.halfres, f, x / 2, y / 2)) {
+                    fprintf(stderr, "error: %s: frame %u, pixel (%u, %u) of the full resolution variant\n", v.name, f, x, y);
+                    return false;
+                }
+
+                if (x & 1 || y & 1) continue;
+
+                uint16_t color = v.rgb565[6 + (f * h + y / 2) * w + x / 2];
+                uint8_t  index = pixel(v.halfres, f, x / 2, y / 2);
+
+                if (color == v.rgb565[4] ? index == key : index != key && (uint16_t)halfres::PALETTE[index] == color) continue;
+
+                if (v.exact || color == v.rgb565[4] || index == key) {
+                    fprintf(stderr, "error: %s: frame %u, pixel (%u, %u): index %u for color 0x%04x\n", v.name, f, x / 2, y / 2, index, color);
+                    return false;
+                }
+
+                ++approximated;
+
+            }
+        }
+    }
+
+    return true;
+
+}
+
+int main() {
+
+    bool   ok = true;
+    size_t totals[3] = { 0, 0, 0 };
+
+    printf("%-14s %8s %14s %8s\n", "", "RGB565", "INDEX_HALFRES", "INDEX");
+
+    for (const Variants &v : ASSETS) {
+
+        uint32_t approximated = 0;
+        ok = check(v, approximated) && ok;
+
+        printf("%-14s %8u %14u %8u", v.name, (unsigned)v.bytes[0], (unsigned)v.bytes[1], (unsigned)v.bytes[2]);
+        if (approximated) printf("   (%u pixels approximated)", approximated);
+        printf("\n");
+
+        for (int m=0; m<3; ++m) totals[m] += v.bytes[m];
+
+    }
+
+    printf("%-14s %8u %14u %8u\n", "total", (unsigned)totals[0], (unsigned)totals[1], (unsigned)totals[2]);
+
+    return ok ? 0 : 1;
+
+}
@@ -0,0 +1,175 @@
+/**
+ * ----------------------------------------------------------------------------
+ * Handling images on the Gamebuino META
+ * © 2021 Stéphane Calderoni
+ * ----------------------------------------------------------------------------
+ * Video encoder: BMP strip of stacked frames -> delta-encoded video
+ * ----------------------------------------------------------------------------
+ * Usage: video-encoder [-h <frame height>] <input.bmp> <output>
+ *
+ * The BMP is cut into frames of the given height (64 by default), which are
+ * written in the format played by gfx/video.h: a keyframe, then only the
+ * pixels that changed from one frame to the next. The output is decoded
+ * back with gfx::Video and compared to the source frames, then the amount of
+ * data read per frame is reported against the source BMP.
+ * ----------------------------------------------------------------------------
+ */
+
+#include <stdlib.h>
+#include "bmp.h"
+#include "stdio-file.h"
+#include "../gfx/video.h"
+
+typedef std::vector<uint16_t> Picture;
+
+// Gaps this short between two changed spans are cheaper to send as pixels
+// than as a new span header.
+const uint8_t MERGE_GAP = 1;
+
+void put16(std::vector<uint8_t> &out, uint16_t value) {
+    out.push_back(value & 0xff);
+    out.push_back(value >> 8);
+}
+
+void encodeFrame(const Picture &from, const Picture &to, uint16_t width, uint16_t height, std::vector<uint8_t> &out) {
+
+    for (uint16_t y=0; y<height; ++y) {
+
+        const uint16_t *a = &from[y * width];
+        const uint16_t *b = &to[y * width];
+
+        // [start, end) spans of changed pixels
+        std::vector<std::pair<uint16_t, uint16_t> > spans;
+
+        for (uint16_t x=0; x<width;) {
+
+            if (a[x] == b[x]) { ++x; continue; }
+
+            uint16_t start = x;
+            while (x < width && a[x] != b[x]) ++x;
+
+            if (!spans.empty() && start - spans.back().second <= MERGE_GAP && x - spans.back().first <= 0xff) {
+                spans.back().second = x;
+            } else {
+                // spans are limited to 255 pixels
+                for (uint16_t s=start; s<x; s+=0xff) spans.push_back(std::make_pair(s, std::min<uint16_t>(s + 0xff, x)));
+            }
+
+        }
+
+        out.push_back(spans.size());
+
+        uint16_t x = 0;
+        for (size_t i=0; i<spans.size(); ++i) {
+            out.push_back(spans[i].first - x);
+            out.push_back(spans[i].second - spans[i].first);
+            for (uint16_t p=spans[i].first; p<spans[i].second; ++p) put16(out, b[p]);
+            x = spans[i].second;
+        }
+
+    }
+
+}
+
+int main(int argc, char **argv) {
+
+    uint16_t frameHeight = 64;
+    int arg = 1;
+
+    if (arg + 1 < argc && !strcmp(argv[arg], "-h")) {
+        frameHeight = strtoul(argv[arg + 1], NULL, 0);
+        arg += 2;
+    }
+
+    if (argc - arg != 2 || !frameHeight) {
+        fprintf(stderr, "usage: %s [-h <frame height>] <input.bmp> <output>\n", argv[0]);
+        return 2;
+    }
+
+    const char *input  = argv[arg];
+    const char *output = argv[arg + 1];
+
+    Bitmap      bitmap;
+    std::string error;
+    if (!loadBMP(input, bitmap, error)) {
+        fprintf(stderr, "error: %s\n", error.c_str());
+        return 1;
+    }
+
+    if (bitmap.width > 0xff || bitmap.height % frameHeight) {
+        fprintf(stderr, "error: %s must be at most 255 pixels wide and a stack of %u pixels high frames\n", input, frameHeight);
+        return 1;
+    }
+
+    const uint16_t width  = bitmap.width;
+    const uint16_t height = frameHeight;
+    const uint16_t count  = bitmap.height / frameHeight;
+
+    std::vector<Picture> frames(count, Picture(width * height));
+    for (uint32_t i=0; i<bitmap.pixels.size(); ++i) {
+        frames[i / (width * height)][i % (width * height)] = argbToRgb565(bitmap.pixels[i]);
+    }
+
+    // the keyframe is encoded against a picture no pixel of which matches
+    Picture blank(width * height);
+    for (uint32_t i=0; i<blank.size(); ++i) blank[i] = ~frames[0][i];
+
+    std::vector<uint8_t> video;
+    video.insert(video.end(), "GBDV", "GBDV" + 4);
+    put16(video, width);
+    put16(video, height);
+    put16(video, count);
+
+    std::vector<size_t> sizes;
+    for (uint16_t f=0; f<=count; ++f) {
+        size_t start = video.size();
+        encodeFrame(f ? frames[f - 1] : blank, frames[f % count], width, height, video);
+        sizes.push_back(video.size() - start);
+    }
+
+    FILE *file = fopen(output, "wb");
+    if (!file || fwrite(&video[0], 1, video.size(), file) != video.size()) {
+        fprintf(stderr, "error: cannot write %s\n", output);
+        if (file) fclose(file);
+        return 1;
+    }
+    fclose(file);
+
+    // plays the video twice through the console decoder
+    StdioFile in;
+    in.open(output);
+    gfx::Video<StdioFile> player(in);
+    Picture screen(width * height);
+
+    if (!player.begin()) {
+        fprintf(stderr, "error: %s cannot be read back\n", output);
+        return 1;
+    }
+
+    for (uint32_t f=0; f<2u*count; ++f) {
+        if (!player.nextFrame(gfx::Surface(&screen[0], width, height)) || screen != frames[f % count] || player.frame() != f % count) {
+            fprintf(stderr, "error: frame %u of %s does not match the source\n", f % count + 1, output);
+            return 1;
+        }
+    }
+
+    size_t deltas = 0, largest = 0;
+    for (uint16_t f=1; f<=count; ++f) {
+        deltas += sizes[f];
+        if (sizes[f] > largest) largest = sizes[f];
+    }
+
+    std::vector<uint8_t> source;
+    readFile(input, source);
+
+    printf("%s: %u frames of %ux%u\n", output, count, width, height);
+    printf("  %-22s %8zu bytes, %6zu per frame\n", "source BMP",      source.size(), source.size() / count);
+    printf("  %-22s %8zu bytes, %6u per frame\n",  "raw RGB565",      (size_t)count * width * height * 2, width * height * 2);
+    printf("  %-22s %8zu bytes\n",                 "delta video",     video.size());
+    printf("  %-22s %8zu bytes\n",                 "keyframe",        sizes[0]);
+    printf("  %-22s %8zu bytes, %6zu at most\n",   "delta per frame", deltas / count, largest);
+    printf("  %-22s %8u bytes over %u frames\n",   "SD reads (played)", player.bytesRead(), 2u * count);
+
+    return 0;
+
+}